@@ -0,0 +1,454 @@
+/************************************************************************/
+/*																		*/
+/*	amp.c	--	Second Cortex-A9 core as a row band worker				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		CPU1 start-up, the OCM mailbox and the doorbells. See amp.h.	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added AmpRunOnBoth									*/
+/*		10/19/2026: Added AmpCpuId										*/
+/*		10/19/2026: Flush the CPU1 stack before releasing CPU1			*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "amp.h"
+#include "xstatus.h"
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "xil_mmu.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+#include "xscugic_hw.h"
+#include "xparameters.h"
+#include "../timer_ps/timer_ps.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define AMP_STR(x) #x
+#define AMP_XSTR(x) AMP_STR(x)
+
+/*
+ * L1 data cache geometry, for the set/way invalidate on CPU1
+ */
+#define AMP_L1_WAYS 4
+#define AMP_L1_SETS 256
+#define AMP_L1_LINE_SHIFT 5
+
+/*
+ * ACTLR bits: take part in coherency, and broadcast cache and TLB
+ * maintenance to the other core
+ */
+#define AMP_ACTLR_SMP 0x40
+#define AMP_ACTLR_FW 0x01
+
+/*
+ * TTBR0 walk attributes and SCTLR enables, as set by boot.S for CPU0
+ */
+#define AMP_TTBR_ATTRIB 0x5B
+#define AMP_SCTLR_ENABLE 0x1805 /* MMU, D-cache, flow prediction, I-cache */
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Translation table and vectors from the BSP boot code
+ */
+extern u32 MMUTable;
+extern u32 _vector_table;
+
+AmpMailbox ampMailbox __attribute__((section(".ocm_shared")));
+
+/*
+ * Stack of CPU1, referenced by name from AmpCpu1Start
+ */
+u8 ampCpu1Stack[AMP_CPU1_STACK_SIZE] __attribute__((aligned(16)));
+
+static INTC *ampIntc = NULL;
+static int fCpu1Running = 0;
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Acknowledges every doorbell pending at the CPU1 interface, so WFI sleeps
+ * again
+ */
+static void AmpCpu1Ack(void)
+{
+	u32 iar;
+
+	for (;;)
+	{
+		iar = Xil_In32(XPAR_SCUGIC_0_CPU_BASEADDR + XSCUGIC_INT_ACK_OFFSET);
+		if ((iar & XSCUGIC_ACK_INTID_MASK) == 1023)
+		{
+			return;
+		}
+		Xil_Out32(XPAR_SCUGIC_0_CPU_BASEADDR + XSCUGIC_EOI_OFFSET, iar);
+	}
+}
+
+/*
+ * C side of the CPU1 start-up. Runs with the MMU and caches off until the
+ * translation table is loaded, and never returns.
+ */
+static void __attribute__((noreturn, used)) AmpCpu1Boot(void)
+{
+	u32 way, set;
+	u32 reg;
+	u32 seq;
+
+	/*
+	 * Clean slate: nothing CPU1 holds from before reset is valid
+	 */
+	for (way = 0; way < AMP_L1_WAYS; way++)
+	{
+		for (set = 0; set < AMP_L1_SETS; set++)
+		{
+			mtcp(XREG_CP15_INVAL_DC_LINE_SW, (way << 30) | (set << AMP_L1_LINE_SHIFT));
+		}
+	}
+	mtcp(XREG_CP15_INVAL_UTLB_UNLOCKED, 0);
+	mtcp(XREG_CP15_INVAL_IC_POU, 0);
+	mtcp(XREG_CP15_INVAL_BRANCH_ARRAY, 0);
+	dsb();
+	isb();
+
+	mtcp(XREG_CP15_VEC_BASE_ADDR, (u32) &_vector_table);
+
+	/*
+	 * Join coherency before the data cache is turned on, then use the
+	 * same translation table as CPU0
+	 */
+	reg = mfcp(XREG_CP15_AUX_CONTROL);
+	mtcp(XREG_CP15_AUX_CONTROL, reg | AMP_ACTLR_SMP | AMP_ACTLR_FW);
+	mtcp(XREG_CP15_TTBR0, ((u32) &MMUTable) | AMP_TTBR_ATTRIB);
+	mtcp(XREG_CP15_DOMAIN_ACCESS_CTRL, 0xFFFFFFFF);
+	reg = mfcp(XREG_CP15_SYS_CONTROL);
+	mtcp(XREG_CP15_SYS_CONTROL, reg | AMP_SCTLR_ENABLE);
+	dsb();
+	isb();
+
+	/*
+	 * Let the work doorbell through the banked SGI registers and the CPU
+	 * interface of this core. The CPSR keeps IRQs masked, so the doorbell
+	 * only ends WFI.
+	 */
+	reg = Xil_In32(XPAR_SCUGIC_0_DIST_BASEADDR + XSCUGIC_PRIORITY_OFFSET_CALC(AMP_SGI_WORK));
+	reg &= ~(0xFF << ((AMP_SGI_WORK % 4) * 8));
+	reg |= 0xA0 << ((AMP_SGI_WORK % 4) * 8);
+	Xil_Out32(XPAR_SCUGIC_0_DIST_BASEADDR + XSCUGIC_PRIORITY_OFFSET_CALC(AMP_SGI_WORK), reg);
+	Xil_Out32(XPAR_SCUGIC_0_DIST_BASEADDR + XSCUGIC_ENABLE_SET_OFFSET, 1 << AMP_SGI_WORK);
+	Xil_Out32(XPAR_SCUGIC_0_CPU_BASEADDR + XSCUGIC_CPU_PRIOR_OFFSET, 0xF0);
+	Xil_Out32(XPAR_SCUGIC_0_CPU_BASEADDR + XSCUGIC_CONTROL_OFFSET, 0x07);
+
+	seq = ampMailbox.seq;
+	ampMailbox.doneSeq = seq;
+	dsb();
+	ampMailbox.state = AMP_CPU1_READY;
+
+	for (;;)
+	{
+		while (ampMailbox.seq == seq)
+		{
+			dsb();
+			__asm__ __volatile__ ("wfi" : : : "memory");
+			AmpCpu1Ack();
+		}
+
+		seq = ampMailbox.seq;
+		dmb();
+		ampMailbox.fn(ampMailbox.ref, ampMailbox.yStart, ampMailbox.yEnd);
+		ampMailbox.jobs++;
+
+		/*
+		 * Results must be visible before CPU0 sees the job finished
+		 */
+		dsb();
+		ampMailbox.doneSeq = seq;
+		dsb();
+		Xil_Out32(XPAR_SCUGIC_0_DIST_BASEADDR + XSCUGIC_SFI_TRIG_OFFSET, (XSCUGIC_SPI_CPU0_MASK << 16) | AMP_SGI_DONE);
+	}
+}
+
+/*
+ * Entry point handed to the boot ROM. Masks interrupts, enables the FPU
+ * (the kernels use VFP and NEON), sets the stack and continues in C.
+ */
+static void __attribute__((naked, used)) AmpCpu1Start(void)
+{
+	__asm__ __volatile__ (
+		"cpsid	if, #0x13\n"				/* Supervisor mode, IRQ and FIQ masked */
+		"mrc	p15, 0, r0, c1, c0, 2\n"
+		"orr	r0, r0, #(0xf << 20)\n"		/* Full access to cp10 and cp11 */
+		"mcr	p15, 0, r0, c1, c0, 2\n"
+		"isb\n"
+		"mov	r0, #0x40000000\n"
+		"vmsr	fpexc, r0\n"				/* Enable VFP */
+		"ldr	sp, =ampCpu1Stack + " AMP_XSTR(AMP_CPU1_STACK_SIZE) "\n"
+		"b		AmpCpu1Boot\n"
+	);
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpInit(INTC *intcPtr)
+**
+**	Parameters:
+**		intcPtr - Pointer to the initialized interrupt controller, used
+**				to ring the CPU1 doorbell
+**
+**	Return Value: int
+**		XST_SUCCESS if CPU1 reported in
+**		XST_FAILURE if it did not within AMP_START_TIMEOUT_US, in which
+**				case AmpRunBands runs everything on CPU0
+**
+**	Errors:
+**
+**	Description:
+**		Maps the high OCM shareable and non-cacheable, clears the
+**		mailbox, flushes the CPU1 stack from the data caches, and
+**		releases CPU1 from the boot ROM at AmpCpu1Start.
+**		Must be called once, after TimerStartService.
+**
+*/
+int AmpInit(INTC *intcPtr)
+{
+	u64 deadline;
+
+	ampIntc = intcPtr;
+	fCpu1Running = 0;
+
+	Xil_SetTlbAttributes(AMP_OCM_SECTION, AMP_OCM_ATTRIB);
+	ampMailbox.state = AMP_CPU1_OFF;
+	ampMailbox.seq = 0;
+	ampMailbox.doneSeq = 0;
+	ampMailbox.jobs = 0;
+
+	/*
+	 * CPU1 uses its stack with the caches off until AmpCpu1Boot turns them
+	 * on. Write back and drop any lines CPU0 holds for it, such as those
+	 * of the BSS clear, so none are evicted over the stack later.
+	 */
+	Xil_DCacheFlushRange((UINTPTR) ampCpu1Stack, sizeof(ampCpu1Stack));
+
+	Xil_Out32(AMP_CPU1_START_ADDR, (u32) AmpCpu1Start);
+	dsb();
+	__asm__ __volatile__ ("sev" : : : "memory");
+
+	deadline = TimerGetUs() + AMP_START_TIMEOUT_US;
+	while (ampMailbox.state != AMP_CPU1_READY)
+	{
+		if (TimerGetUs() > deadline)
+		{
+			return XST_FAILURE;
+		}
+	}
+
+	fCpu1Running = 1;
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpIsRunning()
+**
+**	Parameters:
+**
+**	Return Value: int
+**		1 if CPU1 takes bands, 0 if everything runs on CPU0
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+int AmpIsRunning()
+{
+	return fCpu1Running;
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpCpu1Jobs()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of bands CPU1 has run
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 AmpCpu1Jobs()
+{
+	return ampMailbox.jobs;
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Posts fn(ref, yStart, yEnd) to CPU1 and rings its doorbell. Returns the
+ * job number to wait for.
+ */
+static u32 AmpPost(AmpBandFn fn, void *ref, u32 yStart, u32 yEnd)
+{
+	u32 seq;
+
+	ampMailbox.fn = fn;
+	ampMailbox.ref = ref;
+	ampMailbox.yStart = yStart;
+	ampMailbox.yEnd = yEnd;
+	seq = ampMailbox.seq + 1;
+	dsb();
+	ampMailbox.seq = seq;
+	dsb();
+	XScuGic_SoftwareIntr(ampIntc, AMP_SGI_WORK, XSCUGIC_SPI_CPU1_MASK);
+
+	return seq;
+}
+
+/*
+ * Sleeps until CPU1 has finished job seq. The check is made with IRQs
+ * masked, so a doorbell that arrives just before the WFI still wakes it.
+ */
+static void AmpWait(u32 seq)
+{
+	u32 cpsr;
+
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	while (ampMailbox.doneSeq != seq)
+	{
+		TimerSleep();
+		mtcpsr(cpsr);
+		mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	}
+	mtcpsr(cpsr);
+	dmb();
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpCpuId()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of the calling core, 0 or 1
+**
+**	Errors:
+**
+**	Description:
+**		For band functions that keep per core state, such as line
+**		buffers, indexed by core.
+**
+*/
+u32 AmpCpuId()
+{
+	return mfcp(XREG_CP15_MULTI_PROC_AFFINITY) & (AMP_NUM_CPUS - 1);
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpRunBands(AmpBandFn fn, void *ref, u32 height)
+**
+**	Parameters:
+**		fn - Band function
+**		ref - Job description passed to fn, must stay valid until
+**				AmpRunBands returns
+**		height - Number of lines in the job
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Runs fn over lines [0, height). CPU1 takes the bottom half while
+**		CPU0 does the top half, then CPU0 sleeps until the done doorbell.
+**		Timer callbacks and other interrupts keep running on CPU0
+**		throughout. Without CPU1 the whole job runs on CPU0.
+**
+*/
+void AmpRunBands(AmpBandFn fn, void *ref, u32 height)
+{
+	u32 split;
+	u32 seq;
+
+	if (!fCpu1Running || height < 2)
+	{
+		fn(ref, 0, height);
+		return;
+	}
+
+	split = height / 2;
+	seq = AmpPost(fn, ref, split, height);
+	fn(ref, 0, split);
+	AmpWait(seq);
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpRunOnBoth(AmpBandFn fn, void *ref)
+**
+**	Parameters:
+**		fn - Function to run on each core
+**		ref - Passed to fn, must stay valid until AmpRunOnBoth returns
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		For callers that share out the work themselves, such as
+**		tile_sched. Calls fn(ref, 0, 1) on CPU0 and fn(ref, 1, 2) on
+**		CPU1, so the band is the core number, and returns once both
+**		calls have. Without CPU1 only the CPU0 call is made.
+**
+*/
+void AmpRunOnBoth(AmpBandFn fn, void *ref)
+{
+	u32 seq;
+
+	if (!fCpu1Running)
+	{
+		fn(ref, 0, 1);
+		return;
+	}
+
+	seq = AmpPost(fn, ref, 1, 2);
+	fn(ref, 0, 1);
+	AmpWait(seq);
+}
+/* ------------------------------------------------------------ */
+
+/***	AmpDoneIsr(void *callBackRef)
+**
+**	Parameters:
+**		callBackRef - unused
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Handler of the AMP_SGI_DONE doorbell. Taking the interrupt is
+**		what ends the WFI in AmpRunBands, so there is nothing to do.
+**
+*/
+void AmpDoneIsr(void *callBackRef)
+{
+}
+
+/************************************************************************/
@@ -0,0 +1,143 @@
+/************************************************************************/
+/*																		*/
+/*	amp.h	--	Second Cortex-A9 core as a row band worker				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Starts CPU1 as a bare-metal worker and splits frame functions	*/
+/*		into row bands for both cores. CPU0 keeps the UART, menus and	*/
+/*		interrupts; CPU1 only runs bands.								*/
+/*																		*/
+/*		CPU1 runs code from this same image. AmpInit writes the entry	*/
+/*		point to the address the boot ROM polls and wakes CPU1 with		*/
+/*		SEV. CPU1 then gets its own stack, joins the SMP coherency		*/
+/*		domain, turns on the MMU with the translation table CPU0		*/
+/*		uses, and waits for work. Framebuffers and kernel arguments		*/
+/*		stay in shareable DDR, which the SCU keeps coherent between		*/
+/*		the two L1 caches, so cache maintenance done by fb_policy on	*/
+/*		CPU0 also covers what CPU1 wrote.								*/
+/*																		*/
+/*		Jobs are posted in a mailbox in OCM (ps7_ram_1, section			*/
+/*		.ocm_shared in lscript.ld), which AmpInit maps shareable and	*/
+/*		non-cacheable. Doorbells are software generated interrupts:		*/
+/*		AMP_SGI_WORK tells CPU1 a job is posted, AMP_SGI_DONE tells		*/
+/*		CPU0 it is finished. CPU1 takes no interrupts; it sleeps in		*/
+/*		WFI with IRQs masked and acknowledges the doorbell itself.		*/
+/*																		*/
+/*		If CPU1 does not start, for example on a single core device or	*/
+/*		while a debugger holds it, every band runs on CPU0.				*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Add ampIvt to the interrupt vector table passed to			*/
+/*		   fnEnableInterrupts.											*/
+/*		2) After TimerStartService, call AmpInit.						*/
+/*		3) Write the kernel as an AmpBandFn that processes the lines	*/
+/*		   [yStart, yEnd) and call AmpRunBands. Band functions run on	*/
+/*		   both cores at once, so they must only write their own		*/
+/*		   lines, and must not print, profile or touch fb_policy.		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added AmpRunOnBoth									*/
+/*		10/19/2026: Added AmpCpuId										*/
+/*																		*/
+/************************************************************************/
+
+#ifndef AMP_H_
+#define AMP_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../intc/intc.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Software generated interrupt IDs used as doorbells
+ */
+#define AMP_SGI_WORK 0 /* To CPU1: a job is posted */
+#define AMP_SGI_DONE 1 /* To CPU0: the job is finished */
+
+/*
+ * Word the boot ROM polls for the CPU1 entry point after SEV
+ */
+#define AMP_CPU1_START_ADDR 0xFFFFFFF0
+
+/*
+ * 1MB section holding the high OCM, and the attributes the mailbox needs:
+ * S=b1 TEX=b100 AP=b11, Domain=b1111, C=b0, B=b0
+ */
+#define AMP_OCM_SECTION 0xFFF00000
+#define AMP_OCM_ATTRIB 0x14DE2
+
+#define AMP_NUM_CPUS 2
+#define AMP_CPU1_STACK_SIZE 0x4000
+
+/*
+ * How long AmpInit waits for CPU1 to report in
+ */
+#define AMP_START_TIMEOUT_US 100000
+
+/*
+ * Mailbox states
+ */
+#define AMP_CPU1_OFF 0
+#define AMP_CPU1_READY 1
+
+/*
+ * Macro for the AMP_SGI_DONE IVT. The doorbell only wakes CPU0, so it runs
+ * at the priority of the video detect GPIO.
+ * 	x=Interrupt ID, normally AMP_SGI_DONE
+ */
+#define ampIvt(x)\
+	{x, (XInterruptHandler)AmpDoneIsr, NULL, 0xA0, 0x3}
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Processes lines [yStart, yEnd) of the job described by ref
+ */
+typedef void (*AmpBandFn)(void *ref, u32 yStart, u32 yEnd);
+
+/*
+ * Shared between the cores in non-cacheable OCM. CPU0 fills in the job and
+ * then bumps seq; CPU1 copies seq to doneSeq when the band is finished.
+ */
+typedef struct {
+		volatile u32 state; /* AMP_CPU1_OFF or AMP_CPU1_READY, set by CPU1 */
+		volatile u32 seq; /* Number of the last job posted */
+		volatile u32 doneSeq; /* Number of the last job finished */
+		AmpBandFn volatile fn;
+		void *volatile ref;
+		volatile u32 yStart;
+		volatile u32 yEnd;
+		volatile u32 jobs; /* Bands run by CPU1 since it started */
+} AmpMailbox;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int AmpInit(INTC *intcPtr);
+int AmpIsRunning();
+u32 AmpCpu1Jobs();
+void AmpRunBands(AmpBandFn fn, void *ref, u32 height);
+void AmpRunOnBoth(AmpBandFn fn, void *ref);
+u32 AmpCpuId();
+void AmpDoneIsr(void *callBackRef);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* AMP_H_ */
@@ -0,0 +1,161 @@
+/************************************************************************/
+/*																		*/
+/*	bench.c	--	Framebuffer kernel benchmark							*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Runs framebuffer kernels at every resolution in vga_modes.h		*/
+/*		and prints their throughput and cache behavior.					*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "bench.h"
+#include "../display_ctrl/vga_modes.h"
+#include "../timer_ps/timer_ps.h"
+#include "../uart_ps/uart_ps.h"
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static const VideoMode *const benchModes[] = {
+	&VMODE_640x480,
+	&VMODE_800x600,
+	&VMODE_1280x720,
+	&VMODE_1280x1024,
+	&VMODE_1600x900,
+	&VMODE_1920x1080
+};
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	BenchRunCase(const BenchCase *casePtr, u32 width, u32 height, u32 reps, BenchResult *resultPtr)
+**
+**	Parameters:
+**		casePtr - Kernel to run
+**		width - Frame width in pixels
+**		height - Frame height in pixels
+**		reps - Number of times to run the kernel
+**		resultPtr - Receives the totals
+**
+**	Return Value:
+**
+**	Description:
+**		Runs the kernel reps times. Counter differences are taken per
+**		run, so only a single run has to fit in the 32 bit counters.
+**
+*/
+void BenchRunCase(const BenchCase *casePtr, u32 width, u32 height, u32 reps, BenchResult *resultPtr)
+{
+	ProfCounts start, end;
+	u64 startUs;
+	u32 rep;
+	int i;
+
+	resultPtr->width = width;
+	resultPtr->height = height;
+	resultPtr->reps = reps;
+	resultPtr->us = 0;
+	resultPtr->bytes = 0;
+	for (i = 0; i < PROF_NUM_COUNTERS; i++)
+	{
+		resultPtr->counts.count[i] = 0;
+	}
+
+	for (rep = 0; rep < reps; rep++)
+	{
+		startUs = TimerGetUs();
+		ProfSample(&start);
+		resultPtr->bytes += casePtr->fn(casePtr->ref, width, height);
+		ProfSample(&end);
+		resultPtr->us += TimerGetUs() - startUs;
+		for (i = 0; i < PROF_NUM_COUNTERS; i++)
+		{
+			resultPtr->counts.count[i] += (u32) (end.count[i] - start.count[i]);
+		}
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BenchPrintResult(const BenchCase *casePtr, const BenchResult *resultPtr)
+**
+**	Parameters:
+**		casePtr - Kernel that was run
+**		resultPtr - Totals from BenchRunCase
+**
+**	Return Value:
+**
+**	Description:
+**		Prints one table row: megapixels per second, bytes per pixel,
+**		cycles per pixel, L1 data cache misses per 1000 pixels and
+**		instructions per pixel.
+**
+*/
+void BenchPrintResult(const BenchCase *casePtr, const BenchResult *resultPtr)
+{
+	double pixels;
+	double us;
+
+	pixels = (double) resultPtr->width * resultPtr->height * resultPtr->reps;
+	us = (resultPtr->us == 0) ? 1.0 : (double) resultPtr->us;
+	if (pixels == 0.0)
+	{
+		pixels = 1.0;
+	}
+
+	UartPrintf("%-20.20s %4lux%-4lu %8.2f %6.2f %8.2f %9.2f %8.2f\n\r",
+			casePtr->name,
+			(unsigned long) resultPtr->width,
+			(unsigned long) resultPtr->height,
+			pixels / us,
+			(double) resultPtr->bytes / pixels,
+			(double) resultPtr->counts.count[PROF_CYCLES] / pixels,
+			(double) resultPtr->counts.count[PROF_L1D_MISSES] * 1000.0 / pixels,
+			(double) resultPtr->counts.count[PROF_INSTRS] / pixels);
+}
+/* ------------------------------------------------------------ */
+
+/***	BenchRunAll(const BenchCase *cases, u32 numCases, u32 reps)
+**
+**	Parameters:
+**		cases - Kernels to run
+**		numCases - Number of entries in cases
+**		reps - Number of runs per kernel and resolution
+**
+**	Return Value:
+**
+**	Description:
+**		Runs every kernel at every resolution in vga_modes.h and prints
+**		a table of the results. The kernels must use a stride large
+**		enough for 1920x1080.
+**
+*/
+void BenchRunAll(const BenchCase *cases, u32 numCases, u32 reps)
+{
+	BenchResult result;
+	u32 c, m;
+
+	UartPrintf("%-20s %9s %8s %6s %8s %9s %8s\n\r", "Kernel", "Size", "Mpix/s", "B/pix", "Cyc/pix", "L1DM/kpix", "Ins/pix");
+	for (c = 0; c < numCases; c++)
+	{
+		for (m = 0; m < sizeof(benchModes) / sizeof(benchModes[0]); m++)
+		{
+			BenchRunCase(&cases[c], benchModes[m]->width, benchModes[m]->height, reps, &result);
+			BenchPrintResult(&cases[c], &result);
+		}
+	}
+}
+
+/************************************************************************/
@@ -0,0 +1,135 @@
+/************************************************************************/
+/*																		*/
+/*	bw_budget.h	--	Memory bandwidth budget for the video pipeline		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Adds up the DDR traffic of a video configuration and compares	*/
+/*		it with what the memory system can sustain, so a mode change	*/
+/*		that would make the VDMA underflow can be refused before it		*/
+/*		is made instead of showing up as a torn or black picture.		*/
+/*																		*/
+/*		Two limits are checked. The VDMA reaches DDR through the HP0	*/
+/*		port (64 bits at FCLK1), which both channels share: MM2S		*/
+/*		scan-out and S2MM capture must fit there. The CPU goes through	*/
+/*		the L2 and its own DDR port, so registered CPU stages only		*/
+/*		count against the DDR limit, which also carries all of the		*/
+/*		VDMA traffic.													*/
+/*																		*/
+/*		Demand is the rate a stage must keep up while lines are			*/
+/*		active, not the frame average: the VDMA line buffers are too	*/
+/*		small to carry data across vertical blanking. Scan-out is		*/
+/*		active bytes per line times the line rate of the mode. The		*/
+/*		input pixel clock is not known, so capture assumes				*/
+/*		BW_CAPTURE_FPS frames per second of the detected timing.		*/
+/*																		*/
+/*		The budgets start as a fraction of the theoretical peak of		*/
+/*		the Zybo Z7 (DDR3 at 533 MHz on 32 bits, HP0 at 134 MHz) and	*/
+/*		should be replaced with measured figures through BwSetBudget.	*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call BwInit once.											*/
+/*		2) Register continuous CPU work with BwAddStage and remove it	*/
+/*		   with BwRemoveStage when it stops.							*/
+/*		3) Call BwEvaluate with a candidate display mode before			*/
+/*		   changing to it, and with the current one to read the			*/
+/*		   headroom. BW_REFUSE means the configuration will underflow.	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef BW_BUDGET_H_
+#define BW_BUDGET_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../display_ctrl/vga_modes.h"
+#include "../video_capture/video_capture.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define BW_MAX_STAGES 8
+
+/*
+ * Theoretical peaks in bytes per second. DDR3 transfers twice per clock.
+ */
+#define BW_DDR_PEAK_BPS (533333333ULL * 2 * 4)
+#define BW_HP_PEAK_BPS (134000000ULL * 8)
+
+/*
+ * Share of the peak used as the budget until a measured one is set
+ */
+#define BW_DEFAULT_DDR_PCT 70
+#define BW_DEFAULT_HP_PCT 80
+
+/*
+ * Load, in percent of a budget, above which a configuration is accepted
+ * with a warning
+ */
+#define BW_WARN_PCT 85
+
+/*
+ * Frame rate assumed for the capture input
+ */
+#define BW_CAPTURE_FPS 60
+
+#define BW_BYTES_PER_PIXEL 3
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef enum {
+	BW_OK = 0,
+	BW_WARN = 1,
+	BW_REFUSE = 2
+} BwStatus;
+
+typedef struct {
+		const char *name; /* NULL if the slot is free */
+		u64 bytesPerSec;
+} BwStage;
+
+typedef struct {
+		u64 displayBps; /* MM2S scan-out */
+		u64 captureBps; /* S2MM capture, 0 while not streaming */
+		u64 stageBps; /* Sum of the registered CPU stages */
+		u64 hpBps; /* Load on the HP0 port */
+		u64 ddrBps; /* Load on DDR */
+		u64 hpBudget;
+		u64 ddrBudget;
+		s64 hpHeadroom; /* Budget minus load, negative when over */
+		s64 ddrHeadroom;
+		u32 hpPct; /* Load in percent of the budget */
+		u32 ddrPct;
+		BwStatus status;
+} BwReport;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void BwInit(void);
+void BwSetBudget(u64 hpBudget, u64 ddrBudget);
+int BwAddStage(const char *name, u64 bytesPerSec);
+void BwRemoveStage(int stage);
+u64 BwDisplayDemand(const VideoMode *mode);
+u64 BwCaptureDemand(const VideoCapture *videoPtr);
+BwStatus BwEvaluate(const VideoMode *mode, const VideoCapture *videoPtr, BwReport *reportPtr);
+void BwPrintReport(const BwReport *reportPtr);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* BW_BUDGET_H_ */
@@ -0,0 +1,560 @@
+/************************************************************************/
+/*																		*/
+/*	color_lut.c	--	Per channel lookup tables for color grading			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Table building, the table lookup loop and its self check.		*/
+/*		See color_lut.h.												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added ColorLutStretch								*/
+/*		10/19/2026: Tables indexed by PIXFMT_G, PIXFMT_B and PIXFMT_R	*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "color_lut.h"
+#include "xstatus.h"
+#include "../ocm/ocm.h"
+#include <string.h>
+
+#ifdef __linux__
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <time.h>
+ #define COLOR_LUT_PRINTF printf
+#else
+ #include "../uart_ps/uart_ps.h"
+ #define COLOR_LUT_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Self check: the most pixels graded, and the guard bytes kept around
+ * them
+ */
+#define COLOR_LUT_CHECK_MAX 13
+#define COLOR_LUT_CHECK_GUARD 8
+#define COLOR_LUT_CHECK_BYTES (COLOR_LUT_CHECK_MAX * 4 + 2 * COLOR_LUT_CHECK_GUARD + 4)
+
+/*
+ * Frame graded by the host program, and its runs of each test
+ */
+#define COLOR_LUT_HOST_W 1920
+#define COLOR_LUT_HOST_H 1080
+#define COLOR_LUT_HOST_REPS 20
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static ColorLut checkLut;
+static u8 checkSrc[COLOR_LUT_CHECK_BYTES];
+static u8 checkDst[COLOR_LUT_CHECK_BYTES];
+static u8 checkRef[COLOR_LUT_CHECK_BYTES];
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * x ^ y for 0 < x <= 1, as 2 ^ (y * log2(x)). The logarithm comes from the
+ * atanh series and the power of two from the exponential series, both
+ * converged far past what an 8 bit table needs; the BSP links no libm.
+ */
+static double ColorLutPow(double x, double y)
+{
+	double z, z2, term, sum, f;
+	int n, i;
+
+	/* log2(x) = n + ln(m) / ln(2), with m in [0.5, 1) */
+	n = 0;
+	while (x < 0.5)
+	{
+		x *= 2.0;
+		n--;
+	}
+	z = (x - 1.0) / (x + 1.0);
+	z2 = z * z;
+	term = z;
+	sum = 0.0;
+	for (i = 1; i < 40; i += 2)
+	{
+		sum += term / i;
+		term *= z2;
+	}
+	f = y * (n + 2.0 * sum / 0.69314718055994531);
+
+	/* 2 ^ f = 2 ^ n * e ^ ((f - n) * ln(2)), with f - n in [0, 1) */
+	if (f < -60.0)
+	{
+		return 0.0;
+	}
+	n = (int) f;
+	if ((double) n > f)
+	{
+		n--;
+	}
+	z = (f - n) * 0.69314718055994531;
+	term = 1.0;
+	sum = 1.0;
+	for (i = 1; i < 20; i++)
+	{
+		term *= z / i;
+		sum += term;
+	}
+	for (; n < 0; n++)
+	{
+		sum *= 0.5;
+	}
+	for (; n > 0; n--)
+	{
+		sum *= 2.0;
+	}
+
+	return sum;
+}
+/* ------------------------------------------------------------ */
+
+/***	ColorLutDefaults(ColorLutParams *paramsPtr)
+**
+**	Parameters:
+**		paramsPtr - Settings to reset
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Sets settings that leave every pixel unchanged.
+**
+*/
+void ColorLutDefaults(ColorLutParams *paramsPtr)
+{
+	paramsPtr->gamma = 100;
+	paramsPtr->brightness = 0;
+	paramsPtr->contrast = 100;
+	paramsPtr->temperature = 0;
+	paramsPtr->fInvert = 0;
+}
+/* ------------------------------------------------------------ */
+
+/***	ColorLutSet(ColorLut *lutPtr, const ColorLutParams *paramsPtr)
+**
+**	Parameters:
+**		lutPtr - Tables to build. Zeroed, or built before.
+**		paramsPtr - Settings to build them for
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**
+**	Errors:
+**		XST_INVALID_PARAM if a setting is out of range; the tables are
+**		left as they were
+**
+**	Description:
+**		Rebuilds the tables for paramsPtr, unless they were last built
+**		for the same settings, and works out whether they amount to an
+**		XOR.
+**
+*/
+int ColorLutSet(ColorLut *lutPtr, const ColorLutParams *paramsPtr)
+{
+	double gain[3];
+	double exponent, level, v;
+	u32 c, i;
+
+	if (paramsPtr->gamma < COLOR_LUT_GAMMA_MIN || paramsPtr->gamma > COLOR_LUT_GAMMA_MAX ||
+			paramsPtr->brightness < -255 || paramsPtr->brightness > 255 ||
+			paramsPtr->contrast < 0 || paramsPtr->contrast > COLOR_LUT_CONTRAST_MAX ||
+			paramsPtr->temperature < -COLOR_LUT_TEMP_MAX || paramsPtr->temperature > COLOR_LUT_TEMP_MAX)
+	{
+		return XST_INVALID_PARAM;
+	}
+	if (lutPtr->fBuilt && memcmp(&lutPtr->params, paramsPtr, sizeof(*paramsPtr)) == 0)
+	{
+		return XST_SUCCESS;
+	}
+
+	/*
+	 * Warmer raises red and lowers blue by up to half
+	 */
+	gain[PIXFMT_G] = 1.0;
+	gain[PIXFMT_B] = 1.0 - paramsPtr->temperature / 200.0;
+	gain[PIXFMT_R] = 1.0 + paramsPtr->temperature / 200.0;
+	exponent = 100.0 / paramsPtr->gamma;
+
+	for (i = 0; i < 256; i++)
+	{
+		level = i / 255.0;
+		if (i != 0 && paramsPtr->gamma != 100)
+		{
+			level = ColorLutPow(level, exponent);
+		}
+		level = (level - 0.5) * paramsPtr->contrast / 100.0 + 0.5 + paramsPtr->brightness / 255.0;
+
+		for (c = 0; c < 3; c++)
+		{
+			v = level * gain[c] * 255.0 + 0.5;
+			if (v < 0.0)
+			{
+				v = 0.0;
+			}
+			else if (v > 255.0)
+			{
+				v = 255.0;
+			}
+			lutPtr->table[c][i] = (u8) v;
+			if (paramsPtr->fInvert)
+			{
+				lutPtr->table[c][i] = ~lutPtr->table[c][i];
+			}
+		}
+	}
+	memset(lutPtr->table[3], 0, sizeof(lutPtr->table[3]));
+
+	lutPtr->xorByte = lutPtr->table[0][0];
+	lutPtr->fXor = 1;
+	for (c = 0; c < 3; c++)
+	{
+		for (i = 0; i < 256; i++)
+		{
+			if (lutPtr->table[c][i] != (u8) (i ^ lutPtr->xorByte))
+			{
+				lutPtr->fXor = 0;
+			}
+		}
+	}
+
+	lutPtr->params = *paramsPtr;
+	lutPtr->fBuilt = 1;
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	ColorLutStretch(ColorLutParams *paramsPtr, u32 low, u32 high)
+**
+**	Parameters:
+**		paramsPtr - Settings to change
+**		low, high - Input levels to take to 0 and 255
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**
+**	Errors:
+**		XST_INVALID_PARAM if high is not above low or past 255; the
+**		settings are left as they were
+**
+**	Description:
+**		Turns gamma off and sets the contrast and brightness that
+**		stretch [low, high] over the full range, as far as their ranges
+**		allow. For auto-contrast, with low and high from the histogram
+**		of a frame. Temperature and inversion are kept.
+**
+*/
+int ColorLutStretch(ColorLutParams *paramsPtr, u32 low, u32 high)
+{
+	double brightness;
+	int contrast;
+
+	if (high <= low || high > 255)
+	{
+		return XST_INVALID_PARAM;
+	}
+
+	contrast = (int) ((255 * 100 + (high - low) / 2) / (high - low));
+	if (contrast > COLOR_LUT_CONTRAST_MAX)
+	{
+		contrast = COLOR_LUT_CONTRAST_MAX;
+	}
+
+	/*
+	 * Solve (low / 255 - 0.5) * contrast / 100 + 0.5 + brightness / 255 = 0
+	 */
+	brightness = -((low - 127.5) * contrast / 100.0) - 127.5;
+	if (brightness < -255.0)
+	{
+		brightness = -255.0;
+	}
+	else if (brightness > 255.0)
+	{
+		brightness = 255.0;
+	}
+
+	paramsPtr->gamma = 100;
+	paramsPtr->contrast = contrast;
+	paramsPtr->brightness = (int) ((brightness < 0.0) ? brightness - 0.5 : brightness + 0.5);
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	ColorLutXorWord(const ColorLut *lutPtr, PixFmt fmt)
+**
+**	Parameters:
+**		lutPtr - Built tables with fXor set
+**		fmt - Format of the frames they will be applied to
+**
+**	Return Value: u32
+**		Word to XOR each 4 bytes of a line with, leaving the unused
+**		byte of XRGB8888 pixels 0
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 ColorLutXorWord(const ColorLut *lutPtr, PixFmt fmt)
+{
+	return lutPtr->xorByte * ((fmt == PIXFMT_XRGB8888) ? 0x00010101u : 0x01010101u);
+}
+/* ------------------------------------------------------------ */
+
+/***	ColorLutApply(const ColorLut *lutPtr, u8 *dst, const u8 *src, u32 pixels, PixFmt fmt)
+**
+**	Parameters:
+**		lutPtr - Built tables
+**		dst - First pixel to write
+**		src - First pixel to grade, may be dst
+**		pixels - Number of pixels
+**		fmt - Format of both
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Looks every channel of a run of pixels up in the tables.
+**		XRGB8888 pixels must be word aligned. Runs from OCM.
+**
+*/
+OCM_TEXT void ColorLutApply(const ColorLut *lutPtr, u8 *dst, const u8 *src, u32 pixels, PixFmt fmt)
+{
+	const u8 *tg = lutPtr->table[PIXFMT_G];
+	const u8 *tb = lutPtr->table[PIXFMT_B];
+	const u8 *tr = lutPtr->table[PIXFMT_R];
+	u32 w0, w1, w2;
+	u32 i;
+
+	if (fmt == PIXFMT_XRGB8888)
+	{
+		for (i = 0; i < pixels; i++)
+		{
+			w0 = ((const u32 *) src)[i];
+			((u32 *) dst)[i] = tg[w0 & 0xFF] | (tb[(w0 >> 8) & 0xFF] << 8) | (tr[(w0 >> 16) & 0xFF] << 16);
+		}
+		return;
+	}
+
+	/*
+	 * Four RGB888 pixels are three words: GBRG BRGB RGBR
+	 */
+	for (i = 0; i + 4 <= pixels; i += 4)
+	{
+		memcpy(&w0, src, 4);
+		memcpy(&w1, src + 4, 4);
+		memcpy(&w2, src + 8, 4);
+		w0 = tg[w0 & 0xFF] | (tb[(w0 >> 8) & 0xFF] << 8) | (tr[(w0 >> 16) & 0xFF] << 16) | ((u32) tg[w0 >> 24] << 24);
+		w1 = tb[w1 & 0xFF] | (tr[(w1 >> 8) & 0xFF] << 8) | (tg[(w1 >> 16) & 0xFF] << 16) | ((u32) tb[w1 >> 24] << 24);
+		w2 = tr[w2 & 0xFF] | (tg[(w2 >> 8) & 0xFF] << 8) | (tb[(w2 >> 16) & 0xFF] << 16) | ((u32) tr[w2 >> 24] << 24);
+		memcpy(dst, &w0, 4);
+		memcpy(dst + 4, &w1, 4);
+		memcpy(dst + 8, &w2, 4);
+		src += 12;
+		dst += 12;
+	}
+	for (; i < pixels; i++)
+	{
+		dst[PIXFMT_G] = tg[src[PIXFMT_G]];
+		dst[PIXFMT_B] = tb[src[PIXFMT_B]];
+		dst[PIXFMT_R] = tr[src[PIXFMT_R]];
+		src += 3;
+		dst += 3;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	ColorLutCheck()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of failed cases, 0 if all passed
+**
+**	Errors:
+**
+**	Description:
+**		Checks that the defaults and plain inversion come out as XORs
+**		with 0x00 and 0xFF and that a warm temperature raises the red
+**		byte and lowers the blue one, then runs ColorLutApply for several settings
+**		against a byte loop over the tables, for every pixel count up to
+**		COLOR_LUT_CHECK_MAX in both formats and every RGB888 alignment,
+**		and checks nothing outside the destination was written.
+**		Failures are printed.
+**
+*/
+u32 ColorLutCheck()
+{
+	ColorLutParams params[4];
+	u32 failures = 0;
+	u32 p, f, off, n, i, bytes;
+	PixFmt fmt;
+
+	for (p = 0; p < 4; p++)
+	{
+		ColorLutDefaults(&params[p]);
+	}
+	params[1].fInvert = 1;
+	params[2].gamma = 220;
+	params[2].temperature = 40;
+	params[3].brightness = -30;
+	params[3].contrast = 150;
+	params[3].temperature = -75;
+	params[3].fInvert = 1;
+
+	for (p = 0; p < 4; p++)
+	{
+		memset(&checkLut, 0, sizeof(checkLut));
+		if (ColorLutSet(&checkLut, &params[p]) != XST_SUCCESS)
+		{
+			COLOR_LUT_PRINTF("ColorLutSet FAILED: settings %lu refused\n\r", (unsigned long) p);
+			failures++;
+			continue;
+		}
+		if (p < 2 && (!checkLut.fXor || checkLut.xorByte != (p ? 0xFF : 0x00)))
+		{
+			COLOR_LUT_PRINTF("ColorLutSet FAILED: settings %lu not an XOR with 0x%02x\n\r", (unsigned long) p, p ? 0xFF : 0x00);
+			failures++;
+		}
+		if (p == 2 && !(checkLut.table[PIXFMT_R][128] > checkLut.table[PIXFMT_G][128] &&
+				checkLut.table[PIXFMT_G][128] > checkLut.table[PIXFMT_B][128]))
+		{
+			COLOR_LUT_PRINTF("ColorLutSet FAILED: settings %lu not warmer in the red byte\n\r", (unsigned long) p);
+			failures++;
+		}
+
+		for (f = 0; f < 2; f++)
+		{
+			fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+			for (off = 0; off < (f ? 1u : 4u); off++)
+			{
+				for (n = 0; n <= COLOR_LUT_CHECK_MAX; n++)
+				{
+					bytes = n * PixFmtBytes(fmt);
+					for (i = 0; i < COLOR_LUT_CHECK_BYTES; i++)
+					{
+						checkSrc[i] = (u8) (i * 29 + p * 7 + 3);
+						checkDst[i] = 0xA5;
+						checkRef[i] = 0xA5;
+					}
+					for (i = 0; i < bytes; i++)
+					{
+						if (fmt == PIXFMT_XRGB8888 && (i & 3) == 3)
+						{
+							checkSrc[COLOR_LUT_CHECK_GUARD + off + i] = 0;
+						}
+						checkRef[COLOR_LUT_CHECK_GUARD + off + i] = checkLut.table[i % PixFmtBytes(fmt)][checkSrc[COLOR_LUT_CHECK_GUARD + off + i]];
+					}
+
+					ColorLutApply(&checkLut, checkDst + COLOR_LUT_CHECK_GUARD + off, checkSrc + COLOR_LUT_CHECK_GUARD + off, n, fmt);
+					if (memcmp(checkDst, checkRef, sizeof(checkDst)) != 0)
+					{
+						COLOR_LUT_PRINTF("ColorLutApply FAILED: settings %lu, %s, +%lu, %lu pixels\n\r", (unsigned long) p,
+								PixFmtName(fmt), (unsigned long) off, (unsigned long) n);
+						failures++;
+					}
+				}
+			}
+		}
+	}
+
+	return failures;
+}
+
+#if defined(__linux__) && defined(COLOR_LUT_MAIN)
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 ColorLutUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int main(void)
+{
+	static ColorLut lut;
+	ColorLutParams params;
+	u8 *frame;
+	u32 failures, r, i, f, rebuilds;
+	u64 start, us;
+	PixFmt fmt;
+
+	failures = ColorLutCheck();
+	printf("Self check: %lu failure(s)\n\n", (unsigned long) failures);
+
+	if (posix_memalign((void **) &frame, 64, COLOR_LUT_HOST_W * 4 * COLOR_LUT_HOST_H) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < COLOR_LUT_HOST_W * 4 * COLOR_LUT_HOST_H; i++)
+	{
+		frame[i] = (u8) (i * 7);
+	}
+
+	ColorLutDefaults(&params);
+	params.gamma = 180;
+	params.contrast = 120;
+	params.temperature = 30;
+
+	start = ColorLutUs();
+	rebuilds = 0;
+	for (r = 0; r < 1000; r++)
+	{
+		params.brightness = r & 1;
+		ColorLutSet(&lut, &params);
+		rebuilds++;
+	}
+	us = ColorLutUs() - start;
+	printf("%-24s %8.1f us\n\n", "ColorLutSet rebuild", (double) us / rebuilds);
+
+	printf("%-24s %8s %8s\n", "Apply", "Mpix/s", "ms/frame");
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		start = ColorLutUs();
+		for (r = 0; r < COLOR_LUT_HOST_REPS; r++)
+		{
+			for (i = 0; i < COLOR_LUT_HOST_H; i++)
+			{
+				ColorLutApply(&lut, frame + i * COLOR_LUT_HOST_W * 4, frame + i * COLOR_LUT_HOST_W * 4, COLOR_LUT_HOST_W, fmt);
+			}
+		}
+		us = ColorLutUs() - start;
+		printf("%-24s %8.1f %8.2f\n", PixFmtName(fmt), (double) COLOR_LUT_HOST_W * COLOR_LUT_HOST_H * COLOR_LUT_HOST_REPS / us,
+				us / 1000.0 / COLOR_LUT_HOST_REPS);
+	}
+
+	free(frame);
+
+	return failures ? 1 : 0;
+}
+#endif
+
+/************************************************************************/
@@ -0,0 +1,102 @@
+/************************************************************************/
+/*																		*/
+/*	color_lut.h	--	Per channel lookup tables for color grading			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Turns gamma, brightness, contrast, color temperature and		*/
+/*		inversion settings into one 256 entry table per channel, so		*/
+/*		grading a pixel costs three table lookups however many			*/
+/*		settings are in use. ColorLutSet rebuilds the tables only		*/
+/*		when the settings differ from the ones they were built for,		*/
+/*		so it can be called every frame.								*/
+/*																		*/
+/*		Each build also checks whether every channel comes out as its	*/
+/*		input XORed with one byte, as it does with only inversion on	*/
+/*		(0xFF) or nothing on (0x00). Such a table is marked fXor and	*/
+/*		callers can apply it with vector XORs rather than lookups.		*/
+/*																		*/
+/*		The lookups are scalar. NEON VTBL on ARMv7 indexes at most 32	*/
+/*		entries, so a 256 entry table would take eight VTBX per 8		*/
+/*		bytes, more than the byte loads it replaces. ColorLutApply		*/
+/*		loads RGB888 as three words per four pixels and XRGB8888 as one	*/
+/*		word per pixel, and runs from OCM.								*/
+/*																		*/
+/*		With COLOR_LUT_MAIN defined on Linux the module builds as a		*/
+/*		stand-alone host program that checks ColorLutApply against a	*/
+/*		byte loop and times it over one 1920x1080 frame:				*/
+/*			gcc -O2 -DCOLOR_LUT_MAIN -I<bsp>/include -I.				*/
+/*				color_lut/color_lut.c pixfmt/pixfmt.c blit/blit.c		*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_mem.c -o color_lut	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added ColorLutStretch for auto-contrast				*/
+/*		10/19/2026: Tables indexed by PIXFMT_G, PIXFMT_B and PIXFMT_R	*/
+/*																		*/
+/************************************************************************/
+
+#ifndef COLOR_LUT_H_
+#define COLOR_LUT_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../pixfmt/pixfmt.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Ranges ColorLutSet accepts
+ */
+#define COLOR_LUT_GAMMA_MIN 10
+#define COLOR_LUT_GAMMA_MAX 1000
+#define COLOR_LUT_CONTRAST_MAX 1000
+#define COLOR_LUT_TEMP_MAX 100
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Grading settings. Applied in the order listed.
+ */
+typedef struct {
+		int gamma; /* Percent; output = input ^ (100 / gamma), 100 for none */
+		int brightness; /* Added to every channel, -255 to 255 */
+		int contrast; /* Gain around mid grey in percent, 100 for none */
+		int temperature; /* -100 to 100; warmer above 0, cooler below */
+		int fInvert; /* Invert the result */
+} ColorLutParams;
+
+typedef struct {
+		ColorLutParams params; /* Settings the tables were built for */
+		u8 table[4][256]; /* Output of each byte of an XRGB8888 pixel, see PIXFMT_G, PIXFMT_B and PIXFMT_R; the fourth is all 0 */
+		int fXor; /* Every channel is its input XORed with xorByte */
+		u8 xorByte;
+		int fBuilt;
+} ColorLut;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void ColorLutDefaults(ColorLutParams *paramsPtr);
+int ColorLutSet(ColorLut *lutPtr, const ColorLutParams *paramsPtr);
+int ColorLutStretch(ColorLutParams *paramsPtr, u32 low, u32 high);
+u32 ColorLutXorWord(const ColorLut *lutPtr, PixFmt fmt);
+void ColorLutApply(const ColorLut *lutPtr, u8 *dst, const u8 *src, u32 pixels, PixFmt fmt);
+u32 ColorLutCheck();
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* COLOR_LUT_H_ */
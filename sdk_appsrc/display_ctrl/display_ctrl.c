@@ -41,6 +41,10 @@
 /*		2/20/2014(SamB): Created										*/
 /*		11/25/2015(SamB): Changed from axi_dispctrl to Xilinx cores		*/
 /*						  Separated Clock functions into dynclk library */
+/*		10/19/2026: Added frame counter and per-frame callback driven	*/
+/*					by the VTC generator VBLANK interrupt				*/
+/*		10/19/2026: Framebuffer pixel format taken from the VDMA		*/
+/*					stream width										*/
 /*																		*/
 /************************************************************************/
 /*
@@ -99,6 +103,7 @@ int DisplayStop(DisplayCtrl *dispPtr)
 	 * Disable the disp_ctrl core, and wait for the current frame to finish (the core cannot stop
 	 * mid-frame)
 	 */
+	XVtc_IntrDisable(&dispPtr->vtc, XVTC_IXR_G_VBLANK_MASK);
 	XVtc_DisableGenerator(&dispPtr->vtc);
 
 	/*
@@ -237,12 +242,21 @@ int DisplayStart(DisplayCtrl *dispPtr)
 	 */
 	XVtc_EnableGenerator(&dispPtr->vtc);
 
+	/*
+	 * Start counting frames again if a frame callback is attached
+	 */
+	if (dispPtr->frameCallBack != NULL)
+	{
+		XVtc_IntrClear(&dispPtr->vtc, XVTC_IXR_G_VBLANK_MASK);
+		XVtc_IntrEnable(&dispPtr->vtc, XVTC_IXR_G_VBLANK_MASK);
+	}
+
 	/*
 	 * Configure the VDMA to access a frame with the same dimensions as the
 	 * current mode
 	 */
 	dispPtr->vdmaConfig.VertSizeInput = dispPtr->vMode.height;
-	dispPtr->vdmaConfig.HoriSizeInput = (dispPtr->vMode.width) * 3;
+	dispPtr->vdmaConfig.HoriSizeInput = (dispPtr->vMode.width) * PixFmtBytes(dispPtr->fmt);
 	dispPtr->vdmaConfig.FixedFrameStoreAddr = dispPtr->curFrame;
 	/*
 	 *Also reset the stride and address values, in case the user manually changed them
@@ -306,7 +320,9 @@ int DisplayStart(DisplayCtrl *dispPtr)
 **	Errors:
 **
 **	Description:
-**		Initializes the driver struct for use.
+**		Initializes the driver struct for use. The pixel format of the
+**		framebuffers is left in fmt, found from the width of the VDMA's
+**		MM2S stream.
 **
 */
 int DisplayInitialize(DisplayCtrl *dispPtr, XAxiVdma *vdma, u16 vtcId, u32 dynClkAddr, u8 *framePtr[DISPLAY_NUM_FRAMES], u32 stride)
@@ -330,6 +346,9 @@ int DisplayInitialize(DisplayCtrl *dispPtr, XAxiVdma *vdma, u16 vtcId, u32 dynCl
 	dispPtr->state = DISPLAY_STOPPED;
 	dispPtr->stride = stride;
 	dispPtr->vMode = VMODE_640x480;
+	dispPtr->frameCallBack = NULL;
+	dispPtr->frameCallBackRef = NULL;
+	dispPtr->frameCount = 0;
 
 	ClkFindParams(dispPtr->vMode.freq, &clkMode);
 
@@ -368,9 +387,20 @@ int DisplayInitialize(DisplayCtrl *dispPtr, XAxiVdma *vdma, u16 vtcId, u32 dynCl
 	if (Status != (XST_SUCCESS)) {
 		return (XST_FAILURE);
 	}
+	XVtc_IntrDisable(&(dispPtr->vtc), XVTC_IXR_ALLINTR_MASK);
+	XVtc_SetCallBack(&(dispPtr->vtc), XVTC_HANDLER_GENERATOR, DisplayVtcIsr, dispPtr);
 
 	dispPtr->vdma = vdma;
 
+	/*
+	 * The VDMA streams memory out unchanged, so the framebuffers must hold
+	 * one MM2S stream word per pixel
+	 */
+	if (PixFmtFromStreamWidth(XAxiVdma_GetChannel(vdma, XAXIVDMA_READ)->StreamWidth * 8, &dispPtr->fmt) != XST_SUCCESS)
+	{
+		xdbg_printf(XDBG_DEBUG_GENERAL, "No pixel format for the MM2S stream width\n\r");
+		return XST_FAILURE;
+	}
 
 	/*
 	 * Initialize the VDMA Read configuration struct
@@ -463,6 +493,57 @@ int DisplayChangeFrame(DisplayCtrl *dispPtr, u32 frameIndex)
 
 	return XST_SUCCESS;
 }
+/* ------------------------------------------------------------ */
+
+/***	DisplaySetFrameCallback(DisplayCtrl *dispPtr, DisplayCallBack CallBackFunc, void *CallBackRef)
+**
+**	Parameters:
+**		dispPtr - Pointer to the initialized DisplayCtrl struct
+**		CallBackFunc - Callback function, or NULL to stop frame interrupts
+**		CallBackRef - Data to pass to callback function
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Sets the callback function that is called at the start of the
+**		vertical blanking interval of every frame sent to the display.
+**		It runs in interrupt context, so it should be kept short. The
+**		display VTC interrupt must be in the vector table (see the
+**		displayVtcIvt macro). frameCount is only advanced while a
+**		callback is set.
+**
+*/
+void DisplaySetFrameCallback(DisplayCtrl *dispPtr, DisplayCallBack CallBackFunc, void *CallBackRef)
+{
+	XVtc_IntrDisable(&dispPtr->vtc, XVTC_IXR_G_VBLANK_MASK);
+
+	dispPtr->frameCallBackRef = CallBackRef;
+	dispPtr->frameCallBack = CallBackFunc;
+
+	if (CallBackFunc != NULL && dispPtr->state == DISPLAY_RUNNING)
+	{
+		XVtc_IntrClear(&dispPtr->vtc, XVTC_IXR_G_VBLANK_MASK);
+		XVtc_IntrEnable(&dispPtr->vtc, XVTC_IXR_G_VBLANK_MASK);
+	}
+}
+
+/*
+ * Generator callback installed on the display VTC. Counts the frame and
+ * forwards it to the user frame callback.
+ */
+void DisplayVtcIsr(void *InstancePtr, u32 pendingIrpt)
+{
+	DisplayCtrl *dispPtr = (DisplayCtrl *)InstancePtr;
+
+	if (pendingIrpt & XVTC_IXR_G_VBLANK_MASK)
+	{
+		dispPtr->frameCount++;
+		if (dispPtr->frameCallBack != NULL)
+			dispPtr->frameCallBack(dispPtr->frameCallBackRef, (void *) dispPtr);
+	}
+}
 
 
 /************************************************************************/
@@ -41,6 +41,10 @@
 /*		2/20/2014(SamB): Created										*/
 /*		11/25/2015(SamB): Changed from axi_dispctrl to Xilinx cores		*/
 /*						  Separated Clock functions into dynclk library */
+/*		10/19/2026: Added frame counter and per-frame callback driven	*/
+/*					by the VTC generator VBLANK interrupt				*/
+/*		10/19/2026: Framebuffer pixel format taken from the VDMA		*/
+/*					stream width										*/
 /*																		*/
 /************************************************************************/
 
@@ -56,6 +60,7 @@
 #include "xaxivdma.h"
 #include "xvtc.h"
 #include "../dynclk/dynclk.h"
+#include "../pixfmt/pixfmt.h"
 
 /* ------------------------------------------------------------ */
 /*					Miscellaneous Declarations					*/
@@ -70,6 +75,14 @@
  */
 #define DISPLAY_NUM_FRAMES 3
 
+/*
+ * Macro for the display VTC IVT. Only needed when a frame callback is used.
+ * 	x=Display VTC Interrupt ID
+ * 	y=pointer to XVtc struct referred to by DisplayCtrl struct
+ */
+#define displayVtcIvt(x,y)\
+	{x, (XInterruptHandler)XVtc_IntrHandler, y, 0x98, 0x3}
+
 /* ------------------------------------------------------------ */
 /*					General Type Declarations					*/
 /* ------------------------------------------------------------ */
@@ -79,6 +92,12 @@ typedef enum {
 	DISPLAY_RUNNING = 1
 } DisplayState;
 
+/*
+ * typedef for the frame callback function. Called from interrupt context at
+ * the start of every vertical blanking interval.
+ */
+typedef void (*DisplayCallBack)(void *callBackRef, void *pDisplay);
+
 typedef struct {
 		u32 dynClkAddr; /*Physical Base address of the dynclk core*/
 		XAxiVdma *vdma; /*VDMA driver struct*/
@@ -87,9 +106,13 @@ typedef struct {
 		VideoMode vMode; /*Current Video mode*/
 		u8 *framePtr[DISPLAY_NUM_FRAMES]; /* Array of pointers to the framebuffers */
 		u32 stride; /* The line stride of the framebuffers, in bytes */
+		PixFmt fmt; /* Pixel format of the framebuffers, set by the width of the MM2S stream */
 		double pxlFreq; /* Frequency of clock currently being generated */
 		u32 curFrame; /* Current frame being displayed */
 		DisplayState state; /* Indicates if the Display is currently running */
+		DisplayCallBack frameCallBack; /* Called once per frame, NULL if unused */
+		void *frameCallBackRef;
+		volatile u32 frameCount; /* Frames output since DisplayInitialize, only counted while a frame callback is set */
 } DisplayCtrl;
 
 /* ------------------------------------------------------------ */
@@ -101,6 +124,8 @@ int DisplayStart(DisplayCtrl *dispPtr);
 int DisplayInitialize(DisplayCtrl *dispPtr, XAxiVdma *vdma, u16 vtcId, u32 dynClkAddr, u8 *framePtr[DISPLAY_NUM_FRAMES], u32 stride);
 int DisplaySetMode(DisplayCtrl *dispPtr, const VideoMode *newMode);
 int DisplayChangeFrame(DisplayCtrl *dispPtr, u32 frameIndex);
+void DisplaySetFrameCallback(DisplayCtrl *dispPtr, DisplayCallBack CallBackFunc, void *CallBackRef);
+void DisplayVtcIsr(void *InstancePtr, u32 pendingIrpt);
 
 /* ------------------------------------------------------------ */
 
@@ -0,0 +1,431 @@
+/************************************************************************/
+/*																		*/
+/*	frame_stats.c	--	Histograms and statistics of frames				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		The histogram pass, merging, the statistics read off the		*/
+/*		histograms and the self check. See frame_stats.h.				*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Channels in the G, B, R order of pixfmt.h			*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "frame_stats.h"
+#include "../ocm/ocm.h"
+#include <string.h>
+
+#ifdef __linux__
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <time.h>
+ #define FRAME_STATS_PRINTF printf
+#else
+ #include "../uart_ps/uart_ps.h"
+ #define FRAME_STATS_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Self check: pixels in the check line
+ */
+#define FRAME_STATS_CHECK_MAX 61
+
+/*
+ * Frame counted by the host program, and its runs of each test
+ */
+#define FRAME_STATS_HOST_W 1920
+#define FRAME_STATS_HOST_H 1080
+#define FRAME_STATS_HOST_REPS 20
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static FrameStats checkStats;
+static FrameStats checkRef;
+static FrameStats checkPart;
+static u8 checkLine[FRAME_STATS_CHECK_MAX * 4];
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	FrameStatsReset(FrameStats *statsPtr)
+**
+**	Parameters:
+**		statsPtr - Statistics to empty
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+void FrameStatsReset(FrameStats *statsPtr)
+{
+	memset(statsPtr, 0, sizeof(*statsPtr));
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Body of FrameStatsAccumulate, always inlined so each format gets a loop
+ * with a constant pixel size
+ */
+static inline __attribute__((always_inline)) void FrameStatsLine(FrameStats *statsPtr, const u8 *line, u32 pixels, u32 bytes)
+{
+	u32 *histB = statsPtr->hist[FRAME_STATS_BLUE];
+	u32 *histG = statsPtr->hist[FRAME_STATS_GREEN];
+	u32 *histR = statsPtr->hist[FRAME_STATS_RED];
+	u32 *histY = statsPtr->hist[FRAME_STATS_LUMA];
+	u32 low = 0;
+	u32 high = 0;
+	u32 b, g, r;
+	u32 i;
+
+	for (i = 0; i < pixels; i++)
+	{
+		g = line[PIXFMT_G];
+		b = line[PIXFMT_B];
+		r = line[PIXFMT_R];
+		histB[b]++;
+		histG[g]++;
+		histR[r]++;
+		histY[(77 * r + 150 * g + 29 * b) >> 8]++;
+
+		/* Only 0 - 1 and 254 - 255 wrap to the sign bit */
+		low += ((b - 1) | (g - 1) | (r - 1)) >> 31;
+		high += ((254 - b) | (254 - g) | (254 - r)) >> 31;
+		line += bytes;
+	}
+
+	statsPtr->pixels += pixels;
+	statsPtr->clippedLow += low;
+	statsPtr->clippedHigh += high;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameStatsAccumulate(FrameStats *statsPtr, const u8 *line, u32 pixels, PixFmt fmt)
+**
+**	Parameters:
+**		statsPtr - Statistics to add to
+**		line - First pixel
+**		pixels - Number of pixels
+**		fmt - Format of the pixels
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Counts a run of pixels into the histograms and clip counts.
+**		Runs from OCM.
+**
+*/
+OCM_TEXT void FrameStatsAccumulate(FrameStats *statsPtr, const u8 *line, u32 pixels, PixFmt fmt)
+{
+	if (fmt == PIXFMT_XRGB8888)
+	{
+		FrameStatsLine(statsPtr, line, pixels, 4);
+	}
+	else
+	{
+		FrameStatsLine(statsPtr, line, pixels, 3);
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameStatsMerge(FrameStats *statsPtr, const FrameStats *partPtr)
+**
+**	Parameters:
+**		statsPtr - Statistics to add to
+**		partPtr - Statistics of another part of the frame
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Adds the counts of partPtr to statsPtr.
+**
+*/
+void FrameStatsMerge(FrameStats *statsPtr, const FrameStats *partPtr)
+{
+	u32 c, i;
+
+	for (c = 0; c < FRAME_STATS_CHANNELS; c++)
+	{
+		for (i = 0; i < 256; i++)
+		{
+			statsPtr->hist[c][i] += partPtr->hist[c][i];
+		}
+	}
+	statsPtr->pixels += partPtr->pixels;
+	statsPtr->clippedLow += partPtr->clippedLow;
+	statsPtr->clippedHigh += partPtr->clippedHigh;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameStatsFinish(FrameStats *statsPtr)
+**
+**	Parameters:
+**		statsPtr - Statistics with every pixel counted
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Sets min, max and mean100 of each channel from its histogram.
+**		They are all 0 if no pixel was counted.
+**
+*/
+void FrameStatsFinish(FrameStats *statsPtr)
+{
+	u64 sum;
+	u32 c, i;
+
+	for (c = 0; c < FRAME_STATS_CHANNELS; c++)
+	{
+		statsPtr->min[c] = 0;
+		statsPtr->max[c] = 0;
+		statsPtr->mean100[c] = 0;
+		if (statsPtr->pixels == 0)
+		{
+			continue;
+		}
+
+		sum = 0;
+		for (i = 0; i < 256; i++)
+		{
+			sum += (u64) statsPtr->hist[c][i] * i;
+		}
+		statsPtr->mean100[c] = (u32) ((sum * 100 + statsPtr->pixels / 2) / statsPtr->pixels);
+
+		for (i = 0; statsPtr->hist[c][i] == 0; i++)
+		{
+		}
+		statsPtr->min[c] = i;
+		for (i = 255; statsPtr->hist[c][i] == 0; i--)
+		{
+		}
+		statsPtr->max[c] = i;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameStatsPercentile(const FrameStats *statsPtr, u32 channel, u32 permille)
+**
+**	Parameters:
+**		statsPtr - Statistics with every pixel counted
+**		channel - FRAME_STATS_BLUE, _GREEN, _RED or _LUMA
+**		permille - Share of the pixels, 0 to 1000
+**
+**	Return Value: u32
+**		Lowest level that at least permille / 1000 of the pixels are at
+**		or below, 0 if no pixel was counted
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 FrameStatsPercentile(const FrameStats *statsPtr, u32 channel, u32 permille)
+{
+	u64 target = ((u64) statsPtr->pixels * permille + 999) / 1000;
+	u64 count = 0;
+	u32 i;
+
+	for (i = 0; i < 255; i++)
+	{
+		count += statsPtr->hist[channel][i];
+		if (count >= target && count > 0)
+		{
+			break;
+		}
+	}
+
+	return (statsPtr->pixels == 0) ? 0 : i;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameStatsCheck()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of failed cases, 0 if all passed
+**
+**	Errors:
+**
+**	Description:
+**		Counts a line of pixels that includes clipped ones in both
+**		formats, split in two and merged, and compares every count,
+**		minimum, maximum and mean with a plain loop. Failures are
+**		printed.
+**
+*/
+u32 FrameStatsCheck()
+{
+	u32 failures = 0;
+	u32 f, i, c, bytes, split;
+	u32 level[3];
+	u64 sum[FRAME_STATS_CHANNELS];
+	PixFmt fmt;
+
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		bytes = PixFmtBytes(fmt);
+		for (i = 0; i < sizeof(checkLine); i++)
+		{
+			checkLine[i] = (u8) (i * 53 + f * 11);
+		}
+		checkLine[0] = 0;
+		checkLine[bytes + 2] = 255;
+		checkLine[2 * bytes + 1] = 0;
+		checkLine[2 * bytes + 2] = 255;
+
+		FrameStatsReset(&checkRef);
+		memset(sum, 0, sizeof(sum));
+		for (i = 0; i < FRAME_STATS_CHECK_MAX; i++)
+		{
+			for (c = 0; c < 3; c++)
+			{
+				level[c] = checkLine[i * bytes + c];
+			}
+			checkRef.hist[FRAME_STATS_GREEN][level[PIXFMT_G]]++;
+			checkRef.hist[FRAME_STATS_BLUE][level[PIXFMT_B]]++;
+			checkRef.hist[FRAME_STATS_RED][level[PIXFMT_R]]++;
+			checkRef.hist[FRAME_STATS_LUMA][(77 * level[PIXFMT_R] + 150 * level[PIXFMT_G] + 29 * level[PIXFMT_B]) >> 8]++;
+			if (level[0] == 0 || level[1] == 0 || level[2] == 0)
+			{
+				checkRef.clippedLow++;
+			}
+			if (level[0] == 255 || level[1] == 255 || level[2] == 255)
+			{
+				checkRef.clippedHigh++;
+			}
+			for (c = 0; c < 3; c++)
+			{
+				sum[c] += level[c];
+				checkRef.min[c] = (i == 0 || level[c] < checkRef.min[c]) ? level[c] : checkRef.min[c];
+				checkRef.max[c] = (level[c] > checkRef.max[c]) ? level[c] : checkRef.max[c];
+			}
+		}
+		checkRef.pixels = FRAME_STATS_CHECK_MAX;
+		for (c = 0; c < 3; c++)
+		{
+			checkRef.mean100[c] = (u32) ((sum[c] * 100 + FRAME_STATS_CHECK_MAX / 2) / FRAME_STATS_CHECK_MAX);
+		}
+
+		split = FRAME_STATS_CHECK_MAX / 3;
+		FrameStatsReset(&checkStats);
+		FrameStatsReset(&checkPart);
+		FrameStatsAccumulate(&checkStats, checkLine, split, fmt);
+		FrameStatsAccumulate(&checkPart, checkLine + split * bytes, FRAME_STATS_CHECK_MAX - split, fmt);
+		FrameStatsMerge(&checkStats, &checkPart);
+		FrameStatsFinish(&checkStats);
+
+		/* Luma is only compared as a histogram */
+		if (memcmp(checkStats.hist, checkRef.hist, sizeof(checkRef.hist)) != 0 || checkStats.pixels != checkRef.pixels ||
+				checkStats.clippedLow != checkRef.clippedLow || checkStats.clippedHigh != checkRef.clippedHigh ||
+				memcmp(checkStats.min, checkRef.min, 3 * sizeof(u32)) != 0 || memcmp(checkStats.max, checkRef.max, 3 * sizeof(u32)) != 0 ||
+				memcmp(checkStats.mean100, checkRef.mean100, 3 * sizeof(u32)) != 0)
+		{
+			FRAME_STATS_PRINTF("FrameStatsAccumulate FAILED: %s\n\r", PixFmtName(fmt));
+			failures++;
+		}
+
+		if (FrameStatsPercentile(&checkStats, FRAME_STATS_RED, 0) != checkStats.min[FRAME_STATS_RED] ||
+				FrameStatsPercentile(&checkStats, FRAME_STATS_RED, 1000) != checkStats.max[FRAME_STATS_RED])
+		{
+			FRAME_STATS_PRINTF("FrameStatsPercentile FAILED: %s\n\r", PixFmtName(fmt));
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+#if defined(__linux__) && defined(FRAME_STATS_MAIN)
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 FrameStatsUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int main(void)
+{
+	static FrameStats stats;
+	const u32 stride = FRAME_STATS_HOST_W * 4;
+	u8 *frame;
+	u32 failures, r, i, f, step;
+	u64 start, us;
+	PixFmt fmt;
+
+	failures = FrameStatsCheck();
+	printf("Self check: %lu failure(s)\n\n", (unsigned long) failures);
+
+	if (posix_memalign((void **) &frame, 64, stride * FRAME_STATS_HOST_H) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < stride * FRAME_STATS_HOST_H; i++)
+	{
+		frame[i] = (u8) ((i * 7) ^ (i >> 11));
+	}
+
+	printf("%-24s %8s %8s\n", "Frame", "Mpix/s", "ms/frame");
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		for (step = 1; step <= 4; step *= 4)
+		{
+			start = FrameStatsUs();
+			for (r = 0; r < FRAME_STATS_HOST_REPS; r++)
+			{
+				FrameStatsReset(&stats);
+				for (i = 0; i < FRAME_STATS_HOST_H; i += step)
+				{
+					FrameStatsAccumulate(&stats, frame + i * stride, FRAME_STATS_HOST_W, fmt);
+				}
+				FrameStatsFinish(&stats);
+			}
+			us = FrameStatsUs() - start;
+			printf("%-8s every %lu line(s)  %8.1f %8.2f\n", PixFmtName(fmt), (unsigned long) step,
+					(double) FRAME_STATS_HOST_W * FRAME_STATS_HOST_H * FRAME_STATS_HOST_REPS / us, us / 1000.0 / FRAME_STATS_HOST_REPS);
+		}
+	}
+	printf("\nLuma of the last run: min %lu, max %lu, mean %lu.%02lu, 1%%/99%% %lu/%lu\n",
+			(unsigned long) stats.min[FRAME_STATS_LUMA], (unsigned long) stats.max[FRAME_STATS_LUMA],
+			(unsigned long) stats.mean100[FRAME_STATS_LUMA] / 100, (unsigned long) stats.mean100[FRAME_STATS_LUMA] % 100,
+			(unsigned long) FrameStatsPercentile(&stats, FRAME_STATS_LUMA, 10), (unsigned long) FrameStatsPercentile(&stats, FRAME_STATS_LUMA, 990));
+
+	free(frame);
+
+	return failures ? 1 : 0;
+}
+#endif
+
+/************************************************************************/
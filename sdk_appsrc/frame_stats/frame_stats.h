@@ -0,0 +1,95 @@
+/************************************************************************/
+/*																		*/
+/*	frame_stats.h	--	Histograms and statistics of frames				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Collects blue, green, red and luma histograms of a frame in		*/
+/*		one pass, along with the number of pixels clipped to black		*/
+/*		or white in any channel. Minimum, maximum, mean and				*/
+/*		percentiles are read off the histograms afterwards, so the		*/
+/*		pass does four increments and two compares per pixel and		*/
+/*		nothing else. Luma is BT.601, (77 R + 150 G + 29 B) >> 8.		*/
+/*																		*/
+/*		Callers splitting a frame between cores give each core its		*/
+/*		own FrameStats, reset with FrameStatsReset, and add them up		*/
+/*		with FrameStatsMerge before FrameStatsFinish. Nothing is		*/
+/*		shared while the frame is being read.							*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) FrameStatsReset each FrameStats.								*/
+/*		2) FrameStatsAccumulate each line, or each sampled line.		*/
+/*		3) FrameStatsMerge the partial results into one.				*/
+/*		4) FrameStatsFinish it, then read min, max and mean100, or		*/
+/*		   call FrameStatsPercentile.									*/
+/*																		*/
+/*		With FRAME_STATS_MAIN defined on Linux the module builds as		*/
+/*		a stand-alone host program that checks it against a plain		*/
+/*		loop and times it over one 1920x1080 frame:						*/
+/*			gcc -O2 -DFRAME_STATS_MAIN -I<bsp>/include -I.				*/
+/*				frame_stats/frame_stats.c pixfmt/pixfmt.c blit/blit.c	*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_mem.c				*/
+/*				-o frame_stats											*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Channels in the G, B, R order of pixfmt.h			*/
+/*																		*/
+/************************************************************************/
+
+#ifndef FRAME_STATS_H_
+#define FRAME_STATS_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../pixfmt/pixfmt.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Histograms, in the byte order of a pixel, then luma
+ */
+#define FRAME_STATS_GREEN PIXFMT_G
+#define FRAME_STATS_BLUE PIXFMT_B
+#define FRAME_STATS_RED PIXFMT_R
+#define FRAME_STATS_LUMA 3
+#define FRAME_STATS_CHANNELS 4
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u32 hist[FRAME_STATS_CHANNELS][256];
+		u32 pixels; /* Pixels counted */
+		u32 clippedLow; /* Pixels with a channel at 0 */
+		u32 clippedHigh; /* Pixels with a channel at 255 */
+		u32 min[FRAME_STATS_CHANNELS]; /* Set by FrameStatsFinish */
+		u32 max[FRAME_STATS_CHANNELS];
+		u32 mean100[FRAME_STATS_CHANNELS]; /* Mean times 100 */
+} FrameStats;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void FrameStatsReset(FrameStats *statsPtr);
+void FrameStatsAccumulate(FrameStats *statsPtr, const u8 *line, u32 pixels, PixFmt fmt);
+void FrameStatsMerge(FrameStats *statsPtr, const FrameStats *partPtr);
+void FrameStatsFinish(FrameStats *statsPtr);
+u32 FrameStatsPercentile(const FrameStats *statsPtr, u32 channel, u32 permille);
+u32 FrameStatsCheck();
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* FRAME_STATS_H_ */
@@ -0,0 +1,74 @@
+/************************************************************************/
+/*																		*/
+/*	golden.h	--	Framebuffer comparison and PPM export				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Helpers for checking a faster version of a framebuffer kernel	*/
+/*		against its reference version. GoldenCompare compares two		*/
+/*		frames, exactly or within a per channel tolerance.				*/
+/*		GoldenWritePpm and GoldenWriteDiffPpm write a frame, or a		*/
+/*		heatmap of the differences between two frames, as a binary PPM	*/
+/*		image into memory. There is no file system, so the image is		*/
+/*		read out over JTAG, for example with							*/
+/*		"mrd -bin -file out.ppm <address> <size in words>" in xsct.		*/
+/*																		*/
+/*		Frames are 24 bits per pixel in the framebuffer byte order		*/
+/*		(green, blue, red), see pixfmt.h. PPM files are written red,	*/
+/*		green, blue.													*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Channels read in the G, B, R order of pixfmt.h		*/
+/*																		*/
+/************************************************************************/
+
+#ifndef GOLDEN_H_
+#define GOLDEN_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Room reserved for the PPM header
+ */
+#define GOLDEN_PPM_HEADER_MAX 32
+
+/*
+ * Size of the buffer needed for a width x height PPM image
+ */
+#define GOLDEN_PPM_SIZE(width, height) (GOLDEN_PPM_HEADER_MAX + (width) * (height) * 3)
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u32 mismatches; /* Pixels with a channel outside the tolerance */
+		u32 maxDiff; /* Largest channel difference seen */
+		u32 firstX, firstY; /* First mismatching pixel, valid if mismatches != 0 */
+} GoldenStats;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int GoldenCompare(const u8 *refFrame, const u8 *testFrame, u32 width, u32 height, u32 stride, u32 tolerance, GoldenStats *statsPtr);
+u32 GoldenWritePpm(u8 *ppm, const u8 *frame, u32 width, u32 height, u32 stride);
+u32 GoldenWriteDiffPpm(u8 *ppm, const u8 *refFrame, const u8 *testFrame, u32 width, u32 height, u32 stride);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* GOLDEN_H_ */
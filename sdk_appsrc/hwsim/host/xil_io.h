@@ -0,0 +1,65 @@
+/************************************************************************/
+/*																		*/
+/*	xil_io.h	--	Host stand-in for the BSP register access header	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Routes the register accesses of the Xilinx drivers and of		*/
+/*		display_ctrl, video_capture and dynclk to the model in hwsim	*/
+/*		for host builds. It uses the include guard of the BSP			*/
+/*		xil_io.h, so force-including it with -include makes every		*/
+/*		later include of the BSP header a no-op, wherever it is			*/
+/*		included from. Only for Linux builds; see hwsim.h.				*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include <stdio.h>
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Driver messages go to stdout
+ */
+#define xil_printf printf
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+u32 HwSimRead32(UINTPTR addr);
+void HwSimWrite32(UINTPTR addr, u32 value);
+
+#define INLINE inline
+
+static INLINE u32 Xil_In32(UINTPTR Addr)
+{
+	return HwSimRead32(Addr);
+}
+
+static INLINE void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	HwSimWrite32(Addr, Value);
+}
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* XIL_IO_H */
@@ -0,0 +1,1285 @@
+/************************************************************************/
+/*																		*/
+/*	hwsim.c	--	Register level model of the video IP for host testing	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Software model of the AXI VDMA, VTC, axi_dynclk and video GPIO	*/
+/*		register maps. See hwsim.h for how a host build uses it.		*/
+/*		Only built for Linux; on the Zynq this file is empty.			*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added the HWSIM_MAIN host program					*/
+/*																		*/
+/************************************************************************/
+
+#ifdef __linux__
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "hwsim.h"
+#include "xaxivdma_hw.h"
+#include "xvtc_hw.h"
+#include "xgpio_l.h"
+#include "../dynclk/dynclk.h"
+#include <stddef.h>
+#include <string.h>
+#ifdef HWSIM_MAIN
+ #include "../display_ctrl/display_ctrl.h"
+ #include "../video_capture/video_capture.h"
+ #include <stdio.h>
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Local Type Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Size of each register map, in 32-bit words
+ */
+#define SIM_VDMA_REGS (0x100 / 4)
+#define SIM_VTC_REGS ((XVTC_GGD_OFFSET / 4) + 1)
+#define SIM_DYNCLK_REGS ((OFST_DYNCLK_FLTR_LOCK_H / 4) + 1)
+#define SIM_GPIO_REGS ((XGPIO_IER_OFFSET / 4) + 1)
+
+#define SIM_VTC_IN 0
+#define SIM_VTC_OUT 1
+
+#define SIM_NUM_IRQS 5
+
+/*
+ * Time the MMCM in the dynclk core takes to lock after ClkStart
+ */
+#define SIM_CLK_LOCK_NS 20000
+
+/*
+ * Handler calls made for one delivery before giving up on a line that its
+ * handler never clears. The line stays asserted and is retried after the
+ * next access.
+ */
+#define SIM_IRQ_STORM 64
+
+#define SIM_VDMA_VERSION 0x62000000
+#define SIM_VTC_VERSION 0x07020000
+
+#ifdef HWSIM_MAIN
+/*
+ * Framebuffers handed to the drivers by the host program. The model moves
+ * no pixels, so these addresses are only written to the VDMA.
+ */
+#define HWSIM_HOST_FRAME_BASE 0x10000000
+#define HWSIM_HOST_STRIDE (1920 * 3)
+#define HWSIM_HOST_FRAME_SIZE (1920 * 1080 * 3)
+
+/*
+ * Output frames the host program lets pass per mode, how far the pixel
+ * clock may be from the one dynclk settled on, and the longest it waits
+ * for the input to lock
+ */
+#define HWSIM_HOST_FRAMES 30
+#define HWSIM_HOST_CLK_TOL 0.001
+#define HWSIM_HOST_LOCK_US 200000
+#endif
+
+typedef struct {
+		UINTPTR chanBase; /* Offset of CR/SR */
+		UINTPTR addrBase; /* Offset of VSIZE/HSIZE/STRIDE/START_ADDR */
+		u32 parkRefMask; /* Park pointer field selecting the parked frame */
+		u32 parkRefShift;
+		u32 parkStrShift; /* Park pointer field reporting the current frame */
+		u32 curFrame;
+		u32 frmCnt; /* Frames left until the frame count interrupt */
+		int fActive; /* A frame is being transferred */
+		u32 frames; /* Frames completed since HwSimReset */
+		HwSimFrameHook hook;
+		void *hookRef;
+} SimVdmaChan;
+
+typedef struct {
+		HwSimHandler fn;
+		void *ref;
+} SimIrq;
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static u64 simNow;
+
+static u32 vdmaRegs[SIM_VDMA_REGS];
+static SimVdmaChan vdmaChan[2] = {
+	{XAXIVDMA_TX_OFFSET, XAXIVDMA_MM2S_ADDR_OFFSET, XAXIVDMA_PARKPTR_READREF_MASK, 0, 16, 0, 1, 0, 0, NULL, NULL},
+	{XAXIVDMA_RX_OFFSET, XAXIVDMA_S2MM_ADDR_OFFSET, XAXIVDMA_PARKPTR_WRTREF_MASK, 8, 24, 0, 1, 0, 0, NULL, NULL}
+};
+
+static const UINTPTR vtcBase[2] = {HWSIM_VTC_IN_BASEADDR, HWSIM_VTC_OUT_BASEADDR};
+static u32 vtcRegs[2][SIM_VTC_REGS];
+
+static u32 dynclkRegs[SIM_DYNCLK_REGS];
+static int fClkRunning;
+static u64 clkLockAt; /* Time the clock starts running, 0 if not starting */
+
+static u32 gpioRegs[SIM_GPIO_REGS];
+
+static HwSimSource source;
+static int fLocked;
+static u32 lockFrames;
+
+static u64 nextOutFrame; /* 0 while the output is not running */
+static u64 nextInFrame; /* 0 while there is no source */
+
+/*
+ * Interrupt lines in order of delivery, which follows the priorities the
+ * applications give them in the GIC
+ */
+static const u32 irqIds[SIM_NUM_IRQS] = {
+	HWSIM_IRQ_VTC_OUT,
+	HWSIM_IRQ_GPIO,
+	HWSIM_IRQ_VTC_IN,
+	HWSIM_IRQ_VDMA_MM2S,
+	HWSIM_IRQ_VDMA_S2MM
+};
+static SimIrq irqs[SIM_NUM_IRQS];
+static int fIrqEnable;
+static int fInIrq;
+
+#ifdef HWSIM_MAIN
+static XAxiVdma hostVdma;
+static DisplayCtrl hostDisp;
+static VideoCapture hostVideo;
+static INTC hostIntc;
+static u32 hostVideoCallbacks;
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Forward Declarations							*/
+/* ------------------------------------------------------------ */
+
+static void SimAdvance(u64 ns);
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Divide value of an MMCM counter as encoded by ClkDivider
+ */
+static u32 SimClkDivide(u32 reg)
+{
+	if (reg & (1 << CLK_BIT_NOCOUNT))
+	{
+		return 1;
+	}
+	return ((reg >> 6) & 0x3F) + (reg & 0x3F);
+}
+
+/***	HwSimGetPixelClock()
+**
+**	Return Value: double
+**		Pixel clock programmed into the dynclk core, in Hz. Assumes the
+**		same 100 MHz reference and divide-by-5 BUFR as ClkFindParams.
+**
+*/
+double HwSimGetPixelClock(void)
+{
+	u32 clk0, fb, mainDiv;
+
+	/*
+	 * ClkCountCalc moves the top two bits of the ClkDivider value up by 10
+	 */
+	clk0 = dynclkRegs[OFST_DYNCLK_CLK_L / 4];
+	clk0 = SimClkDivide((clk0 & 0xFFF) | ((clk0 >> 10) & 0x3000));
+	fb = dynclkRegs[OFST_DYNCLK_FB_L / 4];
+	fb = SimClkDivide((fb & 0xFFF) | ((fb >> 10) & 0x3000));
+	mainDiv = SimClkDivide(dynclkRegs[OFST_DYNCLK_DIV / 4]);
+
+	if (clk0 == 0 || fb == 0 || mainDiv == 0)
+	{
+		return 0.0;
+	}
+	return (100.0e6 * (double) fb) / ((double) mainDiv * (double) clk0) / 5.0;
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Length of an output frame in ns, or 0 if the output is not running
+ */
+static u64 SimOutFramePeriod(void)
+{
+	u32 *regs = vtcRegs[SIM_VTC_OUT];
+	u32 hTotal, vTotal;
+	double pixClk;
+
+	if (!fClkRunning || !(regs[XVTC_CTL_OFFSET / 4] & XVTC_CTL_GE_MASK))
+	{
+		return 0;
+	}
+
+	hTotal = regs[XVTC_GHSIZE_OFFSET / 4] & 0x1FFF;
+	vTotal = regs[XVTC_GVSIZE_OFFSET / 4] & XVTC_VSIZE_F0_MASK;
+	pixClk = HwSimGetPixelClock();
+	if (hTotal == 0 || vTotal == 0 || pixClk == 0.0)
+	{
+		return 0;
+	}
+
+	return (u64) (((double) hTotal * (double) vTotal * 1.0e9) / pixClk);
+}
+
+/*
+ * Starts or stops the output frame timer after a change to the generator or
+ * the pixel clock. A running output keeps its current frame boundary.
+ */
+static void SimUpdateOutput(void)
+{
+	u64 period = SimOutFramePeriod();
+
+	if (period == 0)
+	{
+		nextOutFrame = 0;
+	}
+	else if (nextOutFrame == 0)
+	{
+		nextOutFrame = simNow + period;
+	}
+}
+
+static void SimVdmaReset(void)
+{
+	int i;
+
+	memset(vdmaRegs, 0, sizeof(vdmaRegs));
+	vdmaRegs[XAXIVDMA_VERSION_OFFSET / 4] = SIM_VDMA_VERSION;
+	for (i = 0; i < 2; i++)
+	{
+		vdmaRegs[(vdmaChan[i].chanBase + XAXIVDMA_SR_OFFSET) / 4] = XAXIVDMA_SR_HALTED_MASK | XAXIVDMA_SR_IDLE_MASK;
+		vdmaRegs[(vdmaChan[i].chanBase + XAXIVDMA_FRMSTORE_OFFSET) / 4] = HWSIM_VDMA_FRAMES;
+		vdmaChan[i].curFrame = 0;
+		vdmaChan[i].frmCnt = 1;
+		vdmaChan[i].fActive = 0;
+	}
+}
+
+static void SimVtcReset(int vtc)
+{
+	memset(vtcRegs[vtc], 0, sizeof(vtcRegs[vtc]));
+	vtcRegs[vtc][XVTC_VER_OFFSET / 4] = SIM_VTC_VERSION;
+}
+
+/***	HwSimReset()
+**
+**	Return Value:
+**
+**	Description:
+**		Puts every core in its reset state, removes the source, clears
+**		the clock, frame hooks and interrupt connections and disables
+**		interrupt delivery.
+**
+*/
+void HwSimReset(void)
+{
+	int i;
+
+	simNow = 0;
+	SimVdmaReset();
+	for (i = 0; i < 2; i++)
+	{
+		vdmaChan[i].frames = 0;
+		vdmaChan[i].hook = NULL;
+		SimVtcReset(i);
+	}
+	memset(dynclkRegs, 0, sizeof(dynclkRegs));
+	fClkRunning = 0;
+	clkLockAt = 0;
+	memset(gpioRegs, 0, sizeof(gpioRegs));
+	fLocked = 0;
+	lockFrames = 0;
+	nextOutFrame = 0;
+	nextInFrame = 0;
+	memset(irqs, 0, sizeof(irqs));
+	fIrqEnable = 0;
+	fInIrq = 0;
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Level of interrupt line i (index into irqIds)
+ */
+static int SimIrqLevel(int i)
+{
+	u32 *regs;
+	u32 cr, sr;
+
+	switch (irqIds[i])
+	{
+	case HWSIM_IRQ_VTC_OUT:
+	case HWSIM_IRQ_VTC_IN:
+		regs = vtcRegs[(irqIds[i] == HWSIM_IRQ_VTC_OUT) ? SIM_VTC_OUT : SIM_VTC_IN];
+		return (regs[XVTC_ISR_OFFSET / 4] & regs[XVTC_IER_OFFSET / 4]) != 0;
+	case HWSIM_IRQ_GPIO:
+		return (gpioRegs[XGPIO_GIE_OFFSET / 4] & XGPIO_GIE_GINTR_ENABLE_MASK) &&
+				(gpioRegs[XGPIO_ISR_OFFSET / 4] & gpioRegs[XGPIO_IER_OFFSET / 4]);
+	default:
+		regs = &vdmaRegs[vdmaChan[(irqIds[i] == HWSIM_IRQ_VDMA_MM2S) ? HWSIM_MM2S : HWSIM_S2MM].chanBase / 4];
+		cr = regs[XAXIVDMA_CR_OFFSET / 4];
+		sr = regs[XAXIVDMA_SR_OFFSET / 4];
+		return (cr & sr & XAXIVDMA_IXR_ALL_MASK) != 0;
+	}
+}
+
+static void SimDeliverIrqs(void)
+{
+	int i, n;
+
+	if (!fIrqEnable || fInIrq)
+	{
+		return;
+	}
+
+	fInIrq = 1;
+	for (n = 0; n < SIM_IRQ_STORM; n++)
+	{
+		for (i = 0; i < SIM_NUM_IRQS; i++)
+		{
+			if (irqs[i].fn != NULL && SimIrqLevel(i))
+			{
+				break;
+			}
+		}
+		if (i == SIM_NUM_IRQS)
+		{
+			break;
+		}
+		irqs[i].fn(irqs[i].ref);
+	}
+	fInIrq = 0;
+}
+
+/*
+ * Called at the end of every frame a VDMA channel transfers. Reports the
+ * frame, runs the frame counter and picks the next frame store the same way
+ * the core does in park, circular and genlock mode.
+ */
+static void SimVdmaFrame(int chan)
+{
+	SimVdmaChan *chPtr = &vdmaChan[chan];
+	u32 *cr = &vdmaRegs[(chPtr->chanBase + XAXIVDMA_CR_OFFSET) / 4];
+	u32 *sr = &vdmaRegs[(chPtr->chanBase + XAXIVDMA_SR_OFFSET) / 4];
+	u32 *park = &vdmaRegs[XAXIVDMA_PARKPTR_OFFSET / 4];
+	u32 numFrames, frmDly, count;
+	UINTPTR addr;
+
+	if (!chPtr->fActive)
+	{
+		return;
+	}
+
+	chPtr->frames++;
+	if (chPtr->hook != NULL)
+	{
+		addr = vdmaRegs[(chPtr->addrBase + XAXIVDMA_START_ADDR_OFFSET + chPtr->curFrame * XAXIVDMA_START_ADDR_LEN) / 4];
+		chPtr->hook(chPtr->hookRef, chPtr->curFrame, addr);
+	}
+
+	if (--chPtr->frmCnt == 0)
+	{
+		*sr |= XAXIVDMA_IXR_FRMCNT_MASK;
+		count = (*cr & XAXIVDMA_FRMCNT_MASK) >> XAXIVDMA_FRMCNT_SHIFT;
+		chPtr->frmCnt = (count == 0) ? 1 : count;
+		if (*cr & XAXIVDMA_CR_FRMCNT_EN_MASK)
+		{
+			*cr &= ~XAXIVDMA_CR_RUNSTOP_MASK;
+			chPtr->fActive = 0;
+			*sr |= XAXIVDMA_SR_HALTED_MASK | XAXIVDMA_SR_IDLE_MASK;
+		}
+	}
+	*sr = (*sr & ~XAXIVDMA_FRMCNT_MASK) | (chPtr->frmCnt << XAXIVDMA_FRMCNT_SHIFT);
+
+	numFrames = vdmaRegs[(chPtr->chanBase + XAXIVDMA_FRMSTORE_OFFSET) / 4] & XAXIVDMA_FRMSTORE_MASK;
+	if (numFrames == 0)
+	{
+		numFrames = 1;
+	}
+
+	if (!(*cr & XAXIVDMA_CR_TAIL_EN_MASK))
+	{
+		/*
+		 * Parked: stay on the frame selected in the park pointer register
+		 */
+		chPtr->curFrame = ((*park & chPtr->parkRefMask) >> chPtr->parkRefShift) % numFrames;
+	}
+	else if (chan == HWSIM_MM2S && (*cr & XAXIVDMA_CR_SYNC_EN_MASK))
+	{
+		/*
+		 * Genlock slave: follow the S2MM channel, frame delay frames behind
+		 */
+		frmDly = (vdmaRegs[(chPtr->addrBase + XAXIVDMA_STRD_FRMDLY_OFFSET) / 4] & XAXIVDMA_FRMDLY_MASK) >> XAXIVDMA_FRMDLY_SHIFT;
+		chPtr->curFrame = (vdmaChan[HWSIM_S2MM].curFrame + numFrames - (frmDly % numFrames)) % numFrames;
+	}
+	else
+	{
+		chPtr->curFrame = (chPtr->curFrame + 1) % numFrames;
+		/*
+		 * Genlock master: never write the frame being read
+		 */
+		if (chan == HWSIM_S2MM && (*cr & XAXIVDMA_CR_SYNC_EN_MASK) && numFrames > 1 &&
+				chPtr->curFrame == vdmaChan[HWSIM_MM2S].curFrame)
+		{
+			chPtr->curFrame = (chPtr->curFrame + 1) % numFrames;
+		}
+	}
+	*park = (*park & ~(0x1F << chPtr->parkStrShift)) | (chPtr->curFrame << chPtr->parkStrShift);
+}
+
+static void SimOutFrame(void)
+{
+	vtcRegs[SIM_VTC_OUT][XVTC_ISR_OFFSET / 4] |= XVTC_IXR_G_VBLANK_MASK | XVTC_IXR_G_AV_MASK;
+	SimVdmaFrame(HWSIM_MM2S);
+}
+
+static void SimSetLocked(int fNewLocked)
+{
+	u32 *regs = vtcRegs[SIM_VTC_IN];
+
+	if (fNewLocked == fLocked)
+	{
+		return;
+	}
+
+	fLocked = fNewLocked;
+	lockFrames = 0;
+	gpioRegs[XGPIO_DATA2_OFFSET / 4] = fLocked ? 1 : 0;
+	gpioRegs[XGPIO_ISR_OFFSET / 4] |= XGPIO_IR_CH2_MASK;
+
+	if (!fLocked && (regs[XVTC_DTSTAT_OFFSET / 4] & XVTC_STAT_LOCKED_MASK))
+	{
+		regs[XVTC_DTSTAT_OFFSET / 4] = 0;
+		regs[XVTC_ISR_OFFSET / 4] |= XVTC_IXR_LOL_MASK;
+	}
+}
+
+/*
+ * Checks the frame the source delivers against the S2MM frame size and
+ * flags the errors the core reports for a mismatch
+ */
+static void SimS2mmCheckSize(void)
+{
+	u32 *sr = &vdmaRegs[(XAXIVDMA_RX_OFFSET + XAXIVDMA_SR_OFFSET) / 4];
+	u32 vSize = vdmaRegs[(XAXIVDMA_S2MM_ADDR_OFFSET + XAXIVDMA_VSIZE_OFFSET) / 4] & XAXIVDMA_VSIZE_MASK;
+	u32 hSize = vdmaRegs[(XAXIVDMA_S2MM_ADDR_OFFSET + XAXIVDMA_HSIZE_OFFSET) / 4] & XAXIVDMA_HSIZE_MASK;
+	u32 err = 0;
+
+	if (source.height < vSize)
+	{
+		err |= XAXIVDMA_SR_ERR_FSZ_LESS_MASK;
+	}
+	else if (source.height > vSize)
+	{
+		err |= XAXIVDMA_SR_ERR_FSZ_MORE_MASK;
+	}
+	if (source.width * 3 < hSize)
+	{
+		err |= XAXIVDMA_SR_ERR_LSZ_LESS_MASK;
+	}
+
+	if (err)
+	{
+		*sr |= err | XAXIVDMA_IXR_ERROR_MASK;
+	}
+}
+
+static void SimInFrame(void)
+{
+	u32 *regs = vtcRegs[SIM_VTC_IN];
+
+	if (!fLocked)
+	{
+		/*
+		 * The TMDS receiver only locks while HPD is asserted
+		 */
+		if ((gpioRegs[XGPIO_DATA_OFFSET / 4] & 1) && ++lockFrames >= HWSIM_LOCK_FRAMES)
+		{
+			SimSetLocked(1);
+		}
+		return;
+	}
+
+	if (regs[XVTC_CTL_OFFSET / 4] & XVTC_CTL_DE_MASK)
+	{
+		if (!(regs[XVTC_DTSTAT_OFFSET / 4] & XVTC_STAT_LOCKED_MASK))
+		{
+			regs[XVTC_DASIZE_OFFSET / 4] = (source.width & XVTC_ASIZE_HORI_MASK) |
+					((source.height << XVTC_ASIZE_VERT_SHIFT) & XVTC_ASIZE_VERT_MASK);
+			regs[XVTC_DHSIZE_OFFSET / 4] = source.hTotal & 0x1FFF;
+			regs[XVTC_DVSIZE_OFFSET / 4] = source.vTotal & XVTC_VSIZE_F0_MASK;
+			regs[XVTC_DTSTAT_OFFSET / 4] = XVTC_STAT_LOCKED_MASK | XVTC_STAT_VBLANK_MASK | XVTC_STAT_AVIDEO_MASK;
+			regs[XVTC_ISR_OFFSET / 4] |= XVTC_IXR_LO_MASK;
+		}
+		regs[XVTC_ISR_OFFSET / 4] |= XVTC_IXR_D_VBLANK_MASK | XVTC_IXR_D_AV_MASK;
+	}
+
+	if (vdmaChan[HWSIM_S2MM].fActive)
+	{
+		SimS2mmCheckSize();
+	}
+	SimVdmaFrame(HWSIM_S2MM);
+}
+
+/*
+ * Moves simulated time forward, running every clock, output frame and input
+ * frame event that falls inside the interval in time order and delivering
+ * the interrupts each one raises
+ */
+static void SimAdvance(u64 ns)
+{
+	u64 target = simNow + ns;
+	u64 next;
+	u64 period;
+
+	for (;;)
+	{
+		next = target;
+		if (clkLockAt != 0 && clkLockAt < next)
+		{
+			next = clkLockAt;
+		}
+		if (nextOutFrame != 0 && nextOutFrame < next)
+		{
+			next = nextOutFrame;
+		}
+		if (nextInFrame != 0 && nextInFrame < next)
+		{
+			next = nextInFrame;
+		}
+		if (next == target)
+		{
+			break;
+		}
+
+		simNow = next;
+		if (next == clkLockAt)
+		{
+			clkLockAt = 0;
+			fClkRunning = 1;
+			SimUpdateOutput();
+		}
+		else if (next == nextOutFrame)
+		{
+			period = SimOutFramePeriod();
+			nextOutFrame = (period == 0) ? 0 : nextOutFrame + period;
+			SimOutFrame();
+		}
+		else
+		{
+			nextInFrame += source.framePeriodNs;
+			SimInFrame();
+		}
+
+		/*
+		 * Handlers access registers and so advance time themselves,
+		 * possibly past target
+		 */
+		SimDeliverIrqs();
+	}
+	if (simNow < target)
+	{
+		simNow = target;
+	}
+
+	SimDeliverIrqs();
+}
+
+/***	HwSimStep(u32 us)
+**
+**	Parameters:
+**		us - Number of microseconds to let pass
+**
+**	Return Value:
+**
+**	Description:
+**		Advances simulated time, for example to let a number of frames
+**		pass, and delivers any interrupts raised on the way.
+**
+*/
+void HwSimStep(u32 us)
+{
+	SimAdvance((u64) us * 1000);
+}
+/* ------------------------------------------------------------ */
+
+/***	HwSimNow()
+**
+**	Return Value: u64
+**		Simulated time since HwSimReset, in ns
+**
+*/
+u64 HwSimNow(void)
+{
+	return simNow;
+}
+/* ------------------------------------------------------------ */
+
+static u32 *SimRegPtr(UINTPTR addr)
+{
+	UINTPTR ofst;
+
+	if (addr & 0x3)
+	{
+		return NULL;
+	}
+
+	if (addr >= HWSIM_VDMA_BASEADDR && addr < HWSIM_VDMA_BASEADDR + SIM_VDMA_REGS * 4)
+	{
+		return &vdmaRegs[(addr - HWSIM_VDMA_BASEADDR) / 4];
+	}
+	if (addr >= HWSIM_DYNCLK_BASEADDR && addr < HWSIM_DYNCLK_BASEADDR + SIM_DYNCLK_REGS * 4)
+	{
+		return &dynclkRegs[(addr - HWSIM_DYNCLK_BASEADDR) / 4];
+	}
+	if (addr >= HWSIM_GPIO_BASEADDR && addr < HWSIM_GPIO_BASEADDR + SIM_GPIO_REGS * 4)
+	{
+		return &gpioRegs[(addr - HWSIM_GPIO_BASEADDR) / 4];
+	}
+	for (ofst = 0; ofst < 2; ofst++)
+	{
+		if (addr >= vtcBase[ofst] && addr < vtcBase[ofst] + SIM_VTC_REGS * 4)
+		{
+			return &vtcRegs[ofst][(addr - vtcBase[ofst]) / 4];
+		}
+	}
+
+	return NULL;
+}
+
+/***	HwSimRead32(UINTPTR addr)
+**
+**	Parameters:
+**		addr - Physical address of the register
+**
+**	Return Value: u32
+**		Register value, 0 for addresses outside the modeled cores
+**
+*/
+u32 HwSimRead32(UINTPTR addr)
+{
+	u32 *reg = SimRegPtr(addr);
+	u32 value;
+
+	value = (reg != NULL) ? *reg : 0;
+	if (reg == &dynclkRegs[OFST_DYNCLK_STATUS / 4])
+	{
+		value = fClkRunning ? (1 << BIT_DYNCLK_RUNNING) : 0;
+	}
+
+	SimAdvance(HWSIM_ACCESS_NS);
+	return value;
+}
+/* ------------------------------------------------------------ */
+
+static void SimVdmaWrite(UINTPTR ofst, u32 value)
+{
+	SimVdmaChan *chPtr;
+	u32 *cr, *sr;
+	u32 old;
+	int chan;
+
+	if (ofst == XAXIVDMA_PARKPTR_OFFSET)
+	{
+		old = vdmaRegs[ofst / 4];
+		vdmaRegs[ofst / 4] = (old & (XAXIVDMA_PARKPTR_READSTR_MASK | XAXIVDMA_PARKPTR_WRTSTR_MASK)) |
+				(value & (XAXIVDMA_PARKPTR_READREF_MASK | XAXIVDMA_PARKPTR_WRTREF_MASK));
+		return;
+	}
+	if (ofst == XAXIVDMA_VERSION_OFFSET)
+	{
+		return;
+	}
+
+	for (chan = 0; chan < 2; chan++)
+	{
+		chPtr = &vdmaChan[chan];
+		cr = &vdmaRegs[(chPtr->chanBase + XAXIVDMA_CR_OFFSET) / 4];
+		sr = &vdmaRegs[(chPtr->chanBase + XAXIVDMA_SR_OFFSET) / 4];
+
+		if (ofst == chPtr->chanBase + XAXIVDMA_CR_OFFSET)
+		{
+			if (value & XAXIVDMA_CR_RESET_MASK)
+			{
+				/*
+				 * A soft reset on either channel resets the whole core and
+				 * completes before the next access
+				 */
+				SimVdmaReset();
+				return;
+			}
+
+			old = *cr;
+			*cr = value;
+			if ((value & XAXIVDMA_FRMCNT_MASK) != (old & XAXIVDMA_FRMCNT_MASK))
+			{
+				chPtr->frmCnt = (value & XAXIVDMA_FRMCNT_MASK) >> XAXIVDMA_FRMCNT_SHIFT;
+				if (chPtr->frmCnt == 0)
+				{
+					chPtr->frmCnt = 1;
+				}
+			}
+			if ((value & XAXIVDMA_CR_RUNSTOP_MASK) && !(old & XAXIVDMA_CR_RUNSTOP_MASK))
+			{
+				*sr &= ~XAXIVDMA_SR_HALTED_MASK;
+			}
+			else if (!(value & XAXIVDMA_CR_RUNSTOP_MASK))
+			{
+				/*
+				 * The core halts once the AXI bursts in flight complete,
+				 * which is well under one register access; the frame in
+				 * progress is dropped
+				 */
+				chPtr->fActive = 0;
+				*sr |= XAXIVDMA_SR_HALTED_MASK | XAXIVDMA_SR_IDLE_MASK;
+			}
+			return;
+		}
+
+		if (ofst == chPtr->chanBase + XAXIVDMA_SR_OFFSET)
+		{
+			*sr &= ~(value & (XAXIVDMA_IXR_ALL_MASK | XAXIVDMA_SR_ERR_ALL_MASK));
+			return;
+		}
+
+		if (ofst == chPtr->addrBase + XAXIVDMA_VSIZE_OFFSET)
+		{
+			/*
+			 * Writing VSIZE starts the transfers of a running channel
+			 */
+			vdmaRegs[ofst / 4] = value;
+			if (*cr & XAXIVDMA_CR_RUNSTOP_MASK)
+			{
+				chPtr->fActive = 1;
+				*sr &= ~XAXIVDMA_SR_IDLE_MASK;
+			}
+			return;
+		}
+	}
+
+	vdmaRegs[ofst / 4] = value;
+}
+
+static void SimVtcWrite(int vtc, UINTPTR ofst, u32 value)
+{
+	u32 *regs = vtcRegs[vtc];
+
+	switch (ofst)
+	{
+	case XVTC_CTL_OFFSET:
+		if (value & XVTC_CTL_RESET_MASK)
+		{
+			SimVtcReset(vtc);
+			break;
+		}
+		regs[ofst / 4] = value;
+		if (!(value & XVTC_CTL_DE_MASK))
+		{
+			regs[XVTC_DTSTAT_OFFSET / 4] = 0;
+		}
+		break;
+	case XVTC_ISR_OFFSET:
+		regs[ofst / 4] &= ~value;
+		break;
+	case XVTC_VER_OFFSET:
+	case XVTC_DASIZE_OFFSET:
+	case XVTC_DTSTAT_OFFSET:
+	case XVTC_DHSIZE_OFFSET:
+	case XVTC_DVSIZE_OFFSET:
+		break;
+	default:
+		regs[ofst / 4] = value;
+		break;
+	}
+
+	if (vtc == SIM_VTC_OUT)
+	{
+		SimUpdateOutput();
+	}
+}
+
+static void SimDynclkWrite(UINTPTR ofst, u32 value)
+{
+	if (ofst == OFST_DYNCLK_STATUS)
+	{
+		return;
+	}
+
+	dynclkRegs[ofst / 4] = value;
+	if (ofst != OFST_DYNCLK_CTRL)
+	{
+		return;
+	}
+
+	if (value & (1 << BIT_DYNCLK_START))
+	{
+		if (!fClkRunning && clkLockAt == 0)
+		{
+			clkLockAt = simNow + SIM_CLK_LOCK_NS;
+		}
+	}
+	else
+	{
+		fClkRunning = 0;
+		clkLockAt = 0;
+		SimUpdateOutput();
+	}
+}
+
+static void SimGpioWrite(UINTPTR ofst, u32 value)
+{
+	switch (ofst)
+	{
+	case XGPIO_DATA_OFFSET:
+		gpioRegs[ofst / 4] = value;
+		if (!(value & 1))
+		{
+			/*
+			 * Dropping HPD makes the source stop sending
+			 */
+			SimSetLocked(0);
+			lockFrames = 0;
+		}
+		break;
+	case XGPIO_DATA2_OFFSET:
+		break;
+	case XGPIO_ISR_OFFSET:
+		gpioRegs[ofst / 4] &= ~value;
+		break;
+	default:
+		gpioRegs[ofst / 4] = value;
+		break;
+	}
+}
+
+/***	HwSimWrite32(UINTPTR addr, u32 value)
+**
+**	Parameters:
+**		addr - Physical address of the register
+**		value - Value to write
+**
+**	Return Value:
+**
+**	Description:
+**		Writes a register with the side effects the core has: starting
+**		and stopping channels, soft resets, write-one-to-clear status
+**		bits, starting and stopping the pixel clock, HPD. Writes outside
+**		the modeled cores and to read-only registers are ignored.
+**
+*/
+void HwSimWrite32(UINTPTR addr, u32 value)
+{
+	int i;
+
+	if (SimRegPtr(addr) != NULL)
+	{
+		if (addr >= HWSIM_VDMA_BASEADDR && addr < HWSIM_VDMA_BASEADDR + SIM_VDMA_REGS * 4)
+		{
+			SimVdmaWrite(addr - HWSIM_VDMA_BASEADDR, value);
+		}
+		else if (addr >= HWSIM_DYNCLK_BASEADDR && addr < HWSIM_DYNCLK_BASEADDR + SIM_DYNCLK_REGS * 4)
+		{
+			SimDynclkWrite(addr - HWSIM_DYNCLK_BASEADDR, value);
+		}
+		else if (addr >= HWSIM_GPIO_BASEADDR && addr < HWSIM_GPIO_BASEADDR + SIM_GPIO_REGS * 4)
+		{
+			SimGpioWrite(addr - HWSIM_GPIO_BASEADDR, value);
+		}
+		else
+		{
+			for (i = 0; i < 2; i++)
+			{
+				if (addr >= vtcBase[i] && addr < vtcBase[i] + SIM_VTC_REGS * 4)
+				{
+					SimVtcWrite(i, addr - vtcBase[i], value);
+				}
+			}
+		}
+	}
+
+	SimAdvance(HWSIM_ACCESS_NS);
+}
+/* ------------------------------------------------------------ */
+
+/***	HwSimConnect(u32 irq, HwSimHandler fn, void *callBackRef)
+**
+**	Parameters:
+**		irq - One of the HWSIM_IRQ_* lines
+**		fn - Handler to call while the line is asserted, NULL to disconnect
+**		callBackRef - Data to pass to fn
+**
+**	Return Value:
+**
+*/
+void HwSimConnect(u32 irq, HwSimHandler fn, void *callBackRef)
+{
+	int i;
+
+	for (i = 0; i < SIM_NUM_IRQS; i++)
+	{
+		if (irqIds[i] == irq)
+		{
+			irqs[i].fn = fn;
+			irqs[i].ref = callBackRef;
+		}
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	HwSimSetIrqEnable(int fEnable)
+**
+**	Parameters:
+**		fEnable - Nonzero to deliver interrupts, 0 to hold them pending
+**
+**	Return Value:
+**
+**	Description:
+**		Equivalent of unmasking IRQs in the CPSR. Enabling delivers
+**		anything already pending.
+**
+*/
+void HwSimSetIrqEnable(int fEnable)
+{
+	fIrqEnable = fEnable;
+	SimDeliverIrqs();
+}
+/* ------------------------------------------------------------ */
+
+/***	HwSimSetSource(const HwSimSource *sourcePtr)
+**
+**	Parameters:
+**		sourcePtr - Timing of the new input source, NULL to unplug it
+**
+**	Return Value:
+**
+**	Description:
+**		Connects, changes or removes the input. Any change drops the
+**		TMDS lock, as a real source does when it changes mode, and the
+**		receiver locks again HWSIM_LOCK_FRAMES frames later if HPD is
+**		asserted. The first frame of the new source ends one frame
+**		period from now.
+**
+*/
+void HwSimSetSource(const HwSimSource *sourcePtr)
+{
+	SimSetLocked(0);
+	lockFrames = 0;
+
+	if (sourcePtr == NULL || sourcePtr->framePeriodNs == 0)
+	{
+		nextInFrame = 0;
+	}
+	else
+	{
+		source = *sourcePtr;
+		nextInFrame = simNow + source.framePeriodNs;
+	}
+
+	SimDeliverIrqs();
+}
+/* ------------------------------------------------------------ */
+
+/***	HwSimSetFrameHook(u32 chan, HwSimFrameHook fn, void *callBackRef)
+**
+**	Parameters:
+**		chan - HWSIM_MM2S or HWSIM_S2MM
+**		fn - Function to call at the end of each frame the channel
+**			 transfers, NULL to remove it
+**		callBackRef - Data to pass to fn
+**
+**	Return Value:
+**
+*/
+void HwSimSetFrameHook(u32 chan, HwSimFrameHook fn, void *callBackRef)
+{
+	if (chan <= HWSIM_S2MM)
+	{
+		vdmaChan[chan].hook = fn;
+		vdmaChan[chan].hookRef = callBackRef;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	HwSimGetFrameCount(u32 chan)
+**
+**	Parameters:
+**		chan - HWSIM_MM2S or HWSIM_S2MM
+**
+**	Return Value: u32
+**		Frames the channel has transferred since HwSimReset
+**
+*/
+u32 HwSimGetFrameCount(u32 chan)
+{
+	return (chan <= HWSIM_S2MM) ? vdmaChan[chan].frames : 0;
+}
+
+
+#ifdef HWSIM_MAIN
+/*
+ * GpioIsr enables the input VTC interrupt at the GIC when the receiver
+ * locks and disables it on loss of lock. The host program has no GIC, so
+ * these connect and disconnect the VTC handler in the model instead.
+ */
+void XScuGic_Enable(XScuGic *InstancePtr, u32 Int_Id)
+{
+	if (Int_Id == HWSIM_IRQ_VTC_IN)
+	{
+		HwSimConnect(Int_Id, (HwSimHandler) XVtc_IntrHandler, &hostVideo.vtc);
+	}
+}
+
+void XScuGic_Disable(XScuGic *InstancePtr, u32 Int_Id)
+{
+	HwSimConnect(Int_Id, NULL, NULL);
+}
+
+static void HwSimHostVideoCallback(void *callBackRef, void *pVideo)
+{
+	hostVideoCallbacks++;
+}
+
+/*
+ * DisplayVtcIsr only counts frames while a frame callback is set
+ */
+static void HwSimHostFrameCallback(void *callBackRef, void *pDisplay)
+{
+}
+
+/*
+ * Prints a failed check. Returns 1 if it failed.
+ */
+static int HwSimHostCheck(int fOk, const char *what)
+{
+	if (!fOk)
+	{
+		printf("FAILED: %s\n", what);
+	}
+	return !fOk;
+}
+
+/*
+ * Input source with the timing of a display mode at its nominal rate
+ */
+static void HwSimHostSource(HwSimSource *sourcePtr, const VideoMode *mode)
+{
+	sourcePtr->width = mode->width;
+	sourcePtr->height = mode->height;
+	sourcePtr->hTotal = mode->hmax + 1;
+	sourcePtr->vTotal = mode->vmax + 1;
+	sourcePtr->framePeriodNs = (u32) ((double) sourcePtr->hTotal * sourcePtr->vTotal * 1.0e3 / mode->freq);
+}
+
+/*
+ * Steps 1 ms at a time until capture reaches state or timeoutUs passes.
+ * Returns the simulated microseconds it took.
+ */
+static double HwSimHostWaitVideo(VideoState state, u32 timeoutUs)
+{
+	u64 start = HwSimNow();
+
+	while (hostVideo.state != state && HwSimNow() - start < (u64) timeoutUs * 1000)
+	{
+		HwSimStep(1000);
+	}
+
+	return (double) (HwSimNow() - start) / 1000.0;
+}
+
+/*
+ * Runs the display through every mode, checking the pixel clock, the
+ * frame rate and the VDMA frame stores, and prints how long each start
+ * and stop takes in simulated time. Returns the number of failures.
+ */
+static u32 HwSimHostDisplay(void)
+{
+	const VideoMode *const modes[] = {&VMODE_640x480, &VMODE_800x600, &VMODE_1280x720, &VMODE_1280x1024, &VMODE_1920x1080};
+	u32 failures = 0;
+	u32 m, i, frames, counted;
+	u64 start, startNs, stopNs, periodNs;
+	double pixClk, rate;
+	UINTPTR addr;
+
+	printf("%-16s %10s %10s %12s %10s\n", "Display mode", "start us", "stop us", "clock MHz", "frames/s");
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+	{
+		start = HwSimNow();
+		DisplaySetMode(&hostDisp, modes[m]);
+		stopNs = HwSimNow() - start;
+		start = HwSimNow();
+		failures += HwSimHostCheck(DisplayStart(&hostDisp) == XST_SUCCESS && hostDisp.state == DISPLAY_RUNNING, "DisplayStart");
+		startNs = HwSimNow() - start;
+
+		/*
+		 * Let the MMCM lock before counting frames
+		 */
+		HwSimStep(SIM_CLK_LOCK_NS / 1000 + 1);
+		pixClk = HwSimGetPixelClock();
+		failures += HwSimHostCheck(pixClk > hostDisp.pxlFreq * 1.0e6 * (1.0 - HWSIM_HOST_CLK_TOL) &&
+				pixClk < hostDisp.pxlFreq * 1.0e6 * (1.0 + HWSIM_HOST_CLK_TOL), "pixel clock");
+
+		for (i = 0; i < DISPLAY_NUM_FRAMES; i++)
+		{
+			addr = HwSimRead32(HWSIM_VDMA_BASEADDR + XAXIVDMA_MM2S_ADDR_OFFSET + XAXIVDMA_START_ADDR_OFFSET + i * XAXIVDMA_START_ADDR_LEN);
+			failures += HwSimHostCheck(addr == (UINTPTR) hostDisp.framePtr[i], "MM2S frame store address");
+		}
+		failures += HwSimHostCheck(HwSimRead32(HWSIM_VDMA_BASEADDR + XAXIVDMA_MM2S_ADDR_OFFSET + XAXIVDMA_HSIZE_OFFSET) ==
+				modes[m]->width * 3, "MM2S line size");
+
+		periodNs = (u64) ((double) (modes[m]->hmax + 1) * (modes[m]->vmax + 1) * 1.0e9 / pixClk);
+		frames = HwSimGetFrameCount(HWSIM_MM2S);
+		counted = hostDisp.frameCount;
+		start = HwSimNow();
+		HwSimStep((u32) (periodNs * HWSIM_HOST_FRAMES / 1000));
+		frames = HwSimGetFrameCount(HWSIM_MM2S) - frames;
+		counted = hostDisp.frameCount - counted;
+		rate = (double) frames * 1.0e9 / (double) (HwSimNow() - start);
+		failures += HwSimHostCheck(frames >= HWSIM_HOST_FRAMES - 1 && frames <= HWSIM_HOST_FRAMES + 1, "MM2S frame rate");
+		failures += HwSimHostCheck(counted == frames, "frame callback per MM2S frame");
+
+		/*
+		 * A parked channel moves to the new frame at the next frame start
+		 */
+		DisplayChangeFrame(&hostDisp, (m + 1) % DISPLAY_NUM_FRAMES);
+		HwSimStep((u32) (periodNs * 2 / 1000));
+		failures += HwSimHostCheck(((HwSimRead32(HWSIM_VDMA_BASEADDR + XAXIVDMA_PARKPTR_OFFSET) & XAXIVDMA_PARKPTR_READSTR_MASK) >> 16) ==
+				(m + 1) % DISPLAY_NUM_FRAMES, "DisplayChangeFrame");
+
+		printf("%-16s %10.1f %10.1f %12.3f %10.2f\n", modes[m]->label, (double) startNs / 1000.0, (double) stopNs / 1000.0,
+				pixClk / 1.0e6, rate);
+	}
+
+	start = HwSimNow();
+	failures += HwSimHostCheck(DisplayStop(&hostDisp) == XST_SUCCESS && hostDisp.state == DISPLAY_STOPPED, "DisplayStop");
+	stopNs = HwSimNow() - start;
+	frames = HwSimGetFrameCount(HWSIM_MM2S);
+	HwSimStep(100000);
+	failures += HwSimHostCheck(HwSimGetFrameCount(HWSIM_MM2S) == frames, "no MM2S frames after DisplayStop");
+	printf("%-16s %10s %10.1f\n\n", "Stopped", "", (double) stopNs / 1000.0);
+
+	return failures;
+}
+
+/*
+ * Plugs in sources, stops and starts capture and pulls the cable, checking
+ * the state, timing and callbacks of video_capture and that the S2MM
+ * channel runs only while streaming. Returns the number of failures.
+ */
+static u32 HwSimHostCapture(void)
+{
+	const VideoMode *const modes[] = {&VMODE_1280x720, &VMODE_1920x1080};
+	HwSimSource src;
+	u32 failures = 0;
+	u32 m, frames, callbacks;
+	u64 start;
+	double lockUs, stopUs, startUs, lossUs;
+
+	printf("%-16s %10s %10s %10s %10s\n", "Capture source", "lock us", "stop us", "start us", "loss us");
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+	{
+		HwSimHostSource(&src, modes[m]);
+		callbacks = hostVideoCallbacks;
+		HwSimSetSource(&src);
+		lockUs = HwSimHostWaitVideo(VIDEO_STREAMING, HWSIM_HOST_LOCK_US);
+		failures += HwSimHostCheck(hostVideo.state == VIDEO_STREAMING, "capture starts on detect");
+		failures += HwSimHostCheck(hostVideo.timing.HActiveVideo == modes[m]->width &&
+				hostVideo.timing.VActiveVideo == modes[m]->height, "detected timing");
+		failures += HwSimHostCheck(hostVideoCallbacks == callbacks + 1, "callback on detect");
+
+		frames = HwSimGetFrameCount(HWSIM_S2MM);
+		HwSimStep(src.framePeriodNs / 1000 * HWSIM_HOST_FRAMES);
+		frames = HwSimGetFrameCount(HWSIM_S2MM) - frames;
+		failures += HwSimHostCheck(frames >= HWSIM_HOST_FRAMES - 1 && frames <= HWSIM_HOST_FRAMES + 1, "S2MM frame rate");
+		failures += HwSimHostCheck(!(HwSimRead32(HWSIM_VDMA_BASEADDR + XAXIVDMA_RX_OFFSET + XAXIVDMA_SR_OFFSET) & XAXIVDMA_SR_ERR_ALL_MASK),
+				"no S2MM errors");
+
+		start = HwSimNow();
+		VideoStop(&hostVideo);
+		stopUs = (double) (HwSimNow() - start) / 1000.0;
+		failures += HwSimHostCheck(hostVideo.state == VIDEO_PAUSED, "VideoStop");
+		frames = HwSimGetFrameCount(HWSIM_S2MM);
+		HwSimStep(src.framePeriodNs / 1000 * 3);
+		failures += HwSimHostCheck(HwSimGetFrameCount(HWSIM_S2MM) == frames, "no S2MM frames while paused");
+
+		start = HwSimNow();
+		failures += HwSimHostCheck(VideoStart(&hostVideo) == XST_SUCCESS && hostVideo.state == VIDEO_STREAMING, "VideoStart");
+		startUs = (double) (HwSimNow() - start) / 1000.0;
+		HwSimStep(src.framePeriodNs / 1000 * 3);
+		failures += HwSimHostCheck(HwSimGetFrameCount(HWSIM_S2MM) > frames, "S2MM frames after VideoStart");
+
+		/*
+		 * Pulling the cable drops the lock, and GpioIsr stops capture
+		 */
+		callbacks = hostVideoCallbacks;
+		HwSimSetSource(NULL);
+		lossUs = HwSimHostWaitVideo(VIDEO_DISCONNECTED, HWSIM_HOST_LOCK_US);
+		failures += HwSimHostCheck(hostVideo.state == VIDEO_DISCONNECTED, "disconnect on loss of lock");
+		failures += HwSimHostCheck(hostVideoCallbacks == callbacks + 1, "callback on loss of lock");
+		frames = HwSimGetFrameCount(HWSIM_S2MM);
+		HwSimStep(src.framePeriodNs / 1000 * 3);
+		failures += HwSimHostCheck(HwSimGetFrameCount(HWSIM_S2MM) == frames, "no S2MM frames without a source");
+
+		printf("%-16s %10.1f %10.1f %10.1f %10.1f\n", modes[m]->label, lockUs, stopUs, startUs, lossUs);
+	}
+	printf("\n");
+
+	return failures;
+}
+
+int main(void)
+{
+	XAxiVdma_Config *vdmaConfig;
+	u8 *frames[DISPLAY_NUM_FRAMES];
+	u32 failures = 0;
+	u32 i;
+	u64 start;
+
+	HwSimReset();
+
+	for (i = 0; i < DISPLAY_NUM_FRAMES; i++)
+	{
+		frames[i] = (u8 *) (UINTPTR) (HWSIM_HOST_FRAME_BASE + i * HWSIM_HOST_FRAME_SIZE);
+	}
+
+	vdmaConfig = XAxiVdma_LookupConfig(XPAR_AXIVDMA_0_DEVICE_ID);
+	failures += HwSimHostCheck(vdmaConfig != NULL && XAxiVdma_CfgInitialize(&hostVdma, vdmaConfig, vdmaConfig->BaseAddress) == XST_SUCCESS,
+			"XAxiVdma_CfgInitialize");
+
+	start = HwSimNow();
+	failures += HwSimHostCheck(DisplayInitialize(&hostDisp, &hostVdma, XPAR_V_TC_OUT_DEVICE_ID, HWSIM_DYNCLK_BASEADDR, frames,
+			HWSIM_HOST_STRIDE) == XST_SUCCESS, "DisplayInitialize");
+	printf("%-28s %10.1f us\n", "DisplayInitialize", (double) (HwSimNow() - start) / 1000.0);
+
+	HwSimConnect(HWSIM_IRQ_VTC_OUT, (HwSimHandler) XVtc_IntrHandler, &hostDisp.vtc);
+	HwSimConnect(HWSIM_IRQ_GPIO, GpioIsr, &hostVideo);
+	HwSimSetIrqEnable(1);
+	DisplaySetFrameCallback(&hostDisp, HwSimHostFrameCallback, NULL);
+
+	start = HwSimNow();
+	failures += HwSimHostCheck(VideoInitialize(&hostVideo, &hostIntc, &hostVdma, XPAR_AXI_GPIO_VIDEO_DEVICE_ID, XPAR_V_TC_IN_DEVICE_ID,
+			HWSIM_IRQ_VTC_IN, frames, HWSIM_HOST_STRIDE, 1) == XST_SUCCESS, "VideoInitialize");
+	printf("%-28s %10.1f us\n\n", "VideoInitialize", (double) (HwSimNow() - start) / 1000.0);
+	VideoSetCallback(&hostVideo, HwSimHostVideoCallback, NULL);
+
+	failures += HwSimHostDisplay();
+	failures += HwSimHostCapture();
+
+	printf("%lu check(s) failed\n", (unsigned long) failures);
+
+	return failures != 0;
+}
+#endif
+
+#endif /* __linux__ */
+
+/************************************************************************/
@@ -0,0 +1,456 @@
+/************************************************************************/
+/*																		*/
+/*	membench.c	--	Memory bandwidth benchmark over framebuffers		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Read, write, copy and fill throughput over framebuffer sized	*/
+/*		regions in row and column order, at two strides, in C and		*/
+/*		NEON, cached and write-combined. See membench.h.				*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "membench.h"
+#include "xstatus.h"
+#include "../display_ctrl/vga_modes.h"
+#include "../bw_budget/bw_budget.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+ #include <arm_neon.h>
+ #define MEMBENCH_HAVE_NEON 1
+#else
+ #define MEMBENCH_HAVE_NEON 0
+#endif
+
+#ifdef __linux__
+ #include <stdlib.h>
+ #include <time.h>
+ #define MEMBENCH_PRINTF printf
+#else
+ #include "xil_cache.h"
+ #include "xil_mmu.h"
+ #include "../timer_ps/timer_ps.h"
+ #include "../uart_ps/uart_ps.h"
+ #define MEMBENCH_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Keeps the compiler from turning the C loops into vector code, so they
+ * stay a fair comparison with the NEON ones
+ */
+#define MEMBENCH_SCALAR __attribute__((optimize("no-tree-vectorize")))
+
+/*
+ * Size of one MMU section, the granule MemBenchSetMapping works in
+ */
+#define MEMBENCH_SECTION 0x100000
+
+/*
+ * Runs of each test per resolution in the host program
+ */
+#define MEMBENCH_HOST_REPS 4
+
+/* ------------------------------------------------------------ */
+/*				Local Type Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Access pattern of one test: the outer loop runs outerCount times, moving
+ * outerStep bytes, the inner loop innerCount times, moving innerStep
+ * bytes. Row order has lines outside and words inside, column order the
+ * other way around.
+ */
+typedef struct {
+		u32 outerCount;
+		u32 outerStep;
+		u32 innerCount;
+		u32 innerStep;
+} MemBenchWalk;
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static const VideoMode *const memBenchModes[] = {
+	&VMODE_640x480,
+	&VMODE_800x600,
+	&VMODE_1280x720,
+	&VMODE_1280x1024,
+	&VMODE_1600x900,
+	&VMODE_1920x1080
+};
+
+#define MEMBENCH_NUM_MODES (sizeof(memBenchModes) / sizeof(memBenchModes[0]))
+
+static const char *opNames[MEMBENCH_NUM_OPS] = {"read", "write", "copy", "fill"};
+
+/*
+ * Results of the read tests are stored here so the loads are not removed
+ */
+static volatile u32 memBenchSink;
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 MemBenchUs(void)
+{
+#ifdef __linux__
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+	return TimerGetUs();
+#endif
+}
+
+/*
+ * One pass of a test with 4 byte C accesses
+ */
+static MEMBENCH_SCALAR void MemBenchScalar(MemBenchOp op, u8 *src, u8 *dst, const MemBenchWalk *walkPtr)
+{
+	u32 i, j;
+	u8 *s;
+	u8 *d;
+	u32 acc = 0;
+
+	for (i = 0; i < walkPtr->outerCount; i++)
+	{
+		s = src + i * walkPtr->outerStep;
+		d = dst + i * walkPtr->outerStep;
+		switch (op)
+		{
+		case MEMBENCH_READ:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				acc += *(u32 *) s;
+				s += walkPtr->innerStep;
+			}
+			break;
+		case MEMBENCH_WRITE:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				*(u32 *) d = i ^ j;
+				d += walkPtr->innerStep;
+			}
+			break;
+		case MEMBENCH_COPY:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				*(u32 *) d = *(u32 *) s;
+				s += walkPtr->innerStep;
+				d += walkPtr->innerStep;
+			}
+			break;
+		default:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				*(u32 *) d = 0x80808080;
+				d += walkPtr->innerStep;
+			}
+		}
+	}
+	memBenchSink = acc;
+}
+
+#if MEMBENCH_HAVE_NEON
+/*
+ * One pass of a test with 16 byte NEON accesses
+ */
+static void MemBenchNeon(MemBenchOp op, u8 *src, u8 *dst, const MemBenchWalk *walkPtr)
+{
+	u32 i, j;
+	u8 *s;
+	u8 *d;
+	uint32x4_t acc = vdupq_n_u32(0);
+	uint32x4_t value;
+	const uint32x4_t one = vdupq_n_u32(1);
+	const uint8x16_t fill = vdupq_n_u8(0x80);
+
+	for (i = 0; i < walkPtr->outerCount; i++)
+	{
+		s = src + i * walkPtr->outerStep;
+		d = dst + i * walkPtr->outerStep;
+		switch (op)
+		{
+		case MEMBENCH_READ:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				acc = vaddq_u32(acc, vreinterpretq_u32_u8(vld1q_u8(s)));
+				s += walkPtr->innerStep;
+			}
+			break;
+		case MEMBENCH_WRITE:
+			value = vdupq_n_u32(i);
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				vst1q_u8(d, vreinterpretq_u8_u32(value));
+				value = vaddq_u32(value, one);
+				d += walkPtr->innerStep;
+			}
+			break;
+		case MEMBENCH_COPY:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				vst1q_u8(d, vld1q_u8(s));
+				s += walkPtr->innerStep;
+				d += walkPtr->innerStep;
+			}
+			break;
+		default:
+			for (j = 0; j < walkPtr->innerCount; j++)
+			{
+				vst1q_u8(d, fill);
+				d += walkPtr->innerStep;
+			}
+		}
+	}
+	memBenchSink = vgetq_lane_u32(acc, 0) ^ vgetq_lane_u32(acc, 1) ^ vgetq_lane_u32(acc, 2) ^ vgetq_lane_u32(acc, 3);
+}
+#endif
+/* ------------------------------------------------------------ */
+
+/***	MemBenchRun(MemBenchOp op, u32 flags, u8 *src, u8 *dst, u32 width, u32 height, u32 reps)
+**
+**	Parameters:
+**		op - Access to measure
+**		flags - MEMBENCH_COLUMN, MEMBENCH_TIGHT and MEMBENCH_NEON select
+**				the variant. MEMBENCH_WC is ignored; the mapping is set
+**				with MemBenchSetMapping.
+**		src - Buffer read by MEMBENCH_READ and MEMBENCH_COPY
+**		dst - Buffer written by the other operations
+**		width - Frame width in pixels
+**		height - Frame height in pixels
+**		reps - Number of passes over the frame
+**
+**	Return Value: u32
+**		Bytes read plus bytes written per microsecond (MB/s), 0 if the
+**		variant is not available in this build
+**
+**	Description:
+**		Times reps passes over one frame. Both buffers must hold height
+**		lines at the selected stride.
+**
+*/
+u32 MemBenchRun(MemBenchOp op, u32 flags, u8 *src, u8 *dst, u32 width, u32 height, u32 reps)
+{
+	MemBenchWalk walk;
+	u32 unit;
+	u32 lineBytes;
+	u32 stride;
+	u64 bytes;
+	u64 startUs;
+	u64 us;
+	u32 rep;
+
+	if ((flags & MEMBENCH_NEON) && !MEMBENCH_HAVE_NEON)
+	{
+		return 0;
+	}
+
+	unit = (flags & MEMBENCH_NEON) ? 16 : 4;
+	lineBytes = (width * 3) & ~15;
+	stride = (flags & MEMBENCH_TIGHT) ? lineBytes : MEMBENCH_STRIDE;
+	if (flags & MEMBENCH_COLUMN)
+	{
+		walk.outerCount = lineBytes / unit;
+		walk.outerStep = unit;
+		walk.innerCount = height;
+		walk.innerStep = stride;
+	}
+	else
+	{
+		walk.outerCount = height;
+		walk.outerStep = stride;
+		walk.innerCount = lineBytes / unit;
+		walk.innerStep = unit;
+	}
+
+	startUs = MemBenchUs();
+	for (rep = 0; rep < reps; rep++)
+	{
+#if MEMBENCH_HAVE_NEON
+		if (flags & MEMBENCH_NEON)
+		{
+			MemBenchNeon(op, src, dst, &walk);
+			continue;
+		}
+#endif
+		MemBenchScalar(op, src, dst, &walk);
+	}
+	us = MemBenchUs() - startUs;
+
+	bytes = (u64) lineBytes * height * reps;
+	if (op == MEMBENCH_COPY)
+	{
+		bytes *= 2;
+	}
+
+	return (u32) (bytes / ((us == 0) ? 1 : us));
+}
+/* ------------------------------------------------------------ */
+
+/***	MemBenchSetMapping(u8 *base, u32 size, int fWc)
+**
+**	Parameters:
+**		base - Start of the buffer
+**		size - Size of the buffer in bytes
+**		fWc - 1 to map the buffer write-combined, 0 for the normal
+**				write-back cached mapping
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_NO_FEATURE if the mapping can't be changed (Linux)
+**
+**	Description:
+**		Changes the MMU attributes of every 1MB section the buffer
+**		touches, so anything else in those sections changes with it.
+**		The caches are flushed first, so no dirty line is left behind
+**		for memory that stops being cached.
+**
+*/
+int MemBenchSetMapping(u8 *base, u32 size, int fWc)
+{
+#ifdef __linux__
+	return fWc ? XST_NO_FEATURE : XST_SUCCESS;
+#else
+	UINTPTR addr;
+
+	Xil_DCacheFlush();
+	for (addr = (UINTPTR) base & ~(MEMBENCH_SECTION - 1); addr < (UINTPTR) base + size; addr += MEMBENCH_SECTION)
+	{
+		Xil_SetTlbAttributes(addr, fWc ? NORM_NONCACHE : NORM_WB_CACHE);
+	}
+
+	return XST_SUCCESS;
+#endif
+}
+/* ------------------------------------------------------------ */
+
+/***	MemBenchRunAll(u8 *src, u8 *dst, u32 reps)
+**
+**	Parameters:
+**		src - Source buffer, at least MEMBENCH_MIN_SIZE bytes
+**		dst - Destination buffer, at least MEMBENCH_MIN_SIZE bytes
+**		reps - Number of passes per test and resolution
+**
+**	Return Value:
+**
+**	Description:
+**		Prints the MM2S scan-out demand of every mode in vga_modes.h,
+**		then runs every test at every mode and prints the throughput in
+**		MB/s. The buffers are mapped write-combined for the second half
+**		of the table and cached again at the end. Tests this build can't
+**		run are left out. The contents of both buffers are overwritten.
+**
+*/
+void MemBenchRunAll(u8 *src, u8 *dst, u32 reps)
+{
+	char size[24];
+	u32 m;
+	int fWc;
+	int fMapped;
+	int op;
+	u32 variant;
+	u32 flags;
+	u32 mbps;
+
+	MEMBENCH_PRINTF("%-23s", "MB/s");
+	for (m = 0; m < MEMBENCH_NUM_MODES; m++)
+	{
+		snprintf(size, sizeof(size), "%lux%lu", (unsigned long) memBenchModes[m]->width, (unsigned long) memBenchModes[m]->height);
+		MEMBENCH_PRINTF(" %9s", size);
+	}
+	MEMBENCH_PRINTF("\n\r%-23s", "VDMA scan-out demand");
+	for (m = 0; m < MEMBENCH_NUM_MODES; m++)
+	{
+		MEMBENCH_PRINTF(" %9lu", (unsigned long) (BwDisplayDemand(memBenchModes[m]) / 1000000));
+	}
+	MEMBENCH_PRINTF("\n\r\n\r%-5s %-3s %-5s %-4s %-2s\n\r", "Op", "Ord", "Strd", "Code", "Map");
+
+	for (fWc = 0; fWc <= 1; fWc++)
+	{
+		fMapped = (MemBenchSetMapping(src, MEMBENCH_MIN_SIZE, fWc) == XST_SUCCESS &&
+				MemBenchSetMapping(dst, MEMBENCH_MIN_SIZE, fWc) == XST_SUCCESS);
+		for (op = 0; op < MEMBENCH_NUM_OPS; op++)
+		{
+			for (variant = 0; variant < MEMBENCH_NUM_VARIANTS / 2; variant++)
+			{
+				flags = variant | (fWc ? MEMBENCH_WC : 0);
+				if (!fMapped || ((flags & MEMBENCH_NEON) && !MEMBENCH_HAVE_NEON))
+				{
+					continue;
+				}
+				MEMBENCH_PRINTF("%-5s %-3s %-5s %-4s %-2s",
+						opNames[op],
+						(flags & MEMBENCH_COLUMN) ? "col" : "row",
+						(flags & MEMBENCH_TIGHT) ? "tight" : "5760",
+						(flags & MEMBENCH_NEON) ? "neon" : "c",
+						(flags & MEMBENCH_WC) ? "wc" : "wb");
+				for (m = 0; m < MEMBENCH_NUM_MODES; m++)
+				{
+					mbps = MemBenchRun(op, flags, src, dst, memBenchModes[m]->width, memBenchModes[m]->height, reps);
+					MEMBENCH_PRINTF(" %9lu", (unsigned long) mbps);
+				}
+				MEMBENCH_PRINTF("\n\r");
+			}
+		}
+	}
+
+	MemBenchSetMapping(src, MEMBENCH_MIN_SIZE, 0);
+	MemBenchSetMapping(dst, MEMBENCH_MIN_SIZE, 0);
+
+	if (!MEMBENCH_HAVE_NEON)
+	{
+		MEMBENCH_PRINTF("\n\rNEON tests skipped: built without -mfpu=neon\n\r");
+	}
+	if (!fMapped)
+	{
+		MEMBENCH_PRINTF("\n\rWrite-combined tests skipped: the mapping can't be changed\n\r");
+	}
+}
+
+#if defined(__linux__) && defined(MEMBENCH_MAIN)
+int main(void)
+{
+	u8 *bufs;
+
+	if (posix_memalign((void **) &bufs, 64, 2 * MEMBENCH_MIN_SIZE) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+
+	/*
+	 * Touch every page so the first test does not time page faults
+	 */
+	memset(bufs, 0, 2 * MEMBENCH_MIN_SIZE);
+	MemBenchRunAll(bufs, bufs + MEMBENCH_MIN_SIZE, MEMBENCH_HOST_REPS);
+	free(bufs);
+
+	return 0;
+}
+#endif
+
+/************************************************************************/
@@ -0,0 +1,551 @@
+/************************************************************************/
+/*																		*/
+/*	motion_map.c	--	Tile change map between two frames				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		The tile SAD, the map and score, and the self check. See		*/
+/*		motion_map.h.													*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added MotionMapMark									*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "motion_map.h"
+#include "../ocm/ocm.h"
+#include "xstatus.h"
+#include <string.h>
+
+#ifdef __linux__
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <time.h>
+ #define MOTION_MAP_PRINTF printf
+#else
+ #include "../uart_ps/uart_ps.h"
+ #define MOTION_MAP_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Self check: frame size, with partial tiles on the right and bottom, and
+ * the threshold
+ */
+#define MOTION_MAP_CHECK_W 100
+#define MOTION_MAP_CHECK_H 40
+#define MOTION_MAP_CHECK_THRESHOLD 200
+
+/*
+ * Frames compared by the host program, its runs of each test and its
+ * threshold
+ */
+#define MOTION_MAP_HOST_W 1920
+#define MOTION_MAP_HOST_H 1080
+#define MOTION_MAP_HOST_REPS 20
+#define MOTION_MAP_HOST_THRESHOLD (16 * 16 * 8)
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static MotionMap checkMap;
+static u8 checkCur[MOTION_MAP_CHECK_W * MOTION_MAP_CHECK_H * 4] __attribute__((aligned(4)));
+static u8 checkPrev[MOTION_MAP_CHECK_W * MOTION_MAP_CHECK_H * 4] __attribute__((aligned(4)));
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	MotionMapInit(MotionMap *mapPtr, u32 width, u32 height)
+**
+**	Parameters:
+**		mapPtr - Map to set up
+**		width, height - Size of the frames to compare
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**
+**	Errors:
+**		XST_INVALID_PARAM if the frame is empty or has more tiles than
+**		a 1920x1080 one
+**
+**	Description:
+**		Sizes the map for the frames and marks every tile unchanged.
+**
+*/
+int MotionMapInit(MotionMap *mapPtr, u32 width, u32 height)
+{
+	u32 cols = (width + MOTION_MAP_TILE - 1) / MOTION_MAP_TILE;
+	u32 rows = (height + MOTION_MAP_TILE - 1) / MOTION_MAP_TILE;
+
+	if (cols == 0 || rows == 0 || cols > MOTION_MAP_MAX_COLS || rows > MOTION_MAP_MAX_ROWS)
+	{
+		return XST_INVALID_PARAM;
+	}
+
+	memset(mapPtr, 0, sizeof(*mapPtr));
+	mapPtr->width = width;
+	mapPtr->height = height;
+	mapPtr->cols = cols;
+	mapPtr->rows = rows;
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Adds the absolute differences of the four bytes of a and b to acc
+ */
+static inline __attribute__((always_inline)) u32 MotionMapSad4(u32 acc, u32 a, u32 b)
+{
+#if defined(__ARM_FEATURE_SIMD32)
+	__asm__ ("usada8 %0, %1, %2, %3" : "=r" (acc) : "r" (a), "r" (b), "r" (acc));
+#else
+	u32 i;
+	int d;
+
+	for (i = 0; i < 32; i += 8)
+	{
+		d = (int) ((a >> i) & 0xFF) - (int) ((b >> i) & 0xFF);
+		acc += (d < 0) ? -d : d;
+	}
+#endif
+
+	return acc;
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Nonzero if the SAD of a tile of lines lines of lineBytes bytes, masked
+ * word by word with mask, goes past threshold. Stops at the end of the
+ * line that takes it there. Always inlined, so full tiles get loops with
+ * constant trip counts.
+ */
+static inline __attribute__((always_inline)) int MotionMapTile(const u8 *cur, const u8 *prev, u32 stride, u32 lineBytes, u32 lines, u32 mask,
+		u32 threshold)
+{
+	const u32 *curWords;
+	const u32 *prevWords;
+	u32 sad = 0;
+	u32 y, i;
+	int d;
+
+	for (y = 0; y < lines; y++)
+	{
+		curWords = (const u32 *) (cur + y * stride);
+		prevWords = (const u32 *) (prev + y * stride);
+		for (i = 0; i < lineBytes / 4; i++)
+		{
+			sad = MotionMapSad4(sad, curWords[i] & mask, prevWords[i] & mask);
+		}
+
+		/* Only partial RGB888 tiles have bytes left over */
+		for (i = lineBytes & ~3; i < lineBytes; i++)
+		{
+			d = (int) cur[y * stride + i] - (int) prev[y * stride + i];
+			sad += (d < 0) ? -d : d;
+		}
+
+		if (sad > threshold)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+/* ------------------------------------------------------------ */
+
+/***	MotionMapCompare(MotionMap *mapPtr, const u8 *cur, const u8 *prev, u32 stride, PixFmt fmt, u32 threshold, u32 row0, u32 row1)
+**
+**	Parameters:
+**		mapPtr - Map set up by MotionMapInit
+**		cur - Newer frame
+**		prev - Older frame
+**		stride - Bytes between lines of both frames
+**		fmt - Format of both frames
+**		threshold - Largest SAD of a tile, summed over its channels,
+**					that leaves it unchanged
+**		row0, row1 - Tile rows [row0, row1) to compare
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Compares the tiles of rows [row0, row1) and sets their bits
+**		and counts. Both frames and the stride must be word aligned.
+**		Runs from OCM.
+**
+*/
+OCM_TEXT void MotionMapCompare(MotionMap *mapPtr, const u8 *cur, const u8 *prev, u32 stride, PixFmt fmt, u32 threshold, u32 row0, u32 row1)
+{
+	u32 bytes = PixFmtBytes(fmt);
+	u32 words[MOTION_MAP_ROW_WORDS];
+	u32 row, col, lines, pixels, offset, count;
+	int fChanged;
+
+	if (row1 > mapPtr->rows)
+	{
+		row1 = mapPtr->rows;
+	}
+
+	for (row = row0; row < row1; row++)
+	{
+		lines = mapPtr->height - row * MOTION_MAP_TILE;
+		if (lines > MOTION_MAP_TILE)
+		{
+			lines = MOTION_MAP_TILE;
+		}
+
+		memset(words, 0, sizeof(words));
+		count = 0;
+		for (col = 0; col < mapPtr->cols; col++)
+		{
+			pixels = mapPtr->width - col * MOTION_MAP_TILE;
+			offset = row * MOTION_MAP_TILE * stride + col * MOTION_MAP_TILE * bytes;
+			if (fmt == PIXFMT_XRGB8888)
+			{
+				if (pixels >= MOTION_MAP_TILE)
+				{
+					fChanged = MotionMapTile(cur + offset, prev + offset, stride, MOTION_MAP_TILE * 4, lines, 0x00FFFFFF, threshold);
+				}
+				else
+				{
+					fChanged = MotionMapTile(cur + offset, prev + offset, stride, pixels * 4, lines, 0x00FFFFFF, threshold);
+				}
+			}
+			else
+			{
+				if (pixels >= MOTION_MAP_TILE)
+				{
+					fChanged = MotionMapTile(cur + offset, prev + offset, stride, MOTION_MAP_TILE * 3, lines, 0xFFFFFFFF, threshold);
+				}
+				else
+				{
+					fChanged = MotionMapTile(cur + offset, prev + offset, stride, pixels * 3, lines, 0xFFFFFFFF, threshold);
+				}
+			}
+
+			if (fChanged)
+			{
+				words[col / 32] |= 1u << (col % 32);
+				count++;
+			}
+		}
+
+		memcpy(mapPtr->bits[row], words, sizeof(words));
+		mapPtr->rowChanged[row] = count;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	MotionMapSetAll(MotionMap *mapPtr)
+**
+**	Parameters:
+**		mapPtr - Map set up by MotionMapInit
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Marks every tile changed, for when whatever the map drives has
+**		to redo the whole frame.
+**
+*/
+void MotionMapSetAll(MotionMap *mapPtr)
+{
+	u32 row, col;
+
+	for (row = 0; row < mapPtr->rows; row++)
+	{
+		memset(mapPtr->bits[row], 0, sizeof(mapPtr->bits[row]));
+		for (col = 0; col < mapPtr->cols; col++)
+		{
+			mapPtr->bits[row][col / 32] |= 1u << (col % 32);
+		}
+		mapPtr->rowChanged[row] = mapPtr->cols;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	MotionMapMark(MotionMap *mapPtr, u32 x, u32 y, u32 width, u32 height)
+**
+**	Parameters:
+**		mapPtr - Map set up by MotionMapInit
+**		x, y - Top left of a rectangle, in pixels
+**		width, height - Size of the rectangle
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Sets the bits of the tiles the rectangle touches, for a part of
+**		the frame whatever the map drives must redo anyway, such as one
+**		drawn over. The counts, and so the score, are left alone, since
+**		the tiles did not change in the frames.
+**
+*/
+void MotionMapMark(MotionMap *mapPtr, u32 x, u32 y, u32 width, u32 height)
+{
+	u32 row, col, row1, col1;
+
+	if (width == 0 || height == 0 || x >= mapPtr->width || y >= mapPtr->height)
+	{
+		return;
+	}
+
+	col1 = (x + width - 1) / MOTION_MAP_TILE;
+	col1 = (col1 >= mapPtr->cols) ? mapPtr->cols - 1 : col1;
+	row1 = (y + height - 1) / MOTION_MAP_TILE;
+	row1 = (row1 >= mapPtr->rows) ? mapPtr->rows - 1 : row1;
+	for (row = y / MOTION_MAP_TILE; row <= row1; row++)
+	{
+		for (col = x / MOTION_MAP_TILE; col <= col1; col++)
+		{
+			mapPtr->bits[row][col / 32] |= 1u << (col % 32);
+		}
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	MotionMapFinish(MotionMap *mapPtr)
+**
+**	Parameters:
+**		mapPtr - Map with every row compared or set
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Sets changed and score from the rows. The score weighs partial
+**		tiles by their area.
+**
+*/
+void MotionMapFinish(MotionMap *mapPtr)
+{
+	u64 area = 0;
+	u32 row, col, lines, pixels;
+
+	mapPtr->changed = 0;
+	for (row = 0; row < mapPtr->rows; row++)
+	{
+		if (mapPtr->rowChanged[row] == 0)
+		{
+			continue;
+		}
+		mapPtr->changed += mapPtr->rowChanged[row];
+
+		lines = mapPtr->height - row * MOTION_MAP_TILE;
+		lines = (lines > MOTION_MAP_TILE) ? MOTION_MAP_TILE : lines;
+		for (col = 0; col < mapPtr->cols; col++)
+		{
+			if (MotionMapTest(mapPtr, col, row))
+			{
+				pixels = mapPtr->width - col * MOTION_MAP_TILE;
+				pixels = (pixels > MOTION_MAP_TILE) ? MOTION_MAP_TILE : pixels;
+				area += pixels * lines;
+			}
+		}
+	}
+
+	mapPtr->score = (u32) ((area * 1000 + (u64) mapPtr->width * mapPtr->height / 2) / ((u64) mapPtr->width * mapPtr->height));
+}
+/* ------------------------------------------------------------ */
+
+/***	MotionMapCheck()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of failed cases, 0 if all passed
+**
+**	Errors:
+**
+**	Description:
+**		Changes tiles of a frame with partial edge tiles by amounts
+**		just under and over the threshold, in both formats, and
+**		compares the map with a full SAD of every tile. The unused
+**		byte of XRGB8888 is changed everywhere and must not count.
+**		Failures are printed.
+**
+*/
+u32 MotionMapCheck()
+{
+	const u32 stride = MOTION_MAP_CHECK_W * 4;
+	u32 failures = 0;
+	u32 f, i, x, y, b, row, col, bytes, sad, expected;
+	int d, fRef;
+	PixFmt fmt;
+
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		bytes = PixFmtBytes(fmt);
+		for (i = 0; i < sizeof(checkCur); i++)
+		{
+			checkPrev[i] = (u8) (i * 29 + (i >> 7));
+			checkCur[i] = checkPrev[i];
+		}
+
+		/*
+		 * Tile (col, row) gets a change of col * 13 + row * 41 levels
+		 * spread over its pixels, some of it at its last line so the
+		 * early exit is exercised on both sides of the threshold
+		 */
+		for (y = 0; y < MOTION_MAP_CHECK_H; y++)
+		{
+			for (x = 0; x < MOTION_MAP_CHECK_W; x++)
+			{
+				row = y / MOTION_MAP_TILE;
+				col = x / MOTION_MAP_TILE;
+				if ((x + y) % 5 == 0)
+				{
+					i = y * stride + x * bytes + (x % 3);
+					checkCur[i] = (u8) (checkCur[i] ^ ((col * 13 + row * 41) & 0x3F));
+				}
+				if (f)
+				{
+					checkCur[y * stride + x * 4 + 3] ^= 0xA5;
+				}
+			}
+		}
+
+		MotionMapInit(&checkMap, MOTION_MAP_CHECK_W, MOTION_MAP_CHECK_H);
+		MotionMapCompare(&checkMap, checkCur, checkPrev, stride, fmt, MOTION_MAP_CHECK_THRESHOLD, 0, 1);
+		MotionMapCompare(&checkMap, checkCur, checkPrev, stride, fmt, MOTION_MAP_CHECK_THRESHOLD, 1, checkMap.rows);
+		MotionMapFinish(&checkMap);
+
+		expected = 0;
+		for (row = 0; row < checkMap.rows; row++)
+		{
+			for (col = 0; col < checkMap.cols; col++)
+			{
+				sad = 0;
+				for (y = row * MOTION_MAP_TILE; y < (row + 1) * MOTION_MAP_TILE && y < MOTION_MAP_CHECK_H; y++)
+				{
+					for (x = col * MOTION_MAP_TILE; x < (col + 1) * MOTION_MAP_TILE && x < MOTION_MAP_CHECK_W; x++)
+					{
+						for (b = 0; b < 3; b++)
+						{
+							i = y * stride + x * bytes + b;
+							d = (int) checkCur[i] - (int) checkPrev[i];
+							sad += (d < 0) ? -d : d;
+						}
+					}
+				}
+				fRef = (sad > MOTION_MAP_CHECK_THRESHOLD);
+				expected += fRef;
+				if (MotionMapTest(&checkMap, col, row) != fRef)
+				{
+					MOTION_MAP_PRINTF("MotionMapCompare FAILED: %s tile %lu,%lu SAD %lu\n\r", PixFmtName(fmt), (unsigned long) col,
+							(unsigned long) row, (unsigned long) sad);
+					failures++;
+				}
+			}
+		}
+
+		if (checkMap.changed != expected || expected == 0 || expected == checkMap.cols * checkMap.rows)
+		{
+			MOTION_MAP_PRINTF("MotionMapFinish FAILED: %s %lu of %lu tiles changed\n\r", PixFmtName(fmt), (unsigned long) checkMap.changed,
+					(unsigned long) expected);
+			failures++;
+		}
+
+		MotionMapSetAll(&checkMap);
+		MotionMapFinish(&checkMap);
+		if (checkMap.changed != checkMap.cols * checkMap.rows || checkMap.score != 1000)
+		{
+			MOTION_MAP_PRINTF("MotionMapSetAll FAILED: %s\n\r", PixFmtName(fmt));
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+#if defined(__linux__) && defined(MOTION_MAP_MAIN)
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 MotionMapUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int main(void)
+{
+	static MotionMap map;
+	const u32 stride = MOTION_MAP_HOST_W * 4;
+	u8 *cur, *prev;
+	u32 failures, r, i, f, fSame;
+	u64 start, us;
+	PixFmt fmt;
+
+	failures = MotionMapCheck();
+	printf("Self check: %lu failure(s)\n\n", (unsigned long) failures);
+
+	if (posix_memalign((void **) &cur, 64, stride * MOTION_MAP_HOST_H) != 0 || posix_memalign((void **) &prev, 64, stride * MOTION_MAP_HOST_H) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < stride * MOTION_MAP_HOST_H; i++)
+	{
+		prev[i] = (u8) ((i * 7) ^ (i >> 11));
+	}
+
+	/*
+	 * Identical frames read every byte; frames that differ everywhere
+	 * leave each tile after its first line
+	 */
+	printf("%-24s %8s %8s %8s\n", "Frames", "changed", "Mpix/s", "ms/frame");
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		for (fSame = 0; fSame < 2; fSame++)
+		{
+			for (i = 0; i < stride * MOTION_MAP_HOST_H; i++)
+			{
+				cur[i] = fSame ? prev[i] : (u8) ~prev[i];
+			}
+			MotionMapInit(&map, MOTION_MAP_HOST_W, MOTION_MAP_HOST_H);
+			start = MotionMapUs();
+			for (r = 0; r < MOTION_MAP_HOST_REPS; r++)
+			{
+				MotionMapCompare(&map, cur, prev, stride, fmt, MOTION_MAP_HOST_THRESHOLD, 0, map.rows);
+				MotionMapFinish(&map);
+			}
+			us = MotionMapUs() - start;
+			printf("%-8s %-15s %8lu %8.1f %8.2f\n", PixFmtName(fmt), fSame ? "identical" : "all different", (unsigned long) map.changed,
+					(double) MOTION_MAP_HOST_W * MOTION_MAP_HOST_H * MOTION_MAP_HOST_REPS / us, us / 1000.0 / MOTION_MAP_HOST_REPS);
+		}
+	}
+
+	free(cur);
+	free(prev);
+
+	return failures ? 1 : 0;
+}
+#endif
+
+/************************************************************************/
@@ -0,0 +1,106 @@
+/************************************************************************/
+/*																		*/
+/*	motion_map.h	--	Tile change map between two frames				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Compares two frames in 16x16 pixel tiles by the sum of			*/
+/*		absolute differences (SAD) of their channels, and records		*/
+/*		which tiles differ by more than a threshold in a bitmap of		*/
+/*		one bit per tile, along with a motion score. A tile stops		*/
+/*		being compared at the end of the first line that takes its		*/
+/*		SAD past the threshold, so changed tiles are cheap and only		*/
+/*		unchanged ones are read in full.								*/
+/*																		*/
+/*		On ARMv6 and later the SAD takes four bytes per USADA8; on		*/
+/*		other hosts it falls back to a byte loop. The unused byte of	*/
+/*		XRGB8888 pixels is masked out.									*/
+/*																		*/
+/*		MotionMapCompare works on a range of tile rows and writes		*/
+/*		only the words and counts of those rows, so cores given			*/
+/*		different rows can fill one map at once.						*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) MotionMapInit the map for the frame size.					*/
+/*		2) MotionMapCompare every tile row, or MotionMapSetAll.			*/
+/*		3) MotionMapFinish it, then read changed and score, and			*/
+/*		   MotionMapTest each tile.										*/
+/*																		*/
+/*		With MOTION_MAP_MAIN defined on Linux the module builds as a	*/
+/*		stand-alone host program that checks it against a full SAD		*/
+/*		and times it over one 1920x1080 frame:							*/
+/*			gcc -O2 -DMOTION_MAP_MAIN -I<bsp>/include -I.				*/
+/*				motion_map/motion_map.c pixfmt/pixfmt.c blit/blit.c		*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_mem.c				*/
+/*				-o motion_map											*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added MotionMapMark									*/
+/*																		*/
+/************************************************************************/
+
+#ifndef MOTION_MAP_H_
+#define MOTION_MAP_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../pixfmt/pixfmt.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Tile size in pixels, and the most tiles in a 1920x1080 frame
+ */
+#define MOTION_MAP_TILE 16
+#define MOTION_MAP_MAX_COLS (1920 / MOTION_MAP_TILE)
+#define MOTION_MAP_MAX_ROWS ((1080 + MOTION_MAP_TILE - 1) / MOTION_MAP_TILE)
+#define MOTION_MAP_ROW_WORDS ((MOTION_MAP_MAX_COLS + 31) / 32)
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u32 width; /* Frame size in pixels */
+		u32 height;
+		u32 cols; /* Tiles across and down; tiles at the right and bottom edges can be partial */
+		u32 rows;
+		u32 bits[MOTION_MAP_MAX_ROWS][MOTION_MAP_ROW_WORDS]; /* Bit x % 32 of word x / 32 of row y is set if tile (x, y) changed */
+		u32 rowChanged[MOTION_MAP_MAX_ROWS]; /* Tiles changed in each row */
+		u32 changed; /* Tiles changed, set by MotionMapFinish */
+		u32 score; /* Permille of the frame area in changed tiles, set by MotionMapFinish */
+} MotionMap;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int MotionMapInit(MotionMap *mapPtr, u32 width, u32 height);
+void MotionMapCompare(MotionMap *mapPtr, const u8 *cur, const u8 *prev, u32 stride, PixFmt fmt, u32 threshold, u32 row0, u32 row1);
+void MotionMapSetAll(MotionMap *mapPtr);
+void MotionMapMark(MotionMap *mapPtr, u32 x, u32 y, u32 width, u32 height);
+void MotionMapFinish(MotionMap *mapPtr);
+u32 MotionMapCheck();
+
+/*
+ * Nonzero if tile (col, row) changed
+ */
+static inline int MotionMapTest(const MotionMap *mapPtr, u32 col, u32 row)
+{
+	return (mapPtr->bits[row][col / 32] >> (col % 32)) & 1;
+}
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* MOTION_MAP_H_ */
@@ -0,0 +1,204 @@
+/************************************************************************/
+/*																		*/
+/*	ocm.c	--	On-chip memory for hot code and line buffers			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Copies the OCM_TEXT code into low OCM and runs the scratch		*/
+/*		stack allocator over what is left. See ocm.h.					*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "ocm.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+#include <string.h>
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+/*
+ * From lscript.ld: where .ocm_text runs and where it is loaded, and the
+ * free space after .ocm_data
+ */
+extern u8 __ocm_text_start[];
+extern u8 __ocm_text_end[];
+extern u8 __ocm_text_load[];
+extern u8 __ocm_heap_start[];
+extern u8 __ocm_heap_end[];
+
+/*
+ * Lowest address allocated so far. Scratch is handed out downwards from
+ * __ocm_heap_end, so a mark is just this address.
+ */
+static UINTPTR ocmTop = 0;
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	OcmInit()
+**
+**	Parameters:
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**
+**	Errors:
+**
+**	Description:
+**		Copies the OCM_TEXT functions from their load address to OCM,
+**		makes the copy visible to instruction fetches, and empties the
+**		scratch allocator.
+**
+*/
+int OcmInit()
+{
+	u32 len = __ocm_text_end - __ocm_text_start;
+
+	if (len > 0 && (UINTPTR) __ocm_text_load != (UINTPTR) __ocm_text_start)
+	{
+		memcpy(__ocm_text_start, __ocm_text_load, len);
+		Xil_DCacheFlushRange((INTPTR) __ocm_text_start, len);
+		Xil_ICacheInvalidateRange((INTPTR) __ocm_text_start, len);
+		mtcp(XREG_CP15_INVAL_BRANCH_ARRAY, 0);
+		dsb();
+		isb();
+	}
+
+	ocmTop = (UINTPTR) __ocm_heap_end;
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	OcmAlloc(u32 size, u32 align)
+**
+**	Parameters:
+**		size - Bytes wanted
+**		align - Power of two alignment, 0 for OCM_ALIGN
+**
+**	Return Value: void *
+**		Start of the buffer, NULL if OCM does not have size bytes left
+**
+**	Errors:
+**
+**	Description:
+**		Takes scratch from OCM until the OcmRelease of an earlier mark.
+**		CPU0 only.
+**
+*/
+void *OcmAlloc(u32 size, u32 align)
+{
+	UINTPTR addr;
+
+	if (align == 0)
+	{
+		align = OCM_ALIGN;
+	}
+	if (ocmTop == 0 || size > ocmTop - (UINTPTR) __ocm_heap_start)
+	{
+		return NULL;
+	}
+
+	addr = (ocmTop - size) & ~((UINTPTR) align - 1);
+	if (addr < (UINTPTR) __ocm_heap_start)
+	{
+		return NULL;
+	}
+	ocmTop = addr;
+
+	return (void *) addr;
+}
+/* ------------------------------------------------------------ */
+
+/***	OcmMark()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Mark to pass to OcmRelease
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 OcmMark()
+{
+	return (u32) ocmTop;
+}
+/* ------------------------------------------------------------ */
+
+/***	OcmRelease(u32 mark)
+**
+**	Parameters:
+**		mark - Value of OcmMark before the allocations to give back
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Frees everything allocated since mark was taken. Marks must be
+**		released in the reverse order they were taken.
+**
+*/
+void OcmRelease(u32 mark)
+{
+	if (mark >= ocmTop && mark <= (u32) (UINTPTR) __ocm_heap_end)
+	{
+		ocmTop = mark;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	OcmFreeBytes()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Scratch bytes left, before alignment
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 OcmFreeBytes()
+{
+	return (ocmTop == 0) ? 0 : (u32) (ocmTop - (UINTPTR) __ocm_heap_start);
+}
+/* ------------------------------------------------------------ */
+
+/***	OcmTextBytes()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Bytes of code running from OCM
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 OcmTextBytes()
+{
+	return (u32) (__ocm_text_end - __ocm_text_start);
+}
+
+/************************************************************************/
@@ -0,0 +1,566 @@
+/************************************************************************/
+/*																		*/
+/*	osd.c	--	Alpha blended on-screen text over video frames			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		The glyph cache, the compositor and the self check. See			*/
+/*		osd.h.															*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Text color in the G, B, R order of pixfmt.h			*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "osd.h"
+#include "../ocm/ocm.h"
+#include "xstatus.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+ #include <stdlib.h>
+ #include <time.h>
+ #define OSD_PRINTF printf
+#else
+ #include "../uart_ps/uart_ps.h"
+ #define OSD_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Self check: frame size, and a text color and dimming
+ */
+#define OSD_CHECK_W 160
+#define OSD_CHECK_H 72
+#define OSD_CHECK_COLOR 0x00F0C020
+#define OSD_CHECK_DIM 96
+
+/*
+ * Frame drawn into by the host program and its runs of each test
+ */
+#define OSD_HOST_W 1920
+#define OSD_HOST_H 1080
+#define OSD_HOST_REPS 200
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static Osd checkOsd;
+static u8 checkFrame[OSD_CHECK_W * OSD_CHECK_H * 4];
+static u8 checkRef[OSD_CHECK_W * OSD_CHECK_H * 4];
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	OsdInit(Osd *osdPtr, u32 x, u32 y, u32 scale, u32 color, u32 dim)
+**
+**	Parameters:
+**		osdPtr - Pointer to the struct that will be initialized
+**		x, y - Top left of the box in the frame, in pixels
+**		scale - Frame pixels per font pixel, 1 to OSD_MAX_SCALE
+**		color - Text color, 0x00RRGGBB
+**		dim - How much the box darkens the frame, 0 (not at all) to 256
+**			  (black)
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**
+**	Errors:
+**		XST_INVALID_PARAM if scale or dim is out of range
+**
+**	Description:
+**		Empties every row and the glyph cache.
+**
+*/
+int OsdInit(Osd *osdPtr, u32 x, u32 y, u32 scale, u32 color, u32 dim)
+{
+	if (scale == 0 || scale > OSD_MAX_SCALE || dim > 256)
+	{
+		return XST_INVALID_PARAM;
+	}
+
+	memset(osdPtr, 0, sizeof(*osdPtr));
+	osdPtr->x = x;
+	osdPtr->y = y;
+	osdPtr->scale = scale;
+	osdPtr->color = color;
+	osdPtr->dim = dim;
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	OsdPrintf(Osd *osdPtr, u32 row, const char *fmt, ...)
+**
+**	Parameters:
+**		osdPtr - Pointer to the initialized Osd struct
+**		row - Row to replace, starting at 0
+**		fmt - printf style format string
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Replaces the text of a row. Nothing is drawn until OsdUpdate.
+**		Text past OSD_COLS is cut off, and characters the font does
+**		not hold are drawn as '?'.
+**
+*/
+void OsdPrintf(Osd *osdPtr, u32 row, const char *fmt, ...)
+{
+	va_list args;
+
+	if (row >= OSD_ROWS)
+	{
+		return;
+	}
+
+	va_start(args, fmt);
+	vsnprintf(osdPtr->next[row], OSD_COLS + 1, fmt, args);
+	va_end(args);
+}
+/* ------------------------------------------------------------ */
+
+/***	OsdClearRow(Osd *osdPtr, u32 row)
+**
+**	Parameters:
+**		osdPtr - Pointer to the initialized Osd struct
+**		row - Row to empty
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Empties a row, which removes its box at the next OsdUpdate.
+**
+*/
+void OsdClearRow(Osd *osdPtr, u32 row)
+{
+	if (row < OSD_ROWS)
+	{
+		osdPtr->next[row][0] = '\0';
+	}
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Renders the coverage of character c, scaled, into cell col of cache row
+ * row
+ */
+static void OsdRenderCell(Osd *osdPtr, u32 row, u32 col, char c)
+{
+	u32 scale = osdPtr->scale;
+	const u32 *glyph;
+	u8 *dst;
+	u32 bits, x, y;
+
+	if (c < OSD_FONT_FIRST || c > OSD_FONT_LAST)
+	{
+		c = '?';
+	}
+	glyph = OsdFont[c - OSD_FONT_FIRST];
+
+	for (y = 0; y < OSD_FONT_H * scale; y++)
+	{
+		bits = glyph[y / scale];
+		dst = &osdPtr->cache[row][y][col * OSD_FONT_W * scale];
+		for (x = 0; x < OSD_FONT_W * scale; x++)
+		{
+			dst[x] = (u8) (((bits >> (4 * (x / scale))) & 0xF) * 17);
+		}
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	OsdUpdate(Osd *osdPtr)
+**
+**	Parameters:
+**		osdPtr - Pointer to the initialized Osd struct
+**
+**	Return Value: u32
+**		Number of cells rendered
+**
+**	Errors:
+**
+**	Description:
+**		Renders the cells whose character differs from the one in the
+**		cache, and sizes the box of each row to its text.
+**
+*/
+u32 OsdUpdate(Osd *osdPtr)
+{
+	u32 row, col, len;
+	char c, shown;
+	int fNextEnd, fShownEnd;
+
+	osdPtr->rendered = 0;
+	for (row = 0; row < OSD_ROWS; row++)
+	{
+		fNextEnd = 0;
+		fShownEnd = 0;
+		len = 0;
+		for (col = 0; col < OSD_COLS; col++)
+		{
+			fNextEnd = fNextEnd || osdPtr->next[row][col] == '\0';
+			fShownEnd = fShownEnd || osdPtr->shown[row][col] == '\0';
+			c = fNextEnd ? ' ' : osdPtr->next[row][col];
+			shown = fShownEnd ? ' ' : osdPtr->shown[row][col];
+			if (c != shown)
+			{
+				OsdRenderCell(osdPtr, row, col, c);
+				osdPtr->rendered++;
+			}
+			if (c != ' ')
+			{
+				len = col + 1;
+			}
+		}
+
+		memcpy(osdPtr->shown[row], osdPtr->next[row], sizeof(osdPtr->shown[row]));
+		osdPtr->rowLen[row] = len;
+	}
+
+	return osdPtr->rendered;
+}
+/* ------------------------------------------------------------ */
+
+/***	OsdBounds(const Osd *osdPtr, u32 *xPtr, u32 *yPtr, u32 *widthPtr, u32 *heightPtr)
+**
+**	Parameters:
+**		osdPtr - Pointer to the updated Osd struct
+**		xPtr, yPtr - Set to the top left of the rectangle
+**		widthPtr, heightPtr - Set to its size, 0 if no row has text
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Gives the rectangle holding every box OsdComposite draws, for
+**		callers that must refresh the frame under it.
+**
+*/
+void OsdBounds(const Osd *osdPtr, u32 *xPtr, u32 *yPtr, u32 *widthPtr, u32 *heightPtr)
+{
+	u32 row, boxW;
+
+	*xPtr = osdPtr->x;
+	*yPtr = osdPtr->y;
+	*widthPtr = 0;
+	*heightPtr = 0;
+	for (row = 0; row < OSD_ROWS; row++)
+	{
+		if (osdPtr->rowLen[row] == 0)
+		{
+			continue;
+		}
+		boxW = (2 * OSD_PAD + osdPtr->rowLen[row] * OSD_FONT_W) * osdPtr->scale;
+		*widthPtr = (boxW > *widthPtr) ? boxW : *widthPtr;
+		*heightPtr = (row + 1) * OSD_FONT_H * osdPtr->scale;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Blends one box line of pixels bytes apart: the first pad pixels and all
+ * from pad + textW on are only dimmed, the rest take the color by their
+ * coverage in cov. Always inlined, so each format gets a loop with a
+ * constant pixel size.
+ */
+static inline __attribute__((always_inline)) void OsdBlendLine(u8 *p, const u8 *cov, u32 boxW, u32 pad, u32 textW, u32 bytes, const u32 color[3],
+		u32 keep)
+{
+	u32 i, a, c;
+
+	for (i = 0; i < boxW; i++)
+	{
+		a = (i >= pad && i - pad < textW) ? cov[i - pad] : 0;
+		if (a == 0)
+		{
+			for (c = 0; c < 3; c++)
+			{
+				p[c] = (u8) ((p[c] * keep) >> 8);
+			}
+		}
+		else
+		{
+			/* 255 maps to 256, so full coverage gives the color exactly */
+			a += a >> 7;
+			for (c = 0; c < 3; c++)
+			{
+				p[c] = (u8) (((((p[c] * keep) >> 8) * (256 - a)) + color[c] * a) >> 8);
+			}
+		}
+		p += bytes;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	OsdComposite(const Osd *osdPtr, u8 *frame, u32 width, u32 height, u32 stride, PixFmt fmt)
+**
+**	Parameters:
+**		osdPtr - Pointer to the updated Osd struct
+**		frame - Frame to draw into
+**		width, height - Size of the frame, which clips the boxes
+**		stride - Bytes between lines of the frame
+**		fmt - Format of the frame
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Dims the box of each row with text and blends its glyphs in
+**		with the text color. Pixels outside the boxes are not read or
+**		written. Runs from OCM.
+**
+*/
+OCM_TEXT void OsdComposite(const Osd *osdPtr, u8 *frame, u32 width, u32 height, u32 stride, PixFmt fmt)
+{
+	u32 color[3];
+	u32 scale = osdPtr->scale;
+	u32 keep = 256 - osdPtr->dim;
+	u32 row, y, y0, lines, boxW, textW;
+	u8 *line;
+
+	if (osdPtr->x >= width)
+	{
+		return;
+	}
+
+	/* In the byte order of a pixel */
+	color[PIXFMT_G] = (osdPtr->color >> 8) & 0xFF;
+	color[PIXFMT_B] = osdPtr->color & 0xFF;
+	color[PIXFMT_R] = (osdPtr->color >> 16) & 0xFF;
+
+	for (row = 0; row < OSD_ROWS; row++)
+	{
+		y0 = osdPtr->y + row * OSD_FONT_H * scale;
+		if (y0 >= height)
+		{
+			break;
+		}
+		if (osdPtr->rowLen[row] == 0)
+		{
+			continue;
+		}
+
+		lines = height - y0;
+		lines = (lines > OSD_FONT_H * scale) ? OSD_FONT_H * scale : lines;
+		textW = osdPtr->rowLen[row] * OSD_FONT_W * scale;
+		boxW = textW + 2 * OSD_PAD * scale;
+		boxW = (boxW > width - osdPtr->x) ? width - osdPtr->x : boxW;
+
+		for (y = 0; y < lines; y++)
+		{
+			line = frame + (y0 + y) * stride;
+			if (fmt == PIXFMT_XRGB8888)
+			{
+				OsdBlendLine(line + osdPtr->x * 4, osdPtr->cache[row][y], boxW, OSD_PAD * scale, textW, 4, color, keep);
+			}
+			else
+			{
+				OsdBlendLine(line + osdPtr->x * 3, osdPtr->cache[row][y], boxW, OSD_PAD * scale, textW, 3, color, keep);
+			}
+		}
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	OsdCheck()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of failed cases, 0 if all passed
+**
+**	Errors:
+**
+**	Description:
+**		Draws rows, an empty one and one clipped by the frame edges
+**		included, at both scales and in both formats, and compares
+**		every pixel of the frame with a blend worked out from the font
+**		atlas directly. Then changes one character and checks only its
+**		cell is rendered again. Failures are printed.
+**
+*/
+u32 OsdCheck()
+{
+	const char *const text[3] = {"Ab 0123", "", "x=1.5 ~|"};
+	u32 failures = 0;
+	u32 f, s, i, c, x, y, row, col, bytes, stride, a, keep, expected, fx, fy;
+	u32 color[3];
+	u32 originX;
+	u8 ch;
+	PixFmt fmt;
+
+	color[PIXFMT_G] = (OSD_CHECK_COLOR >> 8) & 0xFF;
+	color[PIXFMT_B] = OSD_CHECK_COLOR & 0xFF;
+	color[PIXFMT_R] = (OSD_CHECK_COLOR >> 16) & 0xFF;
+
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		bytes = PixFmtBytes(fmt);
+		stride = OSD_CHECK_W * bytes;
+		for (s = 1; s <= OSD_MAX_SCALE; s++)
+		{
+			/* At scale 2 the last row runs off the right and bottom */
+			originX = (s == 1) ? 3 : OSD_CHECK_W - 90;
+			OsdInit(&checkOsd, originX, 5, s, OSD_CHECK_COLOR, OSD_CHECK_DIM);
+			for (row = 0; row < 3; row++)
+			{
+				OsdPrintf(&checkOsd, row, "%s", text[row]);
+			}
+			OsdUpdate(&checkOsd);
+
+			for (i = 0; i < sizeof(checkFrame); i++)
+			{
+				checkFrame[i] = (u8) (i * 37 + (i >> 5));
+			}
+			memcpy(checkRef, checkFrame, sizeof(checkRef));
+			OsdComposite(&checkOsd, checkFrame, OSD_CHECK_W, OSD_CHECK_H, stride, fmt);
+
+			keep = 256 - OSD_CHECK_DIM;
+			for (y = 0; y < OSD_CHECK_H; y++)
+			{
+				for (x = 0; x < OSD_CHECK_W; x++)
+				{
+					if (y < checkOsd.y || x < checkOsd.x)
+					{
+						continue;
+					}
+					row = (y - checkOsd.y) / (OSD_FONT_H * s);
+					if (row >= 3 || strlen(text[row]) == 0 || x - checkOsd.x >= (2 * OSD_PAD + strlen(text[row]) * OSD_FONT_W) * s)
+					{
+						continue;
+					}
+
+					a = 0;
+					fx = (x - checkOsd.x) / s;
+					fy = ((y - checkOsd.y) / s) % OSD_FONT_H;
+					if (fx >= OSD_PAD && fx - OSD_PAD < strlen(text[row]) * OSD_FONT_W)
+					{
+						col = (fx - OSD_PAD) / OSD_FONT_W;
+						ch = (u8) text[row][col];
+						a = ((OsdFont[ch - OSD_FONT_FIRST][fy] >> (4 * ((fx - OSD_PAD) % OSD_FONT_W))) & 0xF) * 17;
+						a += a >> 7;
+					}
+					for (c = 0; c < 3; c++)
+					{
+						i = y * stride + x * bytes + c;
+						expected = (((checkRef[i] * keep) >> 8) * (256 - a) + color[c] * a) >> 8;
+						checkRef[i] = (u8) expected;
+					}
+				}
+			}
+
+			if (memcmp(checkFrame, checkRef, OSD_CHECK_H * stride) != 0)
+			{
+				OSD_PRINTF("OsdComposite FAILED: %s scale %lu\n\r", PixFmtName(fmt), (unsigned long) s);
+				failures++;
+			}
+
+			OsdPrintf(&checkOsd, 2, "x=1.6 ~|");
+			if (OsdUpdate(&checkOsd) != 1 || OsdUpdate(&checkOsd) != 0)
+			{
+				OSD_PRINTF("OsdUpdate FAILED: %s scale %lu\n\r", PixFmtName(fmt), (unsigned long) s);
+				failures++;
+			}
+		}
+	}
+
+	return failures;
+}
+
+#if defined(__linux__) && defined(OSD_MAIN)
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 OsdUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int main(void)
+{
+	static Osd osd;
+	const u32 stride = OSD_HOST_W * 4;
+	u8 *frame;
+	u32 failures, r, i, f, row, x, y, w, h;
+	u64 start, us;
+	PixFmt fmt;
+
+	failures = OsdCheck();
+	printf("Self check: %lu failure(s)\n\n", (unsigned long) failures);
+
+	if (posix_memalign((void **) &frame, 64, stride * OSD_HOST_H) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < stride * OSD_HOST_H; i++)
+	{
+		frame[i] = (u8) ((i * 7) ^ (i >> 11));
+	}
+
+	OsdInit(&osd, 32, 32, 2, 0x00FFFFFF, 128);
+	for (row = 0; row < 6; row++)
+	{
+		OsdPrintf(&osd, row, "Row %lu: 1920x1080 148.500 MHz %lu", (unsigned long) row, (unsigned long) row * 7);
+	}
+	OsdUpdate(&osd);
+	OsdBounds(&osd, &x, &y, &w, &h);
+	printf("Box %lux%lu at %lu,%lu, %lu%% of the frame\n\n", (unsigned long) w, (unsigned long) h, (unsigned long) x, (unsigned long) y,
+			(unsigned long) (w * h * 100 / (OSD_HOST_W * OSD_HOST_H)));
+
+	printf("%-24s %10s\n", "Call", "us/call");
+	for (f = 0; f < 2; f++)
+	{
+		fmt = f ? PIXFMT_XRGB8888 : PIXFMT_RGB888;
+		start = OsdUs();
+		for (r = 0; r < OSD_HOST_REPS; r++)
+		{
+			OsdComposite(&osd, frame, OSD_HOST_W, OSD_HOST_H, stride, fmt);
+		}
+		us = OsdUs() - start;
+		printf("OsdComposite %-11s %10.1f\n", PixFmtName(fmt), (double) us / OSD_HOST_REPS);
+	}
+
+	start = OsdUs();
+	for (r = 0; r < OSD_HOST_REPS; r++)
+	{
+		OsdPrintf(&osd, 5, "Row 5: 1920x1080 148.500 MHz %lu", (unsigned long) r % 10);
+		OsdUpdate(&osd);
+	}
+	us = OsdUs() - start;
+	printf("%-24s %10.1f, %lu cell(s) rendered\n", "OsdUpdate, one change", (double) us / OSD_HOST_REPS, (unsigned long) osd.rendered);
+
+	free(frame);
+
+	return failures ? 1 : 0;
+}
+#endif
+
+/************************************************************************/
@@ -0,0 +1,113 @@
+/************************************************************************/
+/*																		*/
+/*	osd.h	--	Alpha blended on-screen text over video frames			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Draws a few rows of status text into a frame, as light text		*/
+/*		on a dimmed box, with the same next/shown model as term_ui:		*/
+/*		OsdPrintf sets the text of a row and OsdUpdate brings the		*/
+/*		glyph cache up to date. The cache holds each character cell		*/
+/*		already scaled to its alpha coverage, and only cells whose		*/
+/*		character changed are rendered again from the font atlas.		*/
+/*																		*/
+/*		OsdComposite blends the cache into a frame, touching only		*/
+/*		the bounding box of the text of each row, so the cost is		*/
+/*		proportional to the text shown rather than the frame. The		*/
+/*		frame must hold fresh pixels under the boxes, as a frame		*/
+/*		that was just produced does; compositing twice darkens the		*/
+/*		boxes twice.													*/
+/*																		*/
+/*		The font atlas, osd_font.c, holds ASCII 32 to 126 in 8x16		*/
+/*		cells at 4 bits of coverage per pixel, pre-rasterized from		*/
+/*		DejaVu Sans Mono (Bitstream Vera license).						*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) OsdInit with the position, scale and colors.					*/
+/*		2) OsdPrintf the rows that changed, then OsdUpdate.				*/
+/*		3) OsdComposite into each frame produced.						*/
+/*																		*/
+/*		With OSD_MAIN defined on Linux the module builds as a			*/
+/*		stand-alone host program that checks it against a per pixel		*/
+/*		blend and times it over one 1920x1080 frame:					*/
+/*			gcc -O2 -DOSD_MAIN -I<bsp>/include -I. osd/osd.c			*/
+/*				osd/osd_font.c pixfmt/pixfmt.c blit/blit.c				*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_mem.c -o osd		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef OSD_H_
+#define OSD_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../pixfmt/pixfmt.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Font atlas: cell size and the characters it holds. Each cell row is one
+ * word, 4 bits of coverage per pixel, leftmost pixel in the low bits.
+ */
+#define OSD_FONT_W 8
+#define OSD_FONT_H 16
+#define OSD_FONT_FIRST 32
+#define OSD_FONT_LAST 126
+#define OSD_FONT_GLYPHS (OSD_FONT_LAST - OSD_FONT_FIRST + 1)
+
+/*
+ * Text rows and columns, the largest scale and the box margin left and
+ * right of the text, in unscaled pixels
+ */
+#define OSD_ROWS 8
+#define OSD_COLS 40
+#define OSD_MAX_SCALE 2
+#define OSD_PAD 4
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u32 x; /* Top left of the box in the frame, in pixels */
+		u32 y;
+		u32 scale; /* Each font pixel is scale x scale frame pixels */
+		u32 color; /* Text color, 0x00RRGGBB */
+		u32 dim; /* The box keeps (256 - dim) / 256 of the frame under it */
+		char next[OSD_ROWS][OSD_COLS + 1]; /* Rows to be shown by the next update */
+		char shown[OSD_ROWS][OSD_COLS + 1]; /* Rows in the cache */
+		u32 rowLen[OSD_ROWS]; /* Characters of each shown row up to its last non-space, 0 for no box */
+		u8 cache[OSD_ROWS][OSD_FONT_H * OSD_MAX_SCALE][OSD_COLS * OSD_FONT_W * OSD_MAX_SCALE]; /* Coverage of the shown rows, 0 to 255 */
+		u32 rendered; /* Cells rendered by the last OsdUpdate */
+} Osd;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int OsdInit(Osd *osdPtr, u32 x, u32 y, u32 scale, u32 color, u32 dim);
+void OsdPrintf(Osd *osdPtr, u32 row, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+void OsdClearRow(Osd *osdPtr, u32 row);
+u32 OsdUpdate(Osd *osdPtr);
+void OsdBounds(const Osd *osdPtr, u32 *xPtr, u32 *yPtr, u32 *widthPtr, u32 *heightPtr);
+void OsdComposite(const Osd *osdPtr, u8 *frame, u32 width, u32 height, u32 stride, PixFmt fmt);
+u32 OsdCheck();
+
+extern const u32 OsdFont[OSD_FONT_GLYPHS][OSD_FONT_H];
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* OSD_H_ */
@@ -0,0 +1,413 @@
+/************************************************************************/
+/*																		*/
+/*	osd_font.c	--	Font atlas of the on-screen display					*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		ASCII 32 to 126 in 8x16 cells, pre-rasterized from DejaVu Sans	*/
+/*		Mono at 13 pixels with antialiasing and kept at 4 bits of		*/
+/*		coverage per pixel. DejaVu fonts are under the Bitstream Vera	*/
+/*		license, which allows embedding. See osd.h for the layout.		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "osd.h"
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+const u32 OsdFont[OSD_FONT_GLYPHS][OSD_FONT_H] = {
+	{ /* ' ' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '!' */
+		0x00000000, 0x00000000, 0x00000000, 0x0008B000, 0x0008B000, 0x0008B000, 0x0008B000, 0x0008A000,
+		0x00079000, 0x00000000, 0x0008B000, 0x0008B000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '"' */
+		0x00000000, 0x00000000, 0x00000000, 0x00A64D00, 0x00A64D00, 0x00A64D00, 0x00A64D00, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '#' */
+		0x00000000, 0x00000000, 0x0C33C000, 0x0960E000, 0x05A0C300, 0xCFFFFFF4, 0x00D25B00, 0x00961E00,
+		0x1FFFFFFF, 0x002D0870, 0x000E25A0, 0x000A52E0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '$' */
+		0x00000000, 0x00000000, 0x00000000, 0x00064000, 0x019EEA10, 0x06674AA0, 0x000646B0, 0x0018AD40,
+		0x06DB7100, 0x0F364000, 0x0D764590, 0x03BEEA30, 0x00064000, 0x00064000, 0x00000000, 0x00000000
+	},
+	{ /* '%' */
+		0x00000000, 0x00000000, 0x00000000, 0x00007EC2, 0x0002C15A, 0x1102C15A, 0x2A827EC3, 0x0029A400,
+		0x1BEA17B3, 0x881A5001, 0x881A5000, 0x1BEA0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '&' */
+		0x00000000, 0x00000000, 0x00000000, 0x008FEB10, 0x00001C70, 0x00001D40, 0x0000BE50, 0x9607C1D3,
+		0x774E2088, 0x2DE500A8, 0x0DD316F3, 0x6D6CEC50, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* ''' */
+		0x00000000, 0x00000000, 0x00000000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '(' */
+		0x00000000, 0x006A0000, 0x000D3000, 0x00089000, 0x0004E000, 0x0001F200, 0x0000F400, 0x0000F400,
+		0x0001F200, 0x0004E000, 0x00089000, 0x000D3000, 0x006A0000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* ')' */
+		0x00000000, 0x00007800, 0x0001E100, 0x0007B000, 0x000B6000, 0x000F4000, 0x001F2000, 0x001F2000,
+		0x000F4000, 0x000C6000, 0x0007B000, 0x0001E100, 0x00007800, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* asterisk */
+		0x00000000, 0x00000000, 0x00000000, 0x00047000, 0x07647490, 0x006CD810, 0x006CD810, 0x07647490,
+		0x00047000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '+' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00079000, 0x00079000, 0x00079000, 0x4FFFFFF7,
+		0x00079000, 0x00079000, 0x00079000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* ',' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x000CC000, 0x000AD000, 0x0004F100, 0x0000C500, 0x00000000, 0x00000000
+	},
+	{ /* '-' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x008FFB00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '.' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x000BD000, 0x000BD000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* slash */
+		0x00000000, 0x00000000, 0x00000000, 0x09900000, 0x02E10000, 0x00B70000, 0x004E0000, 0x000C6000,
+		0x0005D000, 0x0000D500, 0x00007C00, 0x00001E30, 0x000008A0, 0x000002F2, 0x00000000, 0x00000000
+	},
+	{ /* '0' */
+		0x00000000, 0x00000000, 0x00000000, 0x008EEA10, 0x06E32D90, 0x0B8006E0, 0x0E6003F1, 0x0F58A2F2,
+		0x0E6003F1, 0x0B8006E0, 0x06E32D90, 0x008EEA10, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '1' */
+		0x00000000, 0x00000000, 0x00000000, 0x000FFF70, 0x000F4000, 0x000F4000, 0x000F4000, 0x000F4000,
+		0x000F4000, 0x000F4000, 0x000F4000, 0x0EFFFF40, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '2' */
+		0x00000000, 0x00000000, 0x00000000, 0x007DEB40, 0x06E414B0, 0x09B00000, 0x06D00000, 0x00B90000,
+		0x001C8000, 0x0001C800, 0x00001C80, 0x0BFFFFF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '3' */
+		0x00000000, 0x00000000, 0x00000000, 0x007DEB30, 0x05E31490, 0x09A00000, 0x05E30000, 0x008FF800,
+		0x07D30000, 0x0C700000, 0x09D30392, 0x019DEC50, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '4' */
+		0x00000000, 0x00000000, 0x00000000, 0x00ED0000, 0x00EC8000, 0x00E5C300, 0x00E53C00, 0x00E50970,
+		0x00E501D2, 0x3FFFFFF5, 0x00E50000, 0x00E50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '5' */
+		0x00000000, 0x00000000, 0x00000000, 0x02FFFFA0, 0x000007A0, 0x000007A0, 0x007DFEA0, 0x06E51000,
+		0x0A900000, 0x0A900000, 0x05E41291, 0x006DED60, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '6' */
+		0x00000000, 0x00000000, 0x00000000, 0x019FD700, 0x04514D70, 0x000005D0, 0x01AED7F1, 0x0AC12BF2,
+		0x0E5005F2, 0x0E5005E0, 0x09C12C90, 0x01AEEA10, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '7' */
+		0x00000000, 0x00000000, 0x00000000, 0x0CFFFFF2, 0x07C00000, 0x01F30000, 0x00A90000, 0x004E1000,
+		0x000D7000, 0x0007D000, 0x0001F400, 0x0000AA00, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '8' */
+		0x00000000, 0x00000000, 0x00000000, 0x019EEB20, 0x08C21BB0, 0x0B8005E0, 0x06C21A90, 0x00AFFC10,
+		0x0AB119C0, 0x0E5003F2, 0x0CB119E0, 0x02AEEB30, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '9' */
+		0x00000000, 0x00000000, 0x00000000, 0x008EEB20, 0x06E319D0, 0x0B8002F2, 0x0D8002F2, 0x0ED319D0,
+		0x0D8CEB30, 0x0A900000, 0x03E51460, 0x005CFB20, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* ':' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000BD000, 0x000BD000, 0x00000000,
+		0x00000000, 0x00000000, 0x000BD000, 0x000BD000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* ';' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000BD000, 0x000BD000, 0x00000000,
+		0x00000000, 0x00000000, 0x000CC000, 0x000AD000, 0x0004F100, 0x0000C500, 0x00000000, 0x00000000
+	},
+	{ /* '<' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4B500000, 0x16BE9300, 0x00016CD4,
+		0x00016CD4, 0x15BE9300, 0x4B500000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '=' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4FFFFFF7, 0x00000000,
+		0x00000000, 0x4FFFFFF7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '>' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000004A6, 0x0028DC61, 0x2CD72000,
+		0x2CD72000, 0x0028DC61, 0x000004A6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '?' */
+		0x00000000, 0x00000000, 0x00000000, 0x01AED910, 0x07D21660, 0x07C00000, 0x01BA0000, 0x000A9000,
+		0x0005D000, 0x00000000, 0x0006E000, 0x0006E000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '@' */
+		0x00000000, 0x00000000, 0x00000000, 0x03CED700, 0x1D513B90, 0x590000D3, 0x7ADE6079, 0x7C12D34B,
+		0x7700A52C, 0x7C12D33B, 0x7ADE6078, 0x000001D3, 0x00014D70, 0x06EEB500, 0x00000000, 0x00000000
+	},
+	{ /* 'A' */
+		0x00000000, 0x00000000, 0x00000000, 0x000DF100, 0x003ED500, 0x007B8A00, 0x00C74E10, 0x02F20E50,
+		0x07D00BA0, 0x0CFFFFE0, 0x2F4001F4, 0x6E0000B9, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'B' */
+		0x00000000, 0x00000000, 0x00000000, 0x01AEFFE0, 0x0AB105E0, 0x0D7005E0, 0x09B205E0, 0x01CFFFE0,
+		0x0D8105E0, 0x3F2005E0, 0x1E8105E0, 0x04CEFFE0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'C' */
+		0x00000000, 0x00000000, 0x00000000, 0x04CFC500, 0x09316E50, 0x000009C0, 0x000005F1, 0x000004F2,
+		0x000005F0, 0x000009C0, 0x08316F40, 0x04CFC500, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'D' */
+		0x00000000, 0x00000000, 0x00000000, 0x004BEFF2, 0x04F622F2, 0x0B9002F2, 0x0E6002F2, 0x0F5002F2,
+		0x0E6002F2, 0x0B9002F2, 0x04F612F2, 0x004BEFF2, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'E' */
+		0x00000000, 0x00000000, 0x00000000, 0x0DFFFFB0, 0x000008B0, 0x000008B0, 0x000008B0, 0x0AFFFFB0,
+		0x000008B0, 0x000008B0, 0x000008B0, 0x0FFFFFB0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'F' */
+		0x00000000, 0x00000000, 0x00000000, 0x1FFFFF80, 0x00000C80, 0x00000C80, 0x00000C80, 0x0AFFFF80,
+		0x00000C80, 0x00000C80, 0x00000C80, 0x00000C80, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'G' */
+		0x00000000, 0x00000000, 0x00000000, 0x02BED700, 0x07414D80, 0x000005F1, 0x000001F4, 0x0FF900F5,
+		0x0F3001F3, 0x0F3005E1, 0x0F613D80, 0x06CFD800, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'H' */
+		0x00000000, 0x00000000, 0x00000000, 0x0E5002F2, 0x0E5002F2, 0x0E5002F2, 0x0E5002F2, 0x0EFFFFF2,
+		0x0E5002F2, 0x0E5002F2, 0x0E5002F2, 0x0E5002F2, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'I' */
+		0x00000000, 0x00000000, 0x00000000, 0x08FFFFB0, 0x0008B000, 0x0008B000, 0x0008B000, 0x0008B000,
+		0x0008B000, 0x0008B000, 0x0008B000, 0x08FFFFB0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'J' */
+		0x00000000, 0x00000000, 0x00000000, 0x01FFF900, 0x01F30000, 0x01F30000, 0x01F30000, 0x01F30000,
+		0x01F30000, 0x00E50014, 0x00AB13C5, 0x002BED81, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'K' */
+		0x00000000, 0x00000000, 0x00000000, 0x3E5002F2, 0x03E502F2, 0x003E52F2, 0x0004F8F2, 0x0009DEF2,
+		0x004F34F2, 0x01E702F2, 0x0BC002F2, 0x6E2002F2, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'L' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000AA0, 0x00000AA0, 0x00000AA0, 0x00000AA0, 0x00000AA0,
+		0x00000AA0, 0x00000AA0, 0x00000AA0, 0x4FFFFFA0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'M' */
+		0x00000000, 0x00000000, 0x00000000, 0x4F9007F7, 0x4ED00CD7, 0x4E952CB7, 0x4E4A77B7, 0x4E0DC2B7,
+		0x4E08B0B7, 0x4E0000B7, 0x4E0000B7, 0x4E0000B7, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'N' */
+		0x00000000, 0x00000000, 0x00000000, 0x0E400BF2, 0x0E402EF2, 0x0E4099F2, 0x0E41E3F2, 0x0E4792F2,
+		0x0E5D32F2, 0x0E9C02F2, 0x0EE502F2, 0x0ED002F2, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'O' */
+		0x00000000, 0x00000000, 0x00000000, 0x009EEA10, 0x07D32CA0, 0x0D7004F1, 0x0F4002F3, 0x1F4001F4,
+		0x0F4002F3, 0x0D7004F1, 0x07D21BA0, 0x009EEA10, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'P' */
+		0x00000000, 0x00000000, 0x00000000, 0x02BEFFB0, 0x0DA108B0, 0x3F3008B0, 0x3F3008B0, 0x0DA108B0,
+		0x03BEFFB0, 0x000008B0, 0x000008B0, 0x000008B0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'Q' */
+		0x00000000, 0x00000000, 0x00000000, 0x009EEA10, 0x07D32CA0, 0x0D7004F1, 0x0F4002F3, 0x1F4001F4,
+		0x0F4002F3, 0x0D7004F1, 0x07D21BA0, 0x00AFEA10, 0x02E70000, 0x04A00000, 0x00000000, 0x00000000
+	},
+	{ /* 'R' */
+		0x00000000, 0x00000000, 0x00000000, 0x008DFFF1, 0x08E303F1, 0x0B9003F1, 0x07D203F1, 0x007FFFF1,
+		0x01E703F1, 0x09B003F1, 0x2F4003F1, 0x9C0003F1, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'S' */
+		0x00000000, 0x00000000, 0x00000000, 0x018DEA20, 0x056119C0, 0x000002F1, 0x00003AD0, 0x019EE920,
+		0x0BB20000, 0x0E400000, 0x0BB213A0, 0x02AEEB40, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'T' */
+		0x00000000, 0x00000000, 0x00000000, 0x8FFFFFFB, 0x0008B000, 0x0008B000, 0x0008B000, 0x0008B000,
+		0x0008B000, 0x0008B000, 0x0008B000, 0x0008B000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'U' */
+		0x00000000, 0x00000000, 0x00000000, 0x0D6003F1, 0x0D6003F1, 0x0D6003F1, 0x0D6003F1, 0x0D6003F1,
+		0x0D6003F1, 0x0D6003F0, 0x09C21AB0, 0x019EEA20, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'V' */
+		0x00000000, 0x00000000, 0x00000000, 0x5F0000C7, 0x1E4002F3, 0x0A8006D0, 0x06D00A80, 0x01F20E40,
+		0x00C63E00, 0x007A7A00, 0x002EC500, 0x000DF100, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'W' */
+		0x00000000, 0x00000000, 0x00000000, 0xB700005E, 0x9900006C, 0x6B000089, 0x4D0AD0A7, 0x2F0DC2C4,
+		0x0E4B86E2, 0x0CA74AE0, 0x0AE31EC0, 0x07E00BA0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'X' */
+		0x00000000, 0x00000000, 0x00000000, 0x3F3003F2, 0x07C00C70, 0x00C77C00, 0x003EE300, 0x000DD100,
+		0x007CB800, 0x02E32E40, 0x0B9007D1, 0x6E1000C8, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'Y' */
+		0x00000000, 0x00000000, 0x00000000, 0x4E2000D7, 0x0AA007C0, 0x02E41E40, 0x007CAA00, 0x000CE100,
+		0x0008B000, 0x0008B000, 0x0008B000, 0x0008B000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'Z' */
+		0x00000000, 0x00000000, 0x00000000, 0x4FFFFFD0, 0x1D800000, 0x03F30000, 0x007D1000, 0x000C9000,
+		0x0002E400, 0x00006D10, 0x00000AA0, 0x6FFFFFF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '[' */
+		0x00000000, 0x009FF100, 0x0002F100, 0x0002F100, 0x0002F100, 0x0002F100, 0x0002F100, 0x0002F100,
+		0x0002F100, 0x0002F100, 0x0002F100, 0x0002F100, 0x009FF100, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* backslash */
+		0x00000000, 0x00000000, 0x00000000, 0x000002F2, 0x000008A0, 0x00001E30, 0x00007C00, 0x0000D500,
+		0x0005D000, 0x000C6000, 0x004E1000, 0x00B70000, 0x02E10000, 0x09900000, 0x00000000, 0x00000000
+	},
+	{ /* ']' */
+		0x00000000, 0x000DFC00, 0x000D4000, 0x000D4000, 0x000D4000, 0x000D4000, 0x000D4000, 0x000D4000,
+		0x000D4000, 0x000D4000, 0x000D4000, 0x000D4000, 0x000DFC00, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '^' */
+		0x00000000, 0x00000000, 0x00000000, 0x000CE100, 0x008CAB00, 0x04D10C70, 0x1D3001D3, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '_' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCFFFFFFF, 0x00000000
+	},
+	{ /* '`' */
+		0x00000000, 0x00000000, 0x00007A00, 0x0006A000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'a' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x008EEA20, 0x06D21580, 0x0A700000,
+		0x0BFFEC40, 0x0B8016F1, 0x0BD404F1, 0x0B8BFD60, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'b' */
+		0x00000000, 0x000006C0, 0x000006C0, 0x000006C0, 0x000006C0, 0x01AED8C0, 0x09B13DC0, 0x0E5008C0,
+		0x0F3006C0, 0x0E4008C0, 0x09B13DC0, 0x01AED8C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'c' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03CEC400, 0x07316F30, 0x00000A90,
+		0x000008B0, 0x00000A90, 0x07215F30, 0x03CEC400, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'd' */
+		0x00000000, 0x09800000, 0x09800000, 0x09800000, 0x09800000, 0x09ACEB20, 0x09F419C0, 0x09A002F1,
+		0x099001F3, 0x09A002F1, 0x09F419B0, 0x099BEB20, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'e' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x019ED910, 0x09A12BA0, 0x0E3003F1,
+		0x1FFFFFF3, 0x000001F1, 0x09512AA0, 0x03AED810, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'f' */
+		0x00000000, 0x0BFC2000, 0x00099000, 0x0005C000, 0x0004D000, 0x0BFFFFC0, 0x0004D000, 0x0004D000,
+		0x0004D000, 0x0004D000, 0x0004D000, 0x0004D000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'g' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09ABEB20, 0x09E41AB0, 0x09A002F1,
+		0x099001F3, 0x09A002F1, 0x09E41AB0, 0x09ABEB20, 0x07A00000, 0x03E31650, 0x005DE910, 0x00000000
+	},
+	{ /* 'h' */
+		0x00000000, 0x000006C0, 0x000006C0, 0x000006C0, 0x000006C0, 0x01BEC8C0, 0x07C12DC0, 0x0A8007C0,
+		0x0A8006C0, 0x0A8006C0, 0x0A8006C0, 0x0A8006C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'i' */
+		0x00000000, 0x00098000, 0x00000000, 0x00000000, 0x00000000, 0x0009FF60, 0x00098000, 0x00098000,
+		0x00098000, 0x00098000, 0x00098000, 0x0EFFFFD0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'j' */
+		0x00000000, 0x000F3000, 0x00000000, 0x00000000, 0x00000000, 0x000FFF30, 0x000F3000, 0x000F3000,
+		0x000F3000, 0x000F3000, 0x000F3000, 0x000F3000, 0x000E3000, 0x000C8000, 0x0003DFC0, 0x00000000
+	},
+	{ /* 'k' */
+		0x00000000, 0x00000B80, 0x00000B80, 0x00000B80, 0x00000B80, 0x0AB10B80, 0x009B1B80, 0x000ACC80,
+		0x002EAF80, 0x00B90B80, 0x08D10B80, 0x4E300B80, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'l' */
+		0x00000000, 0x0001FFF0, 0x0001F200, 0x0001F200, 0x0001F200, 0x0001F200, 0x0001F200, 0x0001F200,
+		0x0001F200, 0x0001F100, 0x0006D000, 0x08FD4000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'm' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09E7DDD5, 0x1F1AC1E5, 0x3D0790C5,
+		0x3D0790B5, 0x3D0790B5, 0x3D0790B5, 0x3D0790B5, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'n' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01BEC8C0, 0x07C12DC0, 0x0A8007C0,
+		0x0A8006C0, 0x0A8006C0, 0x0A8006C0, 0x0A8006C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'o' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x008DEA10, 0x07D21BA0, 0x0C6004F0,
+		0x0E5002F1, 0x0C6004F0, 0x07D21BA0, 0x009EEA10, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'p' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01AED9C0, 0x09C13DC0, 0x0E5008C0,
+		0x0F3006C0, 0x0E5008C0, 0x09C12DC0, 0x01AED8C0, 0x000006C0, 0x000006C0, 0x000006C0, 0x00000000
+	},
+	{ /* 'q' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0B9CEA10, 0x0BE31BA0, 0x0B9003F0,
+		0x0B8002F1, 0x0B9003F0, 0x0BE31BA0, 0x0B9CEB10, 0x0B700000, 0x0B700000, 0x0B700000, 0x00000000
+	},
+	{ /* 'r' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5FFB9B00, 0x0015EB00, 0x00009B00,
+		0x00007B00, 0x00007B00, 0x00007B00, 0x00007B00, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 's' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007DEA10, 0x02811C80, 0x00001B80,
+		0x008CC810, 0x06C10000, 0x06D21580, 0x009EEA20, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 't' */
+		0x00000000, 0x00000000, 0x00000000, 0x0000D400, 0x0000D400, 0x08FFFFF3, 0x0000D400, 0x0000D400,
+		0x0000D400, 0x0000D400, 0x0003F200, 0x08FE8000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'u' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0A8006C0, 0x0A8006C0, 0x0A8006C0,
+		0x0A8006C0, 0x0A9007B0, 0x0AE31B90, 0x0A9BFC20, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'v' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1E3001E3, 0x0A8006C0, 0x04D00B70,
+		0x00E41F20, 0x00996B00, 0x003EC600, 0x000DF100, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'w' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xB700004D, 0x7A00007A, 0x3D08B0B6,
+		0x0F1CC1E3, 0x0B6A87E0, 0x08D63EB0, 0x04F20E70, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'x' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0B9006D1, 0x01D53E30, 0x003ED500,
+		0x000BD000, 0x006CA900, 0x03E21D60, 0x1D6003E3, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* 'y' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2F2001F2, 0x0B7007C0, 0x05D00D60,
+		0x01E44E10, 0x009A9900, 0x003EE300, 0x000DD000, 0x0007B000, 0x0002F400, 0x00006EC0, 0x00000000
+	},
+	{ /* 'z' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09FFFF80, 0x04D20000, 0x006C1000,
+		0x0009A000, 0x0000B800, 0x00001D50, 0x09FFFFB0, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '{' */
+		0x00000000, 0x06FC2000, 0x001B8000, 0x0008A000, 0x0008A000, 0x0006D200, 0x0000CF90, 0x0005E300,
+		0x0008B000, 0x0008A000, 0x00089000, 0x001B8000, 0x06FC2000, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '|' */
+		0x00000000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000,
+		0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x0007A000, 0x00000000, 0x00000000
+	},
+	{ /* '}' */
+		0x00000000, 0x0001BE90, 0x0005D100, 0x0007B000, 0x0007B000, 0x001B9000, 0x06FD2000, 0x002D8000,
+		0x0008A000, 0x0007B000, 0x0006B000, 0x0005D200, 0x0000BE90, 0x00000000, 0x00000000, 0x00000000
+	},
+	{ /* '~' */
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4614BEB2,
+		0x19EB4145, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+	}
+};
+
+/************************************************************************/
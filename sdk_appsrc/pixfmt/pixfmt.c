@@ -0,0 +1,424 @@
+/************************************************************************/
+/*																		*/
+/*	pixfmt.c	--	Framebuffer pixel formats and conversion			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Format properties, the RGB888 to and from XRGB8888 line			*/
+/*		converters and their self check. See pixfmt.h.					*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "pixfmt.h"
+#include "xstatus.h"
+#include "../blit/blit.h"
+#include "../ocm/ocm.h"
+#include <string.h>
+
+#ifdef __linux__
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <time.h>
+ #define PIXFMT_PRINTF printf
+#else
+ #include "../uart_ps/uart_ps.h"
+ #define PIXFMT_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Self check: the most pixels converted, and the guard words kept around
+ * them
+ */
+#define PIXFMT_CHECK_MAX 37
+#define PIXFMT_CHECK_GUARD 4
+#define PIXFMT_CHECK_WORDS (PIXFMT_CHECK_MAX + 2 * PIXFMT_CHECK_GUARD)
+
+/*
+ * Frame converted by the host program, and its runs of each test
+ */
+#define PIXFMT_HOST_W 1920
+#define PIXFMT_HOST_H 1080
+#define PIXFMT_HOST_REPS 20
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static u8 checkPacked[PIXFMT_CHECK_WORDS * 4];
+static u32 checkWords[PIXFMT_CHECK_WORDS];
+static u8 checkRefPacked[PIXFMT_CHECK_WORDS * 4];
+static u32 checkRefWords[PIXFMT_CHECK_WORDS];
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	PixFmtBytes(PixFmt fmt)
+**
+**	Parameters:
+**		fmt - Pixel format
+**
+**	Return Value: u32
+**		Bytes per pixel
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 PixFmtBytes(PixFmt fmt)
+{
+	return (fmt == PIXFMT_XRGB8888) ? 4 : 3;
+}
+/* ------------------------------------------------------------ */
+
+/***	PixFmtName(PixFmt fmt)
+**
+**	Parameters:
+**		fmt - Pixel format
+**
+**	Return Value: const char *
+**		Name of the format, for printing
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+const char *PixFmtName(PixFmt fmt)
+{
+	return (fmt == PIXFMT_XRGB8888) ? "XRGB8888" : "RGB888";
+}
+/* ------------------------------------------------------------ */
+
+/***	PixFmtFromStreamWidth(u32 bits, PixFmt *fmtPtr)
+**
+**	Parameters:
+**		bits - tdata width of a VDMA video stream
+**		fmtPtr - Set to the format of frames carried by the stream
+**
+**	Return Value: int
+**		XST_SUCCESS if successful, XST_FAILURE if no format has pixels of
+**		that width
+**
+**	Errors:
+**
+**	Description:
+**		The VDMA copies the stream to memory and back unchanged, so the
+**		frames it moves are in the format of one stream word per pixel.
+**
+*/
+int PixFmtFromStreamWidth(u32 bits, PixFmt *fmtPtr)
+{
+	switch (bits)
+	{
+	case 24:
+		*fmtPtr = PIXFMT_RGB888;
+		return XST_SUCCESS;
+	case 32:
+		*fmtPtr = PIXFMT_XRGB8888;
+		return XST_SUCCESS;
+	default:
+		return XST_FAILURE;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	PixFmtUnpack(u32 *dst, const u8 *src, u32 pixels)
+**
+**	Parameters:
+**		dst - XRGB8888 pixels, word aligned
+**		src - RGB888 pixels, any alignment
+**		pixels - Number of pixels
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Converts a run of RGB888 pixels to XRGB8888.
+**
+*/
+OCM_TEXT void PixFmtUnpack(u32 *dst, const u8 *src, u32 pixels)
+{
+	u32 w0, w1, w2;
+
+	/*
+	 * Four pixels are three little endian words, loaded separately so they
+	 * stay in registers:
+	 * w0 = B1 R0 G0 B0, w1 = G2 B2 R1 G1, w2 = R3 G3 B3 R2
+	 */
+	while (pixels >= 4)
+	{
+		memcpy(&w0, src, 4);
+		memcpy(&w1, src + 4, 4);
+		memcpy(&w2, src + 8, 4);
+		dst[0] = w0 & 0xFFFFFF;
+		dst[1] = (w0 >> 24) | ((w1 & 0xFFFF) << 8);
+		dst[2] = (w1 >> 16) | ((w2 & 0xFF) << 16);
+		dst[3] = w2 >> 8;
+		src += 12;
+		dst += 4;
+		pixels -= 4;
+	}
+	while (pixels > 0)
+	{
+		*dst++ = src[0] | (src[1] << 8) | (src[2] << 16);
+		src += 3;
+		pixels--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	PixFmtPack(u8 *dst, const u32 *src, u32 pixels)
+**
+**	Parameters:
+**		dst - RGB888 pixels, any alignment
+**		src - XRGB8888 pixels, word aligned
+**		pixels - Number of pixels
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Converts a run of XRGB8888 pixels to RGB888, dropping the unused
+**		byte.
+**
+*/
+OCM_TEXT void PixFmtPack(u8 *dst, const u32 *src, u32 pixels)
+{
+	u32 w0, w1, w2;
+	u32 p;
+
+	while (pixels >= 4)
+	{
+		w0 = (src[0] & 0xFFFFFF) | (src[1] << 24);
+		w1 = ((src[1] >> 8) & 0xFFFF) | (src[2] << 16);
+		w2 = ((src[2] >> 16) & 0xFF) | (src[3] << 8);
+		memcpy(dst, &w0, 4);
+		memcpy(dst + 4, &w1, 4);
+		memcpy(dst + 8, &w2, 4);
+		src += 4;
+		dst += 12;
+		pixels -= 4;
+	}
+	while (pixels > 0)
+	{
+		p = *src++;
+		dst[0] = (u8) p;
+		dst[1] = (u8) (p >> 8);
+		dst[2] = (u8) (p >> 16);
+		dst += 3;
+		pixels--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	PixFmtConvert(u8 *dst, PixFmt dstFmt, u32 dstStride, const u8 *src, PixFmt srcFmt, u32 srcStride, u32 width, u32 height)
+**
+**	Parameters:
+**		dst - First destination line
+**		dstFmt - Format of the destination
+**		dstStride - Bytes between destination lines
+**		src - First source line
+**		srcFmt - Format of the source
+**		srcStride - Bytes between source lines
+**		width, height - Size of the frame in pixels
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Copies a frame between two formats, or plainly with BlitCopy2D
+**		if they are the same. XRGB8888 lines must be word aligned. Does
+**		no cache maintenance; callers bracket it with fb_policy like a
+**		kernel.
+**
+*/
+void PixFmtConvert(u8 *dst, PixFmt dstFmt, u32 dstStride, const u8 *src, PixFmt srcFmt, u32 srcStride, u32 width, u32 height)
+{
+	if (dstFmt == srcFmt)
+	{
+		BlitCopy2D(dst, dstStride, src, srcStride, width * PixFmtBytes(srcFmt), height);
+		return;
+	}
+
+	while (height > 0)
+	{
+		if (dstFmt == PIXFMT_XRGB8888)
+		{
+			PixFmtUnpack((u32 *) dst, src, width);
+		}
+		else
+		{
+			PixFmtPack(dst, (const u32 *) src, width);
+		}
+		dst += dstStride;
+		src += srcStride;
+		height--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Fills the check buffers with a pattern, the words with the top byte
+ * clear as an XRGB8888 frame has it
+ */
+static void PixFmtCheckReset(void)
+{
+	u32 i;
+
+	for (i = 0; i < sizeof(checkPacked); i++)
+	{
+		checkPacked[i] = (u8) (i * 7 + 1);
+		checkRefPacked[i] = checkPacked[i];
+	}
+	for (i = 0; i < PIXFMT_CHECK_WORDS; i++)
+	{
+		checkWords[i] = (i * 0x00130B05u + 0x00010203u) & 0xFFFFFF;
+		checkRefWords[i] = checkWords[i];
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	PixFmtCheck()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of failed cases, 0 if both converters matched
+**
+**	Errors:
+**
+**	Description:
+**		Runs both converters against a byte loop for every pixel count
+**		up to PIXFMT_CHECK_MAX and every alignment of the RGB888 side,
+**		and checks nothing outside the destination was written.
+**		Failures are printed.
+**
+*/
+u32 PixFmtCheck()
+{
+	u32 failures = 0;
+	u32 off, n, i;
+	u8 *packed, *refPacked;
+	u32 *words, *refWords;
+
+	for (off = 0; off < 4; off++)
+	{
+		for (n = 0; n <= PIXFMT_CHECK_MAX; n++)
+		{
+			packed = checkPacked + PIXFMT_CHECK_GUARD * 4 + off;
+			refPacked = checkRefPacked + PIXFMT_CHECK_GUARD * 4 + off;
+			words = checkWords + PIXFMT_CHECK_GUARD;
+			refWords = checkRefWords + PIXFMT_CHECK_GUARD;
+
+			PixFmtCheckReset();
+			PixFmtUnpack(words, packed, n);
+			for (i = 0; i < n; i++)
+			{
+				refWords[i] = packed[i * 3] | (packed[i * 3 + 1] << 8) | (packed[i * 3 + 2] << 16);
+			}
+			if (memcmp(checkWords, checkRefWords, sizeof(checkWords)) != 0)
+			{
+				PIXFMT_PRINTF("PixFmtUnpack FAILED: src+%lu, %lu pixels\n\r", (unsigned long) off, (unsigned long) n);
+				failures++;
+			}
+
+			PixFmtCheckReset();
+			PixFmtPack(packed, words, n);
+			for (i = 0; i < n * 3; i++)
+			{
+				refPacked[i] = (u8) (words[i / 3] >> (8 * (i % 3)));
+			}
+			if (memcmp(checkPacked, checkRefPacked, sizeof(checkPacked)) != 0)
+			{
+				PIXFMT_PRINTF("PixFmtPack FAILED: dst+%lu, %lu pixels\n\r", (unsigned long) off, (unsigned long) n);
+				failures++;
+			}
+		}
+	}
+
+	return failures;
+}
+
+#if defined(__linux__) && defined(PIXFMT_MAIN)
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 PixFmtUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int main(void)
+{
+	const u32 packedStride = PIXFMT_HOST_W * 3;
+	const u32 wordStride = PIXFMT_HOST_W * 4;
+	u8 *packed, *words;
+	u32 failures, r, i;
+	u64 start, us;
+
+	failures = PixFmtCheck();
+	printf("Self check: %lu failure(s)\n\n", (unsigned long) failures);
+
+	if (posix_memalign((void **) &packed, 64, packedStride * PIXFMT_HOST_H) != 0 ||
+			posix_memalign((void **) &words, 64, wordStride * PIXFMT_HOST_H) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < packedStride * PIXFMT_HOST_H; i++)
+	{
+		packed[i] = (u8) (i * 7);
+	}
+	memset(words, 0, wordStride * PIXFMT_HOST_H);
+
+	printf("%-24s %8s %8s\n", "Conversion", "Mpix/s", "ms/frame");
+
+	start = PixFmtUs();
+	for (r = 0; r < PIXFMT_HOST_REPS; r++)
+	{
+		PixFmtConvert(words, PIXFMT_XRGB8888, wordStride, packed, PIXFMT_RGB888, packedStride, PIXFMT_HOST_W, PIXFMT_HOST_H);
+	}
+	us = PixFmtUs() - start;
+	printf("%-24s %8.1f %8.2f\n", "RGB888 to XRGB8888", (double) PIXFMT_HOST_W * PIXFMT_HOST_H * PIXFMT_HOST_REPS / us,
+			us / 1000.0 / PIXFMT_HOST_REPS);
+
+	start = PixFmtUs();
+	for (r = 0; r < PIXFMT_HOST_REPS; r++)
+	{
+		PixFmtConvert(packed, PIXFMT_RGB888, packedStride, words, PIXFMT_XRGB8888, wordStride, PIXFMT_HOST_W, PIXFMT_HOST_H);
+	}
+	us = PixFmtUs() - start;
+	printf("%-24s %8.1f %8.2f\n", "XRGB8888 to RGB888", (double) PIXFMT_HOST_W * PIXFMT_HOST_H * PIXFMT_HOST_REPS / us,
+			us / 1000.0 / PIXFMT_HOST_REPS);
+
+	free(packed);
+	free(words);
+
+	return failures ? 1 : 0;
+}
+#endif
+
+/************************************************************************/
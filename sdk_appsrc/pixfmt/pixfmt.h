@@ -0,0 +1,103 @@
+/************************************************************************/
+/*																		*/
+/*	pixfmt.h	--	Framebuffer pixel formats and conversion			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Names the two layouts a framebuffer line can have:				*/
+/*		- PIXFMT_RGB888: 3 bytes per pixel, packed. This is what the	*/
+/*		  VDMA streams carry in this design (24-bit tdata), so the		*/
+/*		  framebuffers are in it.										*/
+/*		- PIXFMT_XRGB8888: 4 bytes per pixel, the fourth unused and		*/
+/*		  kept 0. Every pixel is one aligned 32-bit word, so kernels	*/
+/*		  can load and store whole pixels and vectors of them.			*/
+/*		Either way the channels are in the same byte order, green, blue	*/
+/*		and red, the order in which dvi2rgb and rgb2dvi pack the stream	*/
+/*		word (R[23:16], B[15:8], G[7:0]), so an XRGB8888 pixel read as	*/
+/*		a little endian u32 is 0x00RRBBGG. Kernels name the byte of		*/
+/*		each channel with PIXFMT_G, PIXFMT_B and PIXFMT_R and turn		*/
+/*		0xRRGGBB colors into pixels with PixFmtFromRgb.					*/
+/*																		*/
+/*		DisplayCtrl and VideoCapture take their format from the			*/
+/*		width of the VDMA streams. Until those are widened to 32 bits	*/
+/*		in the PL, kernels working in XRGB8888 convert on the CPU		*/
+/*		with PixFmtConvert. The converters move 4 pixels, 3 words of	*/
+/*		RGB888, per iteration with word loads and shifts and run from	*/
+/*		OCM.															*/
+/*																		*/
+/*		With PIXFMT_MAIN defined on Linux the module builds as a		*/
+/*		stand-alone host program that checks the converters against		*/
+/*		a byte loop and times them over one 1920x1080 frame:			*/
+/*			gcc -O2 -DPIXFMT_MAIN -I<bsp>/include -I. pixfmt/pixfmt.c	*/
+/*				blit/blit.c <bsp>/libsrc/standalone_v6_7/src/xil_mem.c	*/
+/*				-o pixfmt												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Channel order follows dvi2rgb and rgb2dvi			*/
+/*																		*/
+/************************************************************************/
+
+#ifndef PIXFMT_H_
+#define PIXFMT_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Bytes per pixel of the widest format
+ */
+#define PIXFMT_MAX_BYTES 4
+
+/*
+ * Byte of a pixel holding each channel, in either format
+ */
+#define PIXFMT_G 0
+#define PIXFMT_B 1
+#define PIXFMT_R 2
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef enum {
+	PIXFMT_RGB888 = 0, /* 3 bytes per pixel, packed */
+	PIXFMT_XRGB8888 = 1 /* 4 bytes per pixel, top byte unused */
+} PixFmt;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+u32 PixFmtBytes(PixFmt fmt);
+const char *PixFmtName(PixFmt fmt);
+int PixFmtFromStreamWidth(u32 bits, PixFmt *fmtPtr);
+void PixFmtUnpack(u32 *dst, const u8 *src, u32 pixels);
+void PixFmtPack(u8 *dst, const u32 *src, u32 pixels);
+void PixFmtConvert(u8 *dst, PixFmt dstFmt, u32 dstStride, const u8 *src, PixFmt srcFmt, u32 srcStride, u32 width, u32 height);
+u32 PixFmtCheck();
+
+/*
+ * Pixel value of a 0xRRGGBB color: the word whose bytes, lowest first, are
+ * a pixel in memory order
+ */
+static inline u32 PixFmtFromRgb(u32 rgb)
+{
+	return (((rgb >> 16) & 0xFF) << (8 * PIXFMT_R)) | (((rgb >> 8) & 0xFF) << (8 * PIXFMT_G)) | ((rgb & 0xFF) << (8 * PIXFMT_B));
+}
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* PIXFMT_H_ */
@@ -0,0 +1,96 @@
+/************************************************************************/
+/*																		*/
+/*	prof.h	--	Performance counter profiling of code sections			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Measures cycles, L1 data cache misses and instructions spent	*/
+/*		between ProfBegin and ProfEnd, and adds them up per named site.	*/
+/*		Sites are created on first use, so a string literal is enough	*/
+/*		to name one.													*/
+/*																		*/
+/*		On the Zynq the Cortex-A9 PMU event counters are used. When		*/
+/*		built for Linux (for example together with the host benchmark)	*/
+/*		the same counters are read through perf_event_open, so numbers	*/
+/*		from both can be compared. The A9 has no retired instruction	*/
+/*		event; instructions renamed (XPM_EVENT_INSTRRENAME) is counted	*/
+/*		in its place, which includes some speculative instructions.		*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call ProfInit once.											*/
+/*		2) Wrap code with ProfBegin(&mark, "Name") / ProfEnd(&mark).		*/
+/*		3) Call ProfPrint to list the totals, ProfReset to clear them.	*/
+/*		ProfSample reads the raw counters for callers that do their own	*/
+/*		bookkeeping.													*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef PROF_H_
+#define PROF_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define PROF_MAX_SITES 16
+
+/*
+ * Counters recorded per site, in the order they are stored in ProfCounts
+ */
+#define PROF_CYCLES 0
+#define PROF_L1D_MISSES 1
+#define PROF_INSTRS 2
+#define PROF_NUM_COUNTERS 3
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u64 count[PROF_NUM_COUNTERS];
+} ProfCounts;
+
+typedef struct {
+		const char *name; /* NULL if the slot is free */
+		u32 calls;
+		ProfCounts total;
+} ProfSite;
+
+/*
+ * Holds the counter values at ProfBegin until the matching ProfEnd. Usually
+ * a local variable of the function being measured.
+ */
+typedef struct {
+		int site;
+		ProfCounts start;
+} ProfMark;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int ProfInit();
+void ProfSample(ProfCounts *countsPtr);
+void ProfBegin(ProfMark *markPtr, const char *name);
+void ProfEnd(ProfMark *markPtr);
+const ProfSite *ProfGetSite(int index);
+void ProfReset();
+void ProfPrint();
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* PROF_H_ */
@@ -0,0 +1,271 @@
+/************************************************************************/
+/*																		*/
+/*	ref_kernels.c	--	Reference versions of the demo frame functions	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Frozen copies of DemoInvertFrame, DemoScaleFrame and			*/
+/*		DemoPrintTest as they were before any optimization. They do		*/
+/*		not flush the cache or profile themselves. DemoVerify compares	*/
+/*		the output of the functions in video_demo.c against these, so	*/
+/*		these must not be changed when the originals are optimized.		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Channel names follow pixfmt.h						*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "ref_kernels.h"
+#include "../video_demo.h"
+#include "../pixfmt/pixfmt.h"
+#include "xil_printf.h"
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Reference copy of DemoInvertFrame
+ */
+void RefInvertFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride)
+{
+	u32 xcoi, ycoi;
+	u32 lineStart = 0;
+
+	for(ycoi = 0; ycoi < height; ycoi++)
+	{
+		for(xcoi = 0; xcoi < (width * 3); xcoi+=3)
+		{
+			destFrame[xcoi + lineStart] = ~srcFrame[xcoi + lineStart];
+			destFrame[xcoi + lineStart + 1] = ~srcFrame[xcoi + lineStart + 1];
+			destFrame[xcoi + lineStart + 2] = ~srcFrame[xcoi + lineStart + 2];
+		}
+		lineStart += stride;
+	}
+}
+
+/*
+ * Reference copy of DemoScaleFrame. Bilinear interpolation algorithm. Assumes
+ * both frames have the same stride.
+ */
+void RefScaleFrame(u8 *srcFrame, u8 *destFrame, u32 srcWidth, u32 srcHeight, u32 destWidth, u32 destHeight, u32 stride)
+{
+	float xInc, yInc; // Width/height of a destination frame pixel in the source frame coordinate system
+	float xcoSrc, ycoSrc; // Location of the destination pixel being operated on in the source frame coordinate system
+	float x1y1, x2y1, x1y2, x2y2; //Used to store the color data of the four nearest source pixels to the destination pixel
+	int ix1y1, ix2y1, ix1y2, ix2y2; //indexes into the source frame for the four nearest source pixels to the destination pixel
+	float xDist, yDist; //distances between destination pixel and x1y1 source pixels in source frame coordinate system
+
+	u32 xcoDest, ycoDest; // Location of the destination pixel being operated on in the destination coordinate system
+	int iy1; //Used to store the index of the first source pixel in the line with y1
+	int iDest; //index of the pixel data in the destination frame being operated on
+
+	int i;
+
+	xInc = ((float) srcWidth - 1.0) / ((float) destWidth);
+	yInc = ((float) srcHeight - 1.0) / ((float) destHeight);
+
+	ycoSrc = 0.0;
+	for (ycoDest = 0; ycoDest < destHeight; ycoDest++)
+	{
+		iy1 = ((int) ycoSrc) * stride;
+		yDist = ycoSrc - ((float) ((int) ycoSrc));
+
+		/*
+		 * Save some cycles in the loop below by presetting the destination
+		 * index to the first pixel in the current line
+		 */
+		iDest = ycoDest * stride;
+
+		xcoSrc = 0.0;
+		for (xcoDest = 0; xcoDest < destWidth; xcoDest++)
+		{
+			ix1y1 = iy1 + ((int) xcoSrc) * 3;
+			ix2y1 = ix1y1 + 3;
+			ix1y2 = ix1y1 + stride;
+			ix2y2 = ix1y1 + stride + 3;
+
+			xDist = xcoSrc - ((float) ((int) xcoSrc));
+
+			/*
+			 * For loop handles all three colors
+			 */
+			for (i = 0; i < 3; i++)
+			{
+				x1y1 = (float) srcFrame[ix1y1 + i];
+				x2y1 = (float) srcFrame[ix2y1 + i];
+				x1y2 = (float) srcFrame[ix1y2 + i];
+				x2y2 = (float) srcFrame[ix2y2 + i];
+
+				/*
+				 * Bilinear interpolation function
+				 */
+				destFrame[iDest] = (u8) ((1.0-yDist)*((1.0-xDist)*x1y1+xDist*x2y1) + yDist*((1.0-xDist)*x1y2+xDist*x2y2));
+				iDest++;
+			}
+			xcoSrc += xInc;
+		}
+		ycoSrc += yInc;
+	}
+
+	return;
+}
+
+/*
+ * Reference copy of DemoPrintTest
+ */
+void RefPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern)
+{
+	u32 xcoi, ycoi;
+	u32 iPixelAddr;
+	u8 wGreen, wBlue, wRed;
+	u32 wCurrentInt;
+	double fGreen, fBlue, fRed, fColor;
+	u32 xLeft, xMid, xRight, xInt;
+	u32 yMid, yInt;
+	double xInc, yInc;
+
+
+	switch (pattern)
+	{
+	case DEMO_PATTERN_0:
+
+		xInt = width / 4; //Four intervals, each with width/4 pixels
+		xLeft = xInt * 3;
+		xMid = xInt * 2 * 3;
+		xRight = xInt * 3 * 3;
+		xInc = 256.0 / ((double) xInt); //256 color intensities are cycled through per interval (overflow must be caught when color=256.0)
+
+		yInt = height / 2; //Two intervals, each with width/2 lines
+		yMid = yInt;
+		yInc = 256.0 / ((double) yInt); //256 color intensities are cycled through per interval (overflow must be caught when color=256.0)
+
+		fBlue = 0.0;
+		fGreen = 256.0;
+		for(xcoi = 0; xcoi < (width*3); xcoi+=3)
+		{
+			/*
+			 * Convert color intensities to integers < 256, and trim values >=256
+			 */
+			wGreen = (fGreen >= 256.0) ? 255 : ((u8) fGreen);
+			wBlue = (fBlue >= 256.0) ? 255 : ((u8) fBlue);
+			iPixelAddr = xcoi;
+			fRed = 0.0;
+			for(ycoi = 0; ycoi < height; ycoi++)
+			{
+
+				wRed = (fRed >= 256.0) ? 255 : ((u8) fRed);
+				frame[iPixelAddr + PIXFMT_G] = wGreen;
+				frame[iPixelAddr + PIXFMT_B] = wBlue;
+				frame[iPixelAddr + PIXFMT_R] = wRed;
+				if (ycoi < yMid)
+				{
+					fRed += yInc;
+				}
+				else
+				{
+					fRed -= yInc;
+				}
+
+				/*
+				 * This pattern is printed one vertical line at a time, so the address must be incremented
+				 * by the stride instead of just 1.
+				 */
+				iPixelAddr += stride;
+			}
+
+			if (xcoi < xLeft)
+			{
+				fBlue = 0.0;
+				fGreen -= xInc;
+			}
+			else if (xcoi < xMid)
+			{
+				fBlue += xInc;
+				fGreen += xInc;
+			}
+			else if (xcoi < xRight)
+			{
+				fBlue -= xInc;
+				fGreen -= xInc;
+			}
+			else
+			{
+				fBlue += xInc;
+				fGreen = 0;
+			}
+		}
+		break;
+	case DEMO_PATTERN_1:
+
+		xInt = width / 7; //Seven intervals, each with width/7 pixels
+		xInc = 256.0 / ((double) xInt); //256 color intensities per interval. Notice that overflow is handled for this pattern.
+
+		fColor = 0.0;
+		wCurrentInt = 1;
+		for(xcoi = 0; xcoi < (width*3); xcoi+=3)
+		{
+
+			/*
+			 * Just draw white in the last partial interval (when width is not divisible by 7)
+			 */
+			if (wCurrentInt > 7)
+			{
+				wGreen = 255;
+				wBlue = 255;
+				wRed = 255;
+			}
+			else
+			{
+				if (wCurrentInt & 0b001)
+					wGreen = (u8) fColor;
+				else
+					wGreen = 0;
+
+				if (wCurrentInt & 0b010)
+					wBlue = (u8) fColor;
+				else
+					wBlue = 0;
+
+				if (wCurrentInt & 0b100)
+					wRed = (u8) fColor;
+				else
+					wRed = 0;
+			}
+
+			iPixelAddr = xcoi;
+
+			for(ycoi = 0; ycoi < height; ycoi++)
+			{
+				frame[iPixelAddr + PIXFMT_G] = wGreen;
+				frame[iPixelAddr + PIXFMT_B] = wBlue;
+				frame[iPixelAddr + PIXFMT_R] = wRed;
+				/*
+				 * This pattern is printed one vertical line at a time, so the address must be incremented
+				 * by the stride instead of just 1.
+				 */
+				iPixelAddr += stride;
+			}
+
+			fColor += xInc;
+			if (fColor >= 256.0)
+			{
+				fColor = 0.0;
+				wCurrentInt++;
+			}
+		}
+		break;
+	default :
+		xil_printf("Error: invalid pattern passed to RefPrintTest");
+	}
+}
+
+/************************************************************************/
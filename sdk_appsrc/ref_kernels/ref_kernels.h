@@ -0,0 +1,42 @@
+/************************************************************************/
+/*																		*/
+/*	ref_kernels.h	--	Reference versions of the demo frame functions	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Frozen copies of DemoInvertFrame, DemoScaleFrame and			*/
+/*		DemoPrintTest as they were before any optimization. They do		*/
+/*		not flush the cache or profile themselves. DemoVerify compares	*/
+/*		the output of the functions in video_demo.c against these, so	*/
+/*		these must not be changed when the originals are optimized.		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef REF_KERNELS_H_
+#define REF_KERNELS_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void RefInvertFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride);
+void RefScaleFrame(u8 *srcFrame, u8 *destFrame, u32 srcWidth, u32 srcHeight, u32 destWidth, u32 destHeight, u32 stride);
+void RefPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* REF_KERNELS_H_ */
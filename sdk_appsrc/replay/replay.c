@@ -0,0 +1,988 @@
+/************************************************************************/
+/*																		*/
+/*	replay.c	--	Recorded stream replay into the capture frame store	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Plays raw RGB, PPM or Y4M files as the input of the hwsim		*/
+/*		register model. See replay.h for usage. Only built for Linux;	*/
+/*		on the Zynq this file is empty.									*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added the REPLAY_MAIN host program					*/
+/*		10/19/2026: Channels written in PIXFMT_R, G and B order			*/
+/*																		*/
+/************************************************************************/
+
+#ifdef __linux__
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "replay.h"
+#include "../pixfmt/pixfmt.h"
+#include "xstatus.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef REPLAY_MAIN
+ #include <unistd.h>
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Local Type Definitions							*/
+/* ------------------------------------------------------------ */
+
+#define REPLAY_Y4M_LINE_MAX 256
+#define REPLAY_Y4M_FRAME_HEADER "FRAME\n"
+
+/*
+ * Blanking added to file sizes that match none of the known modes
+ */
+#define REPLAY_H_BLANK 160
+#define REPLAY_V_BLANK 45
+
+#ifdef REPLAY_MAIN
+/*
+ * Frame stores of the host program, large enough for the 800x600 mode it
+ * switches to
+ */
+#define REPLAY_HOST_STRIDE (800 * 3)
+#define REPLAY_HOST_FRAME_SIZE (800 * 600 * 3)
+
+/*
+ * Size of the files the host program writes, frames in its PPM file and
+ * the blue step between them, bars in its Y4M file and how far converted
+ * bars may be from their RGB values
+ */
+#define REPLAY_HOST_W 640
+#define REPLAY_HOST_H 480
+#define REPLAY_HOST_PPM_FRAMES 4
+#define REPLAY_HOST_BLUE_STEP 50
+#define REPLAY_HOST_BARS 5
+#define REPLAY_HOST_YUV_TOL 2
+
+#define REPLAY_HOST_TEMPLATE "/tmp/replayXXXXXX"
+
+typedef struct {
+		const char *name;
+		u8 yuv[3]; /* BT.601 limited range Y, Cb, Cr */
+		u8 rgb[3]; /* R, G, B */
+} ReplayHostBar;
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static const VideoMode *const replayModes[] = {
+	&VMODE_640x480,
+	&VMODE_800x600,
+	&VMODE_1280x720,
+	&VMODE_1280x1024,
+	&VMODE_1600x900,
+	&VMODE_1920x1080
+};
+
+#ifdef REPLAY_MAIN
+static const ReplayHostBar replayHostBars[REPLAY_HOST_BARS] = {
+	{"white bar", {235, 128, 128}, {255, 255, 255}},
+	{"black bar", {16, 128, 128}, {0, 0, 0}},
+	{"red bar", {81, 90, 240}, {255, 0, 0}},
+	{"green bar", {145, 54, 34}, {0, 255, 0}},
+	{"blue bar", {41, 240, 110}, {0, 0, 255}}
+};
+
+static XAxiVdma hostVdma;
+static VideoCapture hostVideo;
+static INTC hostIntc;
+static u32 hostCallbacks;
+static u8 hostFrames[VIDEO_NUM_FRAMES][REPLAY_HOST_FRAME_SIZE];
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Reads the next unsigned decimal number of a PPM header, skipping
+ * whitespace and comments. Returns 0 if there is none.
+ */
+static int ReplayPpmNumber(FILE *file, u32 *valuePtr)
+{
+	int c;
+	int fDigits = 0;
+
+	do
+	{
+		c = fgetc(file);
+		if (c == '#')
+		{
+			while (c != '\n' && c != EOF)
+			{
+				c = fgetc(file);
+			}
+		}
+	} while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+
+	*valuePtr = 0;
+	while (c >= '0' && c <= '9')
+	{
+		*valuePtr = *valuePtr * 10 + (c - '0');
+		fDigits = 1;
+		c = fgetc(file);
+	}
+
+	/*
+	 * c is the single whitespace character that ends the number
+	 */
+	return fDigits && (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+}
+
+static int ReplayOpenPpm(ReplaySource *replayPtr)
+{
+	u32 maxVal;
+
+	if (fgetc(replayPtr->file) != 'P' || fgetc(replayPtr->file) != '6' ||
+			!ReplayPpmNumber(replayPtr->file, &replayPtr->width) ||
+			!ReplayPpmNumber(replayPtr->file, &replayPtr->height) ||
+			!ReplayPpmNumber(replayPtr->file, &maxVal) || maxVal != 255)
+	{
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Concatenated images are assumed to repeat the same header
+	 */
+	replayPtr->dataStart = 0;
+	replayPtr->headerBytes = ftell(replayPtr->file);
+	replayPtr->frameBytes = replayPtr->headerBytes + (long) replayPtr->width * replayPtr->height * 3;
+	return XST_SUCCESS;
+}
+
+static int ReplayOpenY4m(ReplaySource *replayPtr)
+{
+	char line[REPLAY_Y4M_LINE_MAX];
+	char *tok;
+	u32 rateNum = 0, rateDen = 0;
+	long w, h, planeBytes;
+
+	if (fgets(line, sizeof(line), replayPtr->file) == NULL ||
+			strncmp(line, "YUV4MPEG2 ", 10) != 0 || strchr(line, '\n') == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	replayPtr->chromaShift = 1;
+	for (tok = strtok(line + 10, " \n"); tok != NULL; tok = strtok(NULL, " \n"))
+	{
+		switch (tok[0])
+		{
+		case 'W':
+			replayPtr->width = strtoul(tok + 1, NULL, 10);
+			break;
+		case 'H':
+			replayPtr->height = strtoul(tok + 1, NULL, 10);
+			break;
+		case 'F':
+			if (sscanf(tok + 1, "%u:%u", &rateNum, &rateDen) != 2)
+			{
+				rateNum = 0;
+			}
+			break;
+		case 'C':
+			if (strncmp(tok + 1, "444", 3) == 0 && tok[4] != 'a')
+			{
+				replayPtr->chromaShift = 0;
+			}
+			else if (strncmp(tok + 1, "420", 3) != 0)
+			{
+				return XST_FAILURE;
+			}
+			break;
+		case 'I':
+			if (tok[1] != 'p' && tok[1] != '?')
+			{
+				return XST_FAILURE;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (rateNum != 0 && rateDen != 0)
+	{
+		replayPtr->filePeriodNs = (u32) (((u64) rateDen * 1000000000) / rateNum);
+	}
+
+	w = replayPtr->width;
+	h = replayPtr->height;
+	planeBytes = ((w + replayPtr->chromaShift) >> replayPtr->chromaShift) *
+			((h + replayPtr->chromaShift) >> replayPtr->chromaShift);
+
+	replayPtr->dataStart = ftell(replayPtr->file);
+	replayPtr->headerBytes = strlen(REPLAY_Y4M_FRAME_HEADER);
+	replayPtr->frameBytes = replayPtr->headerBytes + w * h + 2 * planeBytes;
+	return XST_SUCCESS;
+}
+
+/***	ReplayOpen(ReplaySource *replayPtr, const char *path, ReplayFormat format, u32 width, u32 height)
+**
+**	Parameters:
+**		replayPtr - Pointer to the struct that will be initialized
+**		path - File to play
+**		format - Format of the file
+**		width - Frame width, only used for REPLAY_RAW_RGB
+**		height - Frame height, only used for REPLAY_RAW_RGB
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_INVALID_PARAM if a raw file has no size or is not a whole
+**			number of frames
+**		XST_FAILURE if the file cannot be read or its header is not
+**			supported
+**
+**	Description:
+**		Opens the file and reads its header. The source timing is set up
+**		from the VideoMode with the same resolution if there is one, and
+**		from the frame size plus fixed blanking otherwise.
+**
+*/
+int ReplayOpen(ReplaySource *replayPtr, const char *path, ReplayFormat format, u32 width, u32 height)
+{
+	long fileBytes;
+	int Status;
+	u32 i;
+
+	memset(replayPtr, 0, sizeof(*replayPtr));
+	replayPtr->format = format;
+
+	replayPtr->file = fopen(path, "rb");
+	if (replayPtr->file == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	switch (format)
+	{
+	case REPLAY_RAW_RGB:
+		replayPtr->width = width;
+		replayPtr->height = height;
+		replayPtr->frameBytes = (long) width * height * 3;
+		Status = (replayPtr->frameBytes == 0) ? XST_INVALID_PARAM : XST_SUCCESS;
+		break;
+	case REPLAY_PPM:
+		Status = ReplayOpenPpm(replayPtr);
+		break;
+	case REPLAY_Y4M:
+		Status = ReplayOpenY4m(replayPtr);
+		break;
+	default:
+		Status = XST_INVALID_PARAM;
+		break;
+	}
+
+	if (Status == XST_SUCCESS && (replayPtr->width == 0 || replayPtr->height == 0))
+	{
+		Status = XST_FAILURE;
+	}
+	if (Status == XST_SUCCESS)
+	{
+		fseek(replayPtr->file, 0, SEEK_END);
+		fileBytes = ftell(replayPtr->file) - replayPtr->dataStart;
+		replayPtr->numFrames = (u32) (fileBytes / replayPtr->frameBytes);
+		if (replayPtr->numFrames == 0 || (format == REPLAY_RAW_RGB && fileBytes % replayPtr->frameBytes != 0))
+		{
+			Status = (format == REPLAY_RAW_RGB) ? XST_INVALID_PARAM : XST_FAILURE;
+		}
+	}
+	if (Status == XST_SUCCESS)
+	{
+		replayPtr->buf = malloc(replayPtr->frameBytes);
+		if (replayPtr->buf == NULL)
+		{
+			Status = XST_FAILURE;
+		}
+	}
+	if (Status != XST_SUCCESS)
+	{
+		ReplayClose(replayPtr);
+		return Status;
+	}
+
+	replayPtr->timing.width = replayPtr->width;
+	replayPtr->timing.height = replayPtr->height;
+	replayPtr->timing.hTotal = replayPtr->width + REPLAY_H_BLANK;
+	replayPtr->timing.vTotal = replayPtr->height + REPLAY_V_BLANK;
+	for (i = 0; i < sizeof(replayModes) / sizeof(replayModes[0]); i++)
+	{
+		if (replayModes[i]->width == replayPtr->width && replayModes[i]->height == replayPtr->height)
+		{
+			ReplayTimingFromMode(&replayPtr->timing, replayModes[i], 0);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	ReplayClose(ReplaySource *replayPtr)
+**
+**	Parameters:
+**		replayPtr - Pointer to the ReplaySource struct
+**
+**	Return Value:
+**
+**	Description:
+**		Closes the file and frees the frame buffer. Call ReplayStop
+**		first if the source was started.
+**
+*/
+void ReplayClose(ReplaySource *replayPtr)
+{
+	if (replayPtr->file != NULL)
+	{
+		fclose(replayPtr->file);
+		replayPtr->file = NULL;
+	}
+	free(replayPtr->buf);
+	replayPtr->buf = NULL;
+}
+/* ------------------------------------------------------------ */
+
+/***	ReplayTimingFromMode(HwSimSource *timingPtr, const VideoMode *mode, u32 framePeriodNs)
+**
+**	Parameters:
+**		timingPtr - Receives the source timing
+**		mode - Video mode to take the sizes from
+**		framePeriodNs - Frame period, or 0 to use the mode's pixel clock
+**
+**	Return Value:
+**
+*/
+void ReplayTimingFromMode(HwSimSource *timingPtr, const VideoMode *mode, u32 framePeriodNs)
+{
+	timingPtr->width = mode->width;
+	timingPtr->height = mode->height;
+	timingPtr->hTotal = mode->hmax + 1;
+	timingPtr->vTotal = mode->vmax + 1;
+	if (framePeriodNs == 0)
+	{
+		framePeriodNs = (u32) (((double) timingPtr->hTotal * (double) timingPtr->vTotal * 1000.0) / mode->freq);
+	}
+	timingPtr->framePeriodNs = framePeriodNs;
+}
+/* ------------------------------------------------------------ */
+
+static int ReplayAddEvent(ReplaySource *replayPtr, const ReplayEvent *eventPtr)
+{
+	if (replayPtr->numEvents >= REPLAY_MAX_EVENTS)
+	{
+		return XST_FAILURE;
+	}
+
+	replayPtr->events[replayPtr->numEvents++] = *eventPtr;
+	return XST_SUCCESS;
+}
+
+/***	ReplayAddLoss(ReplaySource *replayPtr, u32 atFrame, u32 frames)
+**
+**	Parameters:
+**		replayPtr - Pointer to the opened ReplaySource struct
+**		atFrame - Source frame at which the signal goes away
+**		frames - Frame periods until it comes back
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_FAILURE if REPLAY_MAX_EVENTS events are already scheduled
+**
+**	Description:
+**		Schedules a signal loss, as when the cable is pulled and plugged
+**		back in. The receiver locks again HWSIM_LOCK_FRAMES frames after
+**		the signal returns.
+**
+*/
+int ReplayAddLoss(ReplaySource *replayPtr, u32 atFrame, u32 frames)
+{
+	ReplayEvent event;
+
+	memset(&event, 0, sizeof(event));
+	event.atFrame = atFrame;
+	event.type = REPLAY_EV_LOSS;
+	event.frames = frames;
+	return ReplayAddEvent(replayPtr, &event);
+}
+/* ------------------------------------------------------------ */
+
+/***	ReplayAddTiming(ReplaySource *replayPtr, u32 atFrame, const HwSimSource *timingPtr)
+**
+**	Parameters:
+**		replayPtr - Pointer to the opened ReplaySource struct
+**		atFrame - Source frame at which the timing changes
+**		timingPtr - New timing, see ReplayTimingFromMode
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_FAILURE if REPLAY_MAX_EVENTS events are already scheduled
+**
+**	Description:
+**		Schedules a mode change of the source. The lock is lost and
+**		regained at the new timing, and from then on the file frames
+**		are cropped or padded to the new size.
+**
+*/
+int ReplayAddTiming(ReplaySource *replayPtr, u32 atFrame, const HwSimSource *timingPtr)
+{
+	ReplayEvent event;
+
+	memset(&event, 0, sizeof(event));
+	event.atFrame = atFrame;
+	event.type = REPLAY_EV_TIMING;
+	event.timing = *timingPtr;
+	return ReplayAddEvent(replayPtr, &event);
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Converts one BT.601 limited range sample to a pixel
+ */
+static void ReplayYuvToPixel(u8 *dst, int y, int u, int v)
+{
+	int c = 298 * (y - 16);
+	int d = u - 128;
+	int e = v - 128;
+	int ch[3];
+	int i;
+
+	ch[PIXFMT_B] = (c + 516 * d + 128) >> 8;
+	ch[PIXFMT_G] = (c - 100 * d - 208 * e + 128) >> 8;
+	ch[PIXFMT_R] = (c + 409 * e + 128) >> 8;
+	for (i = 0; i < 3; i++)
+	{
+		dst[i] = (u8) ((ch[i] < 0) ? 0 : ((ch[i] > 255) ? 255 : ch[i]));
+	}
+}
+
+/*
+ * S2MM frame hook. Reads the file frame for the current source frame and
+ * writes it into the frame store the channel just filled.
+ */
+static void ReplayFrameHook(void *callBackRef, u32 frame, UINTPTR addr)
+{
+	ReplaySource *replayPtr = (ReplaySource *) callBackRef;
+	VideoCapture *videoPtr = replayPtr->videoPtr;
+	const u8 *pix, *yPlane, *uPlane, *vPlane;
+	u32 x, y, width, height, chromaWidth, shift, ci;
+	u8 *row;
+
+	if (frame >= VIDEO_NUM_FRAMES || videoPtr->framePtr[frame] == NULL)
+	{
+		return;
+	}
+
+	if (fseek(replayPtr->file, replayPtr->dataStart +
+				(long) (replayPtr->sourceFrames % replayPtr->numFrames) * replayPtr->frameBytes, SEEK_SET) != 0 ||
+			fread(replayPtr->buf, 1, replayPtr->frameBytes, replayPtr->file) != (size_t) replayPtr->frameBytes)
+	{
+		return;
+	}
+	if (replayPtr->format == REPLAY_Y4M &&
+			memcmp(replayPtr->buf, REPLAY_Y4M_FRAME_HEADER, replayPtr->headerBytes) != 0)
+	{
+		/*
+		 * Frame headers with parameters are not supported
+		 */
+		return;
+	}
+
+	width = replayPtr->timing.width;
+	if (width > videoPtr->stride / 3)
+	{
+		width = videoPtr->stride / 3;
+	}
+	height = replayPtr->timing.height;
+	shift = replayPtr->chromaShift;
+	chromaWidth = (replayPtr->width + shift) >> shift;
+	yPlane = replayPtr->buf + replayPtr->headerBytes;
+	uPlane = yPlane + replayPtr->width * replayPtr->height;
+	vPlane = uPlane + chromaWidth * ((replayPtr->height + shift) >> shift);
+
+	for (y = 0; y < height; y++)
+	{
+		row = videoPtr->framePtr[frame] + y * videoPtr->stride;
+		if (y >= replayPtr->height)
+		{
+			memset(row, 0, width * 3);
+			continue;
+		}
+
+		for (x = 0; x < width && x < replayPtr->width; x++)
+		{
+			if (replayPtr->format == REPLAY_Y4M)
+			{
+				ci = (y >> shift) * chromaWidth + (x >> shift);
+				ReplayYuvToPixel(row + x * 3, yPlane[y * replayPtr->width + x], uPlane[ci], vPlane[ci]);
+			}
+			else
+			{
+				pix = yPlane + (y * replayPtr->width + x) * 3;
+				row[x * 3 + PIXFMT_R] = pix[0];
+				row[x * 3 + PIXFMT_G] = pix[1];
+				row[x * 3 + PIXFMT_B] = pix[2];
+			}
+		}
+		if (x < width)
+		{
+			memset(row + x * 3, 0, (width - x) * 3);
+		}
+	}
+
+	replayPtr->framesWritten++;
+}
+
+/*
+ * Plugs in the source with the current timing, or unplugs it
+ */
+static void ReplaySetSource(ReplaySource *replayPtr, int fPresent)
+{
+	HwSimSetSource(fPresent ? &replayPtr->timing : NULL);
+	replayPtr->frameEndNs = HwSimNow();
+}
+
+/***	ReplayStart(ReplaySource *replayPtr, VideoCapture *videoPtr, u32 framePeriodNs)
+**
+**	Parameters:
+**		replayPtr - Pointer to the opened ReplaySource struct
+**		videoPtr - Capture driver whose framebuffers receive the frames
+**		framePeriodNs - Frame period, or 0 for the rate in the file (Y4M)
+**						or the rate of the matching video mode
+**
+**	Return Value:
+**
+**	Description:
+**		Plugs the source into the model at the current simulated time.
+**
+*/
+void ReplayStart(ReplaySource *replayPtr, VideoCapture *videoPtr, u32 framePeriodNs)
+{
+	if (framePeriodNs == 0)
+	{
+		framePeriodNs = replayPtr->filePeriodNs;
+	}
+	if (framePeriodNs == 0)
+	{
+		framePeriodNs = replayPtr->timing.framePeriodNs;
+	}
+	if (framePeriodNs == 0)
+	{
+		framePeriodNs = REPLAY_DEFAULT_PERIOD_NS;
+	}
+
+	replayPtr->videoPtr = videoPtr;
+	replayPtr->timing.framePeriodNs = framePeriodNs;
+	replayPtr->sourceFrames = 0;
+	replayPtr->lossLeft = 0;
+	replayPtr->framesWritten = 0;
+
+	HwSimSetFrameHook(HWSIM_S2MM, ReplayFrameHook, replayPtr);
+	ReplaySetSource(replayPtr, 1);
+}
+/* ------------------------------------------------------------ */
+
+/***	ReplayRun(ReplaySource *replayPtr, u32 frames)
+**
+**	Parameters:
+**		replayPtr - Pointer to the started ReplaySource struct
+**		frames - Number of source frame periods to play
+**
+**	Return Value:
+**
+**	Description:
+**		Advances simulated time one source frame at a time, applying
+**		the events scheduled for each frame before it is played.
+**		Interrupts raised by the model, and the capture callbacks they
+**		lead to, run from inside this call.
+**
+*/
+void ReplayRun(ReplaySource *replayPtr, u32 frames)
+{
+	ReplayEvent *eventPtr;
+	u32 i, j;
+
+	for (i = 0; i < frames; i++)
+	{
+		if (replayPtr->lossLeft != 0 && --replayPtr->lossLeft == 0)
+		{
+			ReplaySetSource(replayPtr, 1);
+		}
+
+		for (j = 0; j < replayPtr->numEvents; j++)
+		{
+			eventPtr = &replayPtr->events[j];
+			if (eventPtr->atFrame != replayPtr->sourceFrames)
+			{
+				continue;
+			}
+
+			if (eventPtr->type == REPLAY_EV_LOSS && eventPtr->frames != 0)
+			{
+				replayPtr->lossLeft = eventPtr->frames;
+				ReplaySetSource(replayPtr, 0);
+			}
+			else if (eventPtr->type == REPLAY_EV_TIMING)
+			{
+				replayPtr->timing = eventPtr->timing;
+				if (replayPtr->lossLeft == 0)
+				{
+					ReplaySetSource(replayPtr, 1);
+				}
+			}
+		}
+
+		/*
+		 * Frame ends are counted from the last HwSimSetSource call, which
+		 * starts the frame period over. Rounding the step up to whole
+		 * microseconds makes sure the frame that ends exactly on the
+		 * boundary is played.
+		 */
+		replayPtr->frameEndNs += replayPtr->timing.framePeriodNs;
+		if (replayPtr->frameEndNs > HwSimNow())
+		{
+			HwSimStep((u32) ((replayPtr->frameEndNs - HwSimNow() + 999) / 1000));
+		}
+		replayPtr->sourceFrames++;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	ReplayStop(ReplaySource *replayPtr)
+**
+**	Parameters:
+**		replayPtr - Pointer to the started ReplaySource struct
+**
+**	Return Value:
+**
+**	Description:
+**		Unplugs the source and removes the frame hook.
+**
+*/
+void ReplayStop(ReplaySource *replayPtr)
+{
+	HwSimSetFrameHook(HWSIM_S2MM, NULL, NULL);
+	ReplaySetSource(replayPtr, 0);
+	replayPtr->lossLeft = 0;
+}
+
+/* ------------------------------------------------------------ */
+
+#ifdef REPLAY_MAIN
+/*
+ * GpioIsr enables the input VTC interrupt at the GIC when the receiver
+ * locks and disables it on loss of lock. The host program has no GIC, so
+ * these connect and disconnect the VTC handler in the model instead.
+ */
+void XScuGic_Enable(XScuGic *InstancePtr, u32 Int_Id)
+{
+	if (Int_Id == HWSIM_IRQ_VTC_IN)
+	{
+		HwSimConnect(Int_Id, (HwSimHandler) XVtc_IntrHandler, &hostVideo.vtc);
+	}
+}
+
+void XScuGic_Disable(XScuGic *InstancePtr, u32 Int_Id)
+{
+	HwSimConnect(Int_Id, NULL, NULL);
+}
+
+static void ReplayHostCallback(void *callBackRef, void *pVideo)
+{
+	hostCallbacks++;
+}
+
+/*
+ * Prints a failed check. Returns 1 if it failed.
+ */
+static int ReplayHostCheck(int fOk, const char *what)
+{
+	if (!fOk)
+	{
+		printf("FAILED: %s\n", what);
+	}
+	return !fOk;
+}
+
+/*
+ * Channels of pixel (x, y) of frame f of the PPM file, R, G, B. Blue tells
+ * the frames apart.
+ */
+static void ReplayHostPpmPixel(u32 f, u32 x, u32 y, u8 rgb[3])
+{
+	rgb[0] = (u8) (x + f * 40);
+	rgb[1] = (u8) y;
+	rgb[2] = (u8) (f * REPLAY_HOST_BLUE_STEP);
+}
+
+/*
+ * Writes the PPM file of REPLAY_HOST_PPM_FRAMES concatenated images to a
+ * temporary file and returns its path in path
+ */
+static int ReplayHostWritePpm(char *path)
+{
+	FILE *file;
+	u8 rgb[3];
+	u32 f, x, y;
+	int fd;
+
+	strcpy(path, REPLAY_HOST_TEMPLATE);
+	fd = mkstemp(path);
+	if (fd < 0 || (file = fdopen(fd, "wb")) == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	for (f = 0; f < REPLAY_HOST_PPM_FRAMES; f++)
+	{
+		fprintf(file, "P6\n%u %u\n255\n", REPLAY_HOST_W, REPLAY_HOST_H);
+		for (y = 0; y < REPLAY_HOST_H; y++)
+		{
+			for (x = 0; x < REPLAY_HOST_W; x++)
+			{
+				ReplayHostPpmPixel(f, x, y, rgb);
+				fwrite(rgb, 1, 3, file);
+			}
+		}
+	}
+
+	fclose(file);
+	return XST_SUCCESS;
+}
+
+/*
+ * Writes a one frame 4:4:4 Y4M file of vertical bars of the BT.601 limited
+ * range colors in replayHostBars to a temporary file
+ */
+static int ReplayHostWriteY4m(char *path)
+{
+	FILE *file;
+	u32 p, x, y;
+	int fd;
+
+	strcpy(path, REPLAY_HOST_TEMPLATE);
+	fd = mkstemp(path);
+	if (fd < 0 || (file = fdopen(fd, "wb")) == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	fprintf(file, "YUV4MPEG2 W%u H%u F30:1 Ip C444\nFRAME\n", REPLAY_HOST_W, REPLAY_HOST_H);
+	for (p = 0; p < 3; p++)
+	{
+		for (y = 0; y < REPLAY_HOST_H; y++)
+		{
+			for (x = 0; x < REPLAY_HOST_W; x++)
+			{
+				fputc(replayHostBars[x * REPLAY_HOST_BARS / REPLAY_HOST_W].yuv[p], file);
+			}
+		}
+	}
+
+	fclose(file);
+	return XST_SUCCESS;
+}
+
+/*
+ * Checks that frame store 0, which capture is parked on, holds a frame of
+ * the PPM file cropped or padded with black to width x height, and that the
+ * channels are in the order of PIXFMT_R, PIXFMT_G and PIXFMT_B
+ */
+static u32 ReplayHostCheckPpmFrame(u32 width, u32 height)
+{
+	const u8 *pix;
+	u8 rgb[3];
+	u32 f, x, y;
+	int fOk = 1;
+
+	f = hostFrames[0][PIXFMT_B] / REPLAY_HOST_BLUE_STEP;
+	if (f >= REPLAY_HOST_PPM_FRAMES)
+	{
+		return ReplayHostCheck(0, "captured frame is a file frame");
+	}
+
+	for (y = 0; y < height && fOk; y++)
+	{
+		for (x = 0; x < width && fOk; x++)
+		{
+			pix = hostFrames[0] + y * REPLAY_HOST_STRIDE + x * 3;
+			if (x < REPLAY_HOST_W && y < REPLAY_HOST_H)
+			{
+				ReplayHostPpmPixel(f, x, y, rgb);
+			}
+			else
+			{
+				memset(rgb, 0, sizeof(rgb));
+			}
+			fOk = pix[PIXFMT_R] == rgb[0] && pix[PIXFMT_G] == rgb[1] && pix[PIXFMT_B] == rgb[2];
+		}
+	}
+
+	return ReplayHostCheck(fOk, "captured frame matches the file");
+}
+
+/*
+ * Plays the PPM file through a loss of signal and a switch to a larger
+ * mode, checking capture and the frames written at each step. Returns the
+ * number of failures.
+ */
+static u32 ReplayHostPpm(void)
+{
+	ReplaySource replay;
+	HwSimSource timing;
+	char path[sizeof(REPLAY_HOST_TEMPLATE)];
+	u32 failures = 0;
+	u32 callbacks, written;
+
+	if (ReplayHostWritePpm(path) != XST_SUCCESS)
+	{
+		return ReplayHostCheck(0, "writing the PPM file");
+	}
+	failures += ReplayHostCheck(ReplayOpen(&replay, path, REPLAY_PPM, 0, 0) == XST_SUCCESS, "ReplayOpen PPM");
+	unlink(path);
+	if (failures)
+	{
+		return failures;
+	}
+	failures += ReplayHostCheck(replay.width == REPLAY_HOST_W && replay.height == REPLAY_HOST_H &&
+			replay.numFrames == REPLAY_HOST_PPM_FRAMES, "PPM header");
+
+	/*
+	 * Frames 0 to 9 play after the lock, 15 to 19 have no signal and from
+	 * 30 on the source is 800x600
+	 */
+	ReplayAddLoss(&replay, 15, 5);
+	ReplayTimingFromMode(&timing, &VMODE_800x600, 0);
+	ReplayAddTiming(&replay, 30, &timing);
+
+	callbacks = hostCallbacks;
+	ReplayStart(&replay, &hostVideo, 0);
+	ReplayRun(&replay, 10);
+	failures += ReplayHostCheck(hostVideo.state == VIDEO_STREAMING && hostCallbacks == callbacks + 1, "lock to the file");
+	failures += ReplayHostCheck(hostVideo.timing.HActiveVideo == REPLAY_HOST_W && hostVideo.timing.VActiveVideo == REPLAY_HOST_H,
+			"timing of the file");
+	failures += ReplayHostCheck(replay.framesWritten != 0, "frames written");
+	failures += ReplayHostCheckPpmFrame(REPLAY_HOST_W, REPLAY_HOST_H);
+	printf("%-24s %4lu frame(s) written\n", "PPM 640x480", (unsigned long) replay.framesWritten);
+
+	ReplayRun(&replay, 6);
+	failures += ReplayHostCheck(hostVideo.state == VIDEO_DISCONNECTED && hostCallbacks == callbacks + 2, "loss of signal");
+	written = replay.framesWritten;
+	ReplayRun(&replay, 3);
+	failures += ReplayHostCheck(replay.framesWritten == written, "no frames written without a signal");
+	ReplayRun(&replay, 10);
+	failures += ReplayHostCheck(hostVideo.state == VIDEO_STREAMING && hostCallbacks == callbacks + 3, "lock after the loss");
+	failures += ReplayHostCheck(replay.framesWritten > written, "frames written after the loss");
+	failures += ReplayHostCheckPpmFrame(REPLAY_HOST_W, REPLAY_HOST_H);
+	printf("%-24s %4lu frame(s) written\n", "After loss of signal", (unsigned long) replay.framesWritten);
+
+	ReplayRun(&replay, 10);
+	failures += ReplayHostCheck(hostVideo.state == VIDEO_STREAMING && hostCallbacks == callbacks + 5, "lock to the new timing");
+	failures += ReplayHostCheck(hostVideo.timing.HActiveVideo == VMODE_800x600.width && hostVideo.timing.VActiveVideo == VMODE_800x600.height,
+			"new timing");
+	failures += ReplayHostCheckPpmFrame(VMODE_800x600.width, VMODE_800x600.height);
+	printf("%-24s %4lu frame(s) written\n", "After switch to 800x600", (unsigned long) replay.framesWritten);
+
+	ReplayStop(&replay);
+	ReplayClose(&replay);
+	HwSimStep(100000);
+
+	return failures;
+}
+
+/*
+ * Plays the Y4M bars and checks each one converted to the right channels.
+ * Returns the number of failures.
+ */
+static u32 ReplayHostY4m(void)
+{
+	ReplaySource replay;
+	char path[sizeof(REPLAY_HOST_TEMPLATE)];
+	const u8 *pix;
+	u32 failures = 0;
+	u32 b, c;
+	int d, fOk;
+
+	if (ReplayHostWriteY4m(path) != XST_SUCCESS)
+	{
+		return ReplayHostCheck(0, "writing the Y4M file");
+	}
+	failures += ReplayHostCheck(ReplayOpen(&replay, path, REPLAY_Y4M, 0, 0) == XST_SUCCESS, "ReplayOpen Y4M");
+	unlink(path);
+	if (failures)
+	{
+		return failures;
+	}
+	failures += ReplayHostCheck(replay.chromaShift == 0 && replay.filePeriodNs == 1000000000 / 30, "Y4M header");
+
+	ReplayStart(&replay, &hostVideo, 0);
+	ReplayRun(&replay, 8);
+	failures += ReplayHostCheck(hostVideo.state == VIDEO_STREAMING && replay.framesWritten != 0, "Y4M frames written");
+
+	for (b = 0; b < REPLAY_HOST_BARS; b++)
+	{
+		pix = hostFrames[0] + (REPLAY_HOST_H / 2) * REPLAY_HOST_STRIDE + ((2 * b + 1) * REPLAY_HOST_W / (2 * REPLAY_HOST_BARS)) * 3;
+		fOk = 1;
+		for (c = 0; c < 3; c++)
+		{
+			d = (int) pix[(c == 0) ? PIXFMT_R : (c == 1) ? PIXFMT_G : PIXFMT_B] - (int) replayHostBars[b].rgb[c];
+			fOk = fOk && d >= -REPLAY_HOST_YUV_TOL && d <= REPLAY_HOST_YUV_TOL;
+		}
+		failures += ReplayHostCheck(fOk, replayHostBars[b].name);
+	}
+	printf("%-24s %4lu frame(s) written\n", "Y4M 4:4:4 bars", (unsigned long) replay.framesWritten);
+
+	ReplayStop(&replay);
+	ReplayClose(&replay);
+
+	return failures;
+}
+
+int main(void)
+{
+	XAxiVdma_Config *vdmaConfig;
+	u8 *frames[VIDEO_NUM_FRAMES];
+	u32 failures = 0;
+	u32 i;
+
+	for (i = 0; i < VIDEO_NUM_FRAMES; i++)
+	{
+		frames[i] = hostFrames[i];
+	}
+
+	HwSimReset();
+
+	vdmaConfig = XAxiVdma_LookupConfig(XPAR_AXIVDMA_0_DEVICE_ID);
+	failures += ReplayHostCheck(vdmaConfig != NULL && XAxiVdma_CfgInitialize(&hostVdma, vdmaConfig, vdmaConfig->BaseAddress) == XST_SUCCESS,
+			"XAxiVdma_CfgInitialize");
+
+	HwSimConnect(HWSIM_IRQ_GPIO, GpioIsr, &hostVideo);
+	HwSimSetIrqEnable(1);
+	failures += ReplayHostCheck(VideoInitialize(&hostVideo, &hostIntc, &hostVdma, XPAR_AXI_GPIO_VIDEO_DEVICE_ID, XPAR_V_TC_IN_DEVICE_ID,
+			HWSIM_IRQ_VTC_IN, frames, REPLAY_HOST_STRIDE, 1) == XST_SUCCESS, "VideoInitialize");
+	VideoSetCallback(&hostVideo, ReplayHostCallback, NULL);
+
+	failures += ReplayHostPpm();
+	failures += ReplayHostY4m();
+
+	printf("\n%lu check(s) failed\n", (unsigned long) failures);
+
+	return failures != 0;
+}
+#endif
+
+#endif /* __linux__ */
+
+/************************************************************************/
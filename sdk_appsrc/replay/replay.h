@@ -0,0 +1,144 @@
+/************************************************************************/
+/*																		*/
+/*	replay.h	--	Recorded stream replay into the capture frame store	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Host test source for the capture path. Plays raw RGB, PPM or	*/
+/*		Y4M files as the HDMI input of the register model in hwsim:		*/
+/*		the model sees a source with the file's resolution at the		*/
+/*		chosen frame rate, and each frame the S2MM channel completes	*/
+/*		is filled with the matching file frame, straight into the		*/
+/*		VideoCapture framebuffers. The file loops when it runs out.		*/
+/*																		*/
+/*		Signal loss and timing changes can be scheduled by source		*/
+/*		frame number. Both drop the TMDS lock in the model, so			*/
+/*		GpioIsr, VideoStop, VtcIsr and the capture callback run just	*/
+/*		as they do when a cable is pulled or the source changes mode.	*/
+/*		After a timing change the file frames are cropped or padded		*/
+/*		with black to the new size.										*/
+/*																		*/
+/*		Raw files hold packed R,G,B bytes with no header. PPM files are	*/
+/*		binary (P6) with a maxval of 255; several images may be			*/
+/*		concatenated. Y4M files must be 4:2:0 or 4:4:4 with 8-bit		*/
+/*		samples and are converted with BT.601 limited range. Frames are	*/
+/*		written to the frame store in the channel order of pixfmt.h.	*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Bring up the capture path against hwsim, with GpioIsr and	*/
+/*		   XVtc_IntrHandler connected through HwSimConnect.				*/
+/*		2) Call ReplayOpen, then optionally ReplayAddLoss and			*/
+/*		   ReplayAddTiming.												*/
+/*		3) Call ReplayStart and advance with ReplayRun.					*/
+/*		4) Call ReplayClose.											*/
+/*																		*/
+/*		With REPLAY_MAIN defined the module builds as a stand-alone		*/
+/*		host program that plays a PPM file through a loss of signal and	*/
+/*		a mode change and Y4M color bars, and checks the frames			*/
+/*		captured:														*/
+/*			gcc -O2 -DREPLAY_MAIN -include hwsim/host/xil_io.h			*/
+/*				-I<bsp>/include -I. replay/replay.c hwsim/hwsim.c		*/
+/*				video_capture/video_capture.c pixfmt/pixfmt.c			*/
+/*				blit/blit.c <bsp>/libsrc/standalone_v6_7/src/xil_mem.c	*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_assert.c			*/
+/*				<bsp>/libsrc/axivdma_v6_5/src/xaxivdma*.c				*/
+/*				<bsp>/libsrc/vtc_v7_2/src/xvtc*.c						*/
+/*				<bsp>/libsrc/gpio_v4_3/src/xgpio*.c -o replay			*/
+/*																		*/
+/*		Only built for Linux; on the Zynq this module is empty.			*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added the REPLAY_MAIN host program					*/
+/*																		*/
+/************************************************************************/
+
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../hwsim/hwsim.h"
+#include "../video_capture/video_capture.h"
+#include "../display_ctrl/vga_modes.h"
+#include <stdio.h>
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define REPLAY_MAX_EVENTS 16
+
+/*
+ * Frame period used when neither the caller nor the file gives a rate
+ */
+#define REPLAY_DEFAULT_PERIOD_NS 16666667
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef enum {
+	REPLAY_RAW_RGB = 0,
+	REPLAY_PPM = 1,
+	REPLAY_Y4M = 2
+} ReplayFormat;
+
+typedef enum {
+	REPLAY_EV_LOSS = 0, /* Remove the source for a number of frames */
+	REPLAY_EV_TIMING = 1 /* Switch the source to new timing */
+} ReplayEventType;
+
+typedef struct {
+		u32 atFrame; /* Source frame before which the event happens */
+		ReplayEventType type;
+		u32 frames; /* REPLAY_EV_LOSS: frame periods without a signal */
+		HwSimSource timing; /* REPLAY_EV_TIMING: new source timing */
+} ReplayEvent;
+
+typedef struct {
+		FILE *file;
+		ReplayFormat format;
+		u32 width; /* Size of the frames in the file */
+		u32 height;
+		u32 chromaShift; /* Y4M: 1 for 4:2:0, 0 for 4:4:4 */
+		long frameBytes; /* Bytes per file frame, including any header */
+		long headerBytes; /* Bytes before the pixel data of each frame */
+		long dataStart; /* File offset of the first frame */
+		u32 numFrames; /* Frames in the file */
+		u32 filePeriodNs; /* Y4M frame rate, 0 if the file has none */
+		u8 *buf; /* One file frame as read from disk */
+		VideoCapture *videoPtr;
+		HwSimSource timing; /* Current source timing */
+		u32 sourceFrames; /* Frame periods played since ReplayStart */
+		u64 frameEndNs; /* Simulated time the current frame period ends */
+		u32 lossLeft; /* Frame periods left in the current signal loss */
+		u32 framesWritten; /* Frames written into the frame store */
+		ReplayEvent events[REPLAY_MAX_EVENTS];
+		u32 numEvents;
+} ReplaySource;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int ReplayOpen(ReplaySource *replayPtr, const char *path, ReplayFormat format, u32 width, u32 height);
+void ReplayClose(ReplaySource *replayPtr);
+void ReplayTimingFromMode(HwSimSource *timingPtr, const VideoMode *mode, u32 framePeriodNs);
+int ReplayAddLoss(ReplaySource *replayPtr, u32 atFrame, u32 frames);
+int ReplayAddTiming(ReplaySource *replayPtr, u32 atFrame, const HwSimSource *timingPtr);
+void ReplayStart(ReplaySource *replayPtr, VideoCapture *videoPtr, u32 framePeriodNs);
+void ReplayRun(ReplaySource *replayPtr, u32 frames);
+void ReplayStop(ReplaySource *replayPtr);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* REPLAY_H_ */
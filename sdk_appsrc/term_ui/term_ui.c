@@ -0,0 +1,236 @@
+/************************************************************************/
+/*																		*/
+/*	term_ui.c	--	Differential redraw of a VT100 terminal screen		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Keeps a model of the text on the terminal, one string per row.	*/
+/*		Rows are written with TermUiPrintf and sent with TermUiRefresh,	*/
+/*		which compares them against what was last sent and only emits	*/
+/*		a cursor move and the changed characters of each changed row.	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "term_ui.h"
+#include "../uart_ps/uart_ps.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* ------------------------------------------------------------ */
+/*				Forward Declarations							*/
+/* ------------------------------------------------------------ */
+
+static u32 TermUiGoto(u32 row, u32 col);
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	TermUiInit(TermUi *uiPtr)
+**
+**	Parameters:
+**		uiPtr - Pointer to the struct that will be initialized
+**
+**	Return Value:
+**
+**	Description:
+**		Empties every row. The next refresh clears the terminal.
+**
+*/
+void TermUiInit(TermUi *uiPtr)
+{
+	memset(uiPtr->next, 0, sizeof(uiPtr->next));
+	memset(uiPtr->shown, 0, sizeof(uiPtr->shown));
+	uiPtr->fValid = 0;
+}
+/* ------------------------------------------------------------ */
+
+/***	TermUiInvalidate(TermUi *uiPtr)
+**
+**	Parameters:
+**		uiPtr - Pointer to the initialized TermUi struct
+**
+**	Return Value:
+**
+**	Description:
+**		Forgets what is on the terminal, so the next refresh clears it
+**		and redraws every row. The rows themselves are kept.
+**
+*/
+void TermUiInvalidate(TermUi *uiPtr)
+{
+	uiPtr->fValid = 0;
+}
+/* ------------------------------------------------------------ */
+
+/***	TermUiClearRow(TermUi *uiPtr, u32 row)
+**
+**	Parameters:
+**		uiPtr - Pointer to the initialized TermUi struct
+**		row - Row to empty, starting at 0
+**
+**	Return Value:
+**
+**	Description:
+**		Empties a row in the model. Nothing is sent until TermUiRefresh.
+**
+*/
+void TermUiClearRow(TermUi *uiPtr, u32 row)
+{
+	if (row < TERM_UI_ROWS)
+	{
+		uiPtr->next[row][0] = '\0';
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	TermUiPrintf(TermUi *uiPtr, u32 row, const char *fmt, ...)
+**
+**	Parameters:
+**		uiPtr - Pointer to the initialized TermUi struct
+**		row - Row to replace, starting at 0
+**		fmt - printf style format string. Must not contain line breaks.
+**
+**	Return Value:
+**
+**	Description:
+**		Replaces the text of a row in the model. Nothing is sent until
+**		TermUiRefresh. Text past TERM_UI_COLS is cut off.
+**
+*/
+void TermUiPrintf(TermUi *uiPtr, u32 row, const char *fmt, ...)
+{
+	va_list args;
+
+	if (row >= TERM_UI_ROWS)
+	{
+		return;
+	}
+
+	va_start(args, fmt);
+	vsnprintf(uiPtr->next[row], TERM_UI_COLS + 1, fmt, args);
+	va_end(args);
+}
+/* ------------------------------------------------------------ */
+
+/***	TermUiRefresh(TermUi *uiPtr, u32 cursorRow)
+**
+**	Parameters:
+**		uiPtr - Pointer to the initialized TermUi struct
+**		cursorRow - Row at the end of which the cursor is left
+**
+**	Return Value: u32
+**		Number of bytes sent to the terminal
+**
+**	Description:
+**		Brings the terminal up to date with the model. For each row that
+**		changed, moves the cursor to the first changed column and sends
+**		the text up to the last changed column, erasing the rest of the
+**		line if the row got shorter.
+**
+*/
+u32 TermUiRefresh(TermUi *uiPtr, u32 cursorRow)
+{
+	u32 row;
+	u32 first;
+	u32 last;
+	u32 newLen;
+	u32 oldLen;
+	u32 sent = 0;
+	char *next;
+	char *shown;
+
+	if (!uiPtr->fValid)
+	{
+		UartWrite("\x1B[H\x1B[2J", 7); //Set cursor to top left of terminal and clear it
+		sent += 7;
+		memset(uiPtr->shown, 0, sizeof(uiPtr->shown));
+		uiPtr->fValid = 1;
+	}
+
+	for (row = 0; row < TERM_UI_ROWS; row++)
+	{
+		next = uiPtr->next[row];
+		shown = uiPtr->shown[row];
+		newLen = strlen(next);
+		oldLen = strlen(shown);
+
+		first = 0;
+		while (first < newLen && first < oldLen && next[first] == shown[first])
+		{
+			first++;
+		}
+		if (first == newLen && first == oldLen)
+		{
+			continue;
+		}
+
+		/*
+		 * Skip the unchanged tail of a row whose length did not change
+		 */
+		last = newLen;
+		if (newLen == oldLen)
+		{
+			while (next[last - 1] == shown[last - 1])
+			{
+				last--;
+			}
+		}
+
+		sent += TermUiGoto(row, first);
+		UartWrite(&next[first], last - first);
+		sent += last - first;
+		if (oldLen > newLen)
+		{
+			UartWrite("\x1B[K", 3); //Erase to end of line
+			sent += 3;
+		}
+
+		memcpy(shown, next, newLen + 1);
+	}
+
+	if (cursorRow < TERM_UI_ROWS)
+	{
+		sent += TermUiGoto(cursorRow, strlen(uiPtr->next[cursorRow]));
+	}
+
+	return sent;
+}
+/* ------------------------------------------------------------ */
+
+/***	TermUiGoto(u32 row, u32 col)
+**
+**	Parameters:
+**		row - Row to move to, starting at 0
+**		col - Column to move to, starting at 0
+**
+**	Return Value: u32
+**		Number of bytes sent
+**
+**	Description:
+**		Moves the terminal cursor.
+**
+*/
+static u32 TermUiGoto(u32 row, u32 col)
+{
+	char buf[12];
+	int len;
+
+	len = snprintf(buf, sizeof(buf), "\x1B[%lu;%luH", (unsigned long) row + 1, (unsigned long) col + 1);
+	UartWrite(buf, len);
+
+	return len;
+}
+
+/************************************************************************/
@@ -0,0 +1,65 @@
+/************************************************************************/
+/*																		*/
+/*	term_ui.h	--	Differential redraw of a VT100 terminal screen		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Keeps a model of the text on the terminal, one string per row.	*/
+/*		Rows are written with TermUiPrintf and sent with TermUiRefresh,	*/
+/*		which compares them against what was last sent and only emits	*/
+/*		a cursor move and the changed characters of each changed row.	*/
+/*		The screen is cleared and fully redrawn on the first refresh	*/
+/*		and after TermUiInvalidate, which must be called whenever		*/
+/*		something else has written to the terminal.						*/
+/*																		*/
+/*		Output goes through UartWrite, so uart_ps must be initialized.	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef TERM_UI_H_
+#define TERM_UI_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define TERM_UI_ROWS 24
+#define TERM_UI_COLS 80
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		char next[TERM_UI_ROWS][TERM_UI_COLS + 1]; /* Rows to be shown by the next refresh */
+		char shown[TERM_UI_ROWS][TERM_UI_COLS + 1]; /* Rows currently on the terminal */
+		int fValid; /* shown matches the terminal */
+} TermUi;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void TermUiInit(TermUi *uiPtr);
+void TermUiInvalidate(TermUi *uiPtr);
+void TermUiClearRow(TermUi *uiPtr, u32 row);
+void TermUiPrintf(TermUi *uiPtr, u32 row, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+u32 TermUiRefresh(TermUi *uiPtr, u32 cursorRow);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* TERM_UI_H_ */
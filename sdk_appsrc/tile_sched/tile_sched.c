@@ -0,0 +1,703 @@
+/************************************************************************/
+/*																		*/
+/*	tile_sched.c	--	Work stealing tile scheduler for the frame		*/
+/*						functions										*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Per worker Chase-Lev deques of tile numbers, the worker loop	*/
+/*		and the glue that runs the workers on both cores, or on			*/
+/*		pthreads on Linux. See tile_sched.h.							*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "tile_sched.h"
+#include "xstatus.h"
+
+#ifdef __linux__
+ #include <pthread.h>
+ #include <unistd.h>
+ #ifdef TILE_SCHED_MAIN
+  #include <stdio.h>
+  #include <stdlib.h>
+  #include <string.h>
+  #include <time.h>
+ #endif
+#else
+ #include "../amp/amp.h"
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Results of a take or steal that got no tile
+ */
+#define TILE_SCHED_EMPTY (-1) /* The deque has no tiles left */
+#define TILE_SCHED_ABORT (-2) /* Lost a race for the tile, try again */
+
+#ifdef TILE_SCHED_MAIN
+/*
+ * Frame of the host program, and of its race check
+ */
+#define TILE_SCHED_HOST_W 1920
+#define TILE_SCHED_HOST_H 1080
+#define TILE_SCHED_HOST_REPS 10
+#define TILE_SCHED_RACE_W 256
+#define TILE_SCHED_RACE_H 64
+#define TILE_SCHED_RACE_RUNS 2000
+
+/*
+ * Source pixels at or above this level are in the region of interest and
+ * get the expensive path of the host kernel
+ */
+#define TILE_SCHED_ROI_LEVEL 128
+#define TILE_SCHED_ROI_RADIUS 2
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Local Type Definitions							*/
+/* ------------------------------------------------------------ */
+
+#ifdef __linux__
+typedef struct {
+		TileSched *schedPtr;
+		u32 worker;
+} TileSchedThread;
+#endif
+
+#ifdef TILE_SCHED_MAIN
+/*
+ * Job of the host kernel. hits counts the runs of each tile.
+ */
+typedef struct {
+		const TileSched *schedPtr;
+		const u8 *src;
+		u8 *dst;
+		u32 stride;
+		u32 *hits;
+} TileSchedHostJob;
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Tiles run and stolen per worker since start-up, added up by TileSchedRun
+ */
+static u32 totalRun[TILE_SCHED_MAX_WORKERS];
+static u32 totalStolen[TILE_SCHED_MAX_WORKERS];
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Owner side: takes the tile at the bottom of its own deque. Only the last
+ * tile can also be wanted by a thief, and the compare and swap on top
+ * decides who gets it.
+ */
+static s32 TileSchedTake(TileSchedDeque *dequePtr)
+{
+	s32 bottom;
+	s32 top;
+	s32 slot;
+
+	bottom = __atomic_load_n(&dequePtr->bottom, __ATOMIC_RELAXED) - 1;
+	__atomic_store_n(&dequePtr->bottom, bottom, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	top = __atomic_load_n(&dequePtr->top, __ATOMIC_RELAXED);
+
+	if (top > bottom)
+	{
+		__atomic_store_n(&dequePtr->bottom, bottom + 1, __ATOMIC_RELAXED);
+		return TILE_SCHED_EMPTY;
+	}
+
+	slot = bottom;
+	if (top == bottom)
+	{
+		if (!__atomic_compare_exchange_n(&dequePtr->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+		{
+			slot = TILE_SCHED_EMPTY;
+		}
+		__atomic_store_n(&dequePtr->bottom, bottom + 1, __ATOMIC_RELAXED);
+		if (slot < 0)
+		{
+			return TILE_SCHED_EMPTY;
+		}
+	}
+
+	return dequePtr->mirror - slot;
+}
+
+/*
+ * Thief side: takes the tile at the top of another worker's deque
+ */
+static s32 TileSchedSteal(TileSchedDeque *dequePtr)
+{
+	s32 top;
+	s32 bottom;
+
+	top = __atomic_load_n(&dequePtr->top, __ATOMIC_ACQUIRE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	bottom = __atomic_load_n(&dequePtr->bottom, __ATOMIC_ACQUIRE);
+
+	if (top >= bottom)
+	{
+		return TILE_SCHED_EMPTY;
+	}
+	if (!__atomic_compare_exchange_n(&dequePtr->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+	{
+		return TILE_SCHED_ABORT;
+	}
+
+	return dequePtr->mirror - top;
+}
+
+/*
+ * Steals a tile from any other worker, starting with the next one. Tiles
+ * are never added, so once every deque reads empty the job has no tiles
+ * left to start.
+ */
+static s32 TileSchedStealAny(TileSched *schedPtr, u32 worker)
+{
+	u32 i;
+	s32 tile;
+	int fRetry;
+
+	do
+	{
+		fRetry = 0;
+		for (i = 1; i < schedPtr->numWorkers; i++)
+		{
+			tile = TileSchedSteal(&schedPtr->deques[(worker + i) % schedPtr->numWorkers]);
+			if (tile >= 0)
+			{
+				return tile;
+			}
+			if (tile == TILE_SCHED_ABORT)
+			{
+				fRetry = 1;
+			}
+		}
+	} while (fRetry);
+
+	return TILE_SCHED_EMPTY;
+}
+
+/*
+ * Calls the tile function on one tile, clipped to the frame
+ */
+static void TileSchedRunTile(TileSched *schedPtr, u32 tile)
+{
+	u32 x0, y0, x1, y1;
+
+	x0 = (tile % schedPtr->cols) * schedPtr->tileW;
+	y0 = (tile / schedPtr->cols) * schedPtr->tileH;
+	x1 = x0 + schedPtr->tileW;
+	y1 = y0 + schedPtr->tileH;
+	if (x1 > schedPtr->width)
+	{
+		x1 = schedPtr->width;
+	}
+	if (y1 > schedPtr->height)
+	{
+		y1 = schedPtr->height;
+	}
+
+	schedPtr->fn(schedPtr->ref, x0, y0, x1, y1);
+}
+
+/*
+ * Adds the counts of a finished job to the totals
+ */
+static void TileSchedAddTotals(const TileSched *schedPtr)
+{
+	u32 i;
+
+	for (i = 0; i < schedPtr->numWorkers; i++)
+	{
+		totalRun[i] += schedPtr->deques[i].run;
+		totalStolen[i] += schedPtr->deques[i].stolen;
+	}
+}
+
+#ifdef __linux__
+static void *TileSchedThreadMain(void *arg)
+{
+	TileSchedThread *threadPtr = (TileSchedThread *) arg;
+
+	TileSchedWork(threadPtr->schedPtr, threadPtr->worker);
+
+	return NULL;
+}
+#else
+/*
+ * AmpBandFn that runs the worker numbered by the band, so AmpRunOnBoth
+ * starts worker 0 on CPU0 and worker 1 on CPU1
+ */
+static void TileSchedCore(void *ref, u32 yStart, u32 yEnd)
+{
+	TileSched *schedPtr = (TileSched *) ref;
+
+	if (yStart < schedPtr->numWorkers)
+	{
+		TileSchedWork(schedPtr, yStart);
+	}
+}
+#endif
+/* ------------------------------------------------------------ */
+
+/***	TileSchedInit(TileSched *schedPtr, TileSchedFn fn, void *ref, u32 width, u32 height, u32 tileW, u32 tileH, u32 numWorkers)
+**
+**	Parameters:
+**		schedPtr - Scheduler to set up for one job
+**		fn - Tile function
+**		ref - Passed to fn, must stay valid until the job is finished
+**		width, height - Size of the frame in pixels
+**		tileW - Tile width, or 0 for full width bands
+**		tileH - Tile height
+**		numWorkers - Number of workers that will call TileSchedWork,
+**				normally TileSchedWorkers()
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_INVALID_PARAM if a size is 0 or there are too many workers
+**
+**	Errors:
+**
+**	Description:
+**		Cuts the frame into tiles in row order and gives each worker an
+**		even, contiguous share. A scheduler is good for one run; call
+**		this again before the next.
+**
+*/
+int TileSchedInit(TileSched *schedPtr, TileSchedFn fn, void *ref, u32 width, u32 height, u32 tileW, u32 tileH, u32 numWorkers)
+{
+	u32 i;
+	u32 first, end;
+
+	if (width == 0 || height == 0 || tileH == 0 || numWorkers == 0 || numWorkers > TILE_SCHED_MAX_WORKERS)
+	{
+		return XST_INVALID_PARAM;
+	}
+	if (tileW == 0 || tileW > width)
+	{
+		tileW = width;
+	}
+
+	schedPtr->fn = fn;
+	schedPtr->ref = ref;
+	schedPtr->width = width;
+	schedPtr->height = height;
+	schedPtr->tileW = tileW;
+	schedPtr->tileH = tileH;
+	schedPtr->cols = (width + tileW - 1) / tileW;
+	schedPtr->numTiles = schedPtr->cols * ((height + tileH - 1) / tileH);
+	schedPtr->numWorkers = numWorkers;
+	schedPtr->fSteal = 1;
+
+	for (i = 0; i < numWorkers; i++)
+	{
+		first = schedPtr->numTiles * i / numWorkers;
+		end = schedPtr->numTiles * (i + 1) / numWorkers;
+		schedPtr->deques[i].top = first;
+		schedPtr->deques[i].bottom = end;
+		schedPtr->deques[i].mirror = first + end - 1;
+		schedPtr->deques[i].run = 0;
+		schedPtr->deques[i].stolen = 0;
+	}
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	TileSchedWork(TileSched *schedPtr, u32 worker)
+**
+**	Parameters:
+**		schedPtr - Scheduler set up by TileSchedInit
+**		worker - Number of the calling worker, below numWorkers
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Worker loop, called once by each worker at the same time. Runs
+**		the tiles of its own deque, then steals until no deque has any
+**		left. Tiles stolen from this worker may still be running in
+**		another when it returns; the job is only finished once every
+**		worker has returned.
+**
+*/
+void TileSchedWork(TileSched *schedPtr, u32 worker)
+{
+	TileSchedDeque *dequePtr = &schedPtr->deques[worker];
+	s32 tile;
+
+	for (;;)
+	{
+		tile = TileSchedTake(dequePtr);
+		if (tile < 0 && schedPtr->fSteal)
+		{
+			tile = TileSchedStealAny(schedPtr, worker);
+			if (tile >= 0)
+			{
+				dequePtr->stolen++;
+			}
+		}
+		if (tile < 0)
+		{
+			return;
+		}
+
+		TileSchedRunTile(schedPtr, tile);
+		dequePtr->run++;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	TileSchedWorkers()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of workers TileSchedRun can run at once: 2 if CPU1 is
+**		running, otherwise 1. On Linux, the online CPUs up to
+**		TILE_SCHED_MAX_WORKERS.
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+u32 TileSchedWorkers()
+{
+#ifdef __linux__
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (cpus < 1)
+	{
+		return 1;
+	}
+
+	return (cpus > TILE_SCHED_MAX_WORKERS) ? TILE_SCHED_MAX_WORKERS : (u32) cpus;
+#else
+	return AmpIsRunning() ? 2 : 1;
+#endif
+}
+/* ------------------------------------------------------------ */
+
+/***	TileSchedRun(TileSched *schedPtr)
+**
+**	Parameters:
+**		schedPtr - Scheduler set up by TileSchedInit
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Runs every worker of the job and returns once all tiles are
+**		done. On the Zynq worker 0 runs on CPU0 and worker 1 on CPU1;
+**		a job set up for more workers than TileSchedWorkers() still
+**		finishes, as the workers that run steal the rest.
+**
+*/
+void TileSchedRun(TileSched *schedPtr)
+{
+#ifdef __linux__
+	pthread_t threads[TILE_SCHED_MAX_WORKERS];
+	TileSchedThread args[TILE_SCHED_MAX_WORKERS];
+	u32 started = 1;
+	u32 i;
+
+	for (i = 1; i < schedPtr->numWorkers; i++)
+	{
+		args[i].schedPtr = schedPtr;
+		args[i].worker = i;
+		if (pthread_create(&threads[i], NULL, TileSchedThreadMain, &args[i]) != 0)
+		{
+			break;
+		}
+		started++;
+	}
+	TileSchedWork(schedPtr, 0);
+	for (i = 1; i < started; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+#else
+	if (schedPtr->numWorkers == 1)
+	{
+		TileSchedWork(schedPtr, 0);
+	}
+	else
+	{
+		AmpRunOnBoth(TileSchedCore, schedPtr);
+	}
+#endif
+
+	TileSchedAddTotals(schedPtr);
+}
+/* ------------------------------------------------------------ */
+
+/***	TileSchedTotals(u32 worker, u32 *runPtr, u32 *stolenPtr)
+**
+**	Parameters:
+**		worker - Worker number
+**		runPtr - Set to the tiles the worker ran since start-up
+**		stolenPtr - Set to how many of those it stole
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Counts from TileSchedRun, for the profile screen.
+**
+*/
+void TileSchedTotals(u32 worker, u32 *runPtr, u32 *stolenPtr)
+{
+	if (worker >= TILE_SCHED_MAX_WORKERS)
+	{
+		*runPtr = 0;
+		*stolenPtr = 0;
+		return;
+	}
+
+	*runPtr = totalRun[worker];
+	*stolenPtr = totalStolen[worker];
+}
+
+#if defined(__linux__) && defined(TILE_SCHED_MAIN)
+/*
+ * Kernel with a skewed cost map: pixels in the region of interest get a
+ * box blur, the rest are only inverted
+ */
+static void TileSchedHostKernel(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	TileSchedHostJob *jobPtr = (TileSchedHostJob *) ref;
+	const TileSched *schedPtr = jobPtr->schedPtr;
+	const u8 *src = jobPtr->src;
+	u32 stride = jobPtr->stride;
+	u32 x, y, c;
+	int dx, dy;
+	int xs, ys;
+	u32 sum;
+
+	__atomic_fetch_add(&jobPtr->hits[(y0 / schedPtr->tileH) * schedPtr->cols + x0 / schedPtr->tileW], 1, __ATOMIC_RELAXED);
+
+	for (y = y0; y < y1; y++)
+	{
+		for (x = x0; x < x1; x++)
+		{
+			for (c = 0; c < 3; c++)
+			{
+				if (src[y * stride + x * 3] < TILE_SCHED_ROI_LEVEL)
+				{
+					jobPtr->dst[y * stride + x * 3 + c] = ~src[y * stride + x * 3 + c];
+					continue;
+				}
+
+				sum = 0;
+				for (dy = -TILE_SCHED_ROI_RADIUS; dy <= TILE_SCHED_ROI_RADIUS; dy++)
+				{
+					ys = (int) y + dy;
+					ys = (ys < 0) ? 0 : (ys >= (int) schedPtr->height) ? (int) schedPtr->height - 1 : ys;
+					for (dx = -TILE_SCHED_ROI_RADIUS; dx <= TILE_SCHED_ROI_RADIUS; dx++)
+					{
+						xs = (int) x + dx;
+						xs = (xs < 0) ? 0 : (xs >= (int) schedPtr->width) ? (int) schedPtr->width - 1 : xs;
+						sum += src[ys * stride + xs * 3 + c];
+					}
+				}
+				jobPtr->dst[y * stride + x * 3 + c] = sum / ((2 * TILE_SCHED_ROI_RADIUS + 1) * (2 * TILE_SCHED_ROI_RADIUS + 1));
+			}
+		}
+	}
+}
+
+/*
+ * Dark gradient with a bright disc in the lower right quarter, which is
+ * where nearly all of the work is
+ */
+static void TileSchedHostPattern(u8 *frame, u32 width, u32 height, u32 stride)
+{
+	u32 x, y;
+	int dx, dy;
+	int r = height / 3;
+
+	for (y = 0; y < height; y++)
+	{
+		for (x = 0; x < width; x++)
+		{
+			dx = (int) x - (int) (width * 3 / 4);
+			dy = (int) y - (int) (height * 3 / 4);
+			frame[y * stride + x * 3] = (dx * dx + dy * dy < r * r) ? 255 - (x & 0x3F) : (x + y) & 0x7F;
+			frame[y * stride + x * 3 + 1] = y;
+			frame[y * stride + x * 3 + 2] = x;
+		}
+	}
+}
+
+static u64 TileSchedHostUs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+ * Runs the host kernel reps times and checks the output against ref and
+ * that each tile ran once per rep. Returns 0 on a failure, otherwise the
+ * average microseconds per run.
+ */
+static u64 TileSchedHostRun(TileSchedHostJob *jobPtr, const u8 *ref, u32 width, u32 height, u32 tileW, u32 tileH,
+		u32 numWorkers, int fSteal, u32 reps, u32 *stolenPtr)
+{
+	TileSched sched;
+	u64 start, total = 0;
+	u32 i, rep;
+
+	*stolenPtr = 0;
+	for (rep = 0; rep < reps; rep++)
+	{
+		TileSchedInit(&sched, TileSchedHostKernel, jobPtr, width, height, tileW, tileH, numWorkers);
+		sched.fSteal = fSteal;
+		jobPtr->schedPtr = &sched;
+		memset(jobPtr->hits, 0, sched.numTiles * sizeof(u32));
+		memset(jobPtr->dst, 0, height * jobPtr->stride);
+
+		start = TileSchedHostUs();
+		TileSchedRun(&sched);
+		total += TileSchedHostUs() - start;
+
+		for (i = 0; i < sched.numTiles; i++)
+		{
+			if (jobPtr->hits[i] != 1)
+			{
+				printf("FAILED: tile %u ran %u times\n", (unsigned) i, (unsigned) jobPtr->hits[i]);
+				return 0;
+			}
+		}
+		if (ref != NULL && memcmp(ref, jobPtr->dst, height * jobPtr->stride) != 0)
+		{
+			printf("FAILED: output differs from one worker\n");
+			return 0;
+		}
+		for (i = 0; i < numWorkers; i++)
+		{
+			*stolenPtr += sched.deques[i].stolen;
+		}
+	}
+
+	return (total / reps) ? (total / reps) : 1;
+}
+
+int main(void)
+{
+	static const u32 tileWidths[] = {TILE_SCHED_TILE_W, 0};
+	TileSchedHostJob job;
+	u32 stride = TILE_SCHED_HOST_W * 3;
+	u32 size = stride * TILE_SCHED_HOST_H;
+	u8 *src, *ref;
+	u64 us, us1;
+	u32 stolen;
+	u32 maxWorkers = TileSchedWorkers();
+	u32 s, n;
+	int fSteal;
+
+	src = malloc(size);
+	ref = malloc(size);
+	job.dst = malloc(size);
+	job.hits = malloc(TILE_SCHED_HOST_W * TILE_SCHED_HOST_H * sizeof(u32));
+	if (src == NULL || ref == NULL || job.dst == NULL || job.hits == NULL)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	job.src = src;
+	job.stride = stride;
+	TileSchedHostPattern(src, TILE_SCHED_HOST_W, TILE_SCHED_HOST_H, stride);
+
+	if (TileSchedHostRun(&job, NULL, TILE_SCHED_HOST_W, TILE_SCHED_HOST_H, 0, TILE_SCHED_HOST_H, 1, 0, 1, &stolen) == 0)
+	{
+		return 1;
+	}
+	memcpy(ref, job.dst, size);
+
+	printf("%ux%u, region of interest in the lower right, %u CPUs\n\n", TILE_SCHED_HOST_W, TILE_SCHED_HOST_H, (unsigned) maxWorkers);
+	printf("%-12s %-8s %-10s %10s %8s %8s\n", "Tiles", "Workers", "Split", "ms/frame", "Speedup", "Stolen");
+	for (s = 0; s < sizeof(tileWidths) / sizeof(tileWidths[0]); s++)
+	{
+		us1 = 0;
+		for (n = 1; n <= TILE_SCHED_MAX_WORKERS; n *= 2)
+		{
+			for (fSteal = (n == 1); fSteal <= 1; fSteal++)
+			{
+				us = TileSchedHostRun(&job, ref, TILE_SCHED_HOST_W, TILE_SCHED_HOST_H, tileWidths[s], TILE_SCHED_TILE_H,
+						n, fSteal, TILE_SCHED_HOST_REPS, &stolen);
+				if (us == 0)
+				{
+					return 1;
+				}
+				if (n == 1)
+				{
+					us1 = us;
+				}
+				if (tileWidths[s])
+				{
+					printf("%3ux%-8u ", (unsigned) tileWidths[s], TILE_SCHED_TILE_H);
+				}
+				else
+				{
+					printf("%-3u lines    ", TILE_SCHED_TILE_H);
+				}
+				printf("%-8u %-10s %10.2f %7.2fx %8.1f\n", (unsigned) n, fSteal ? "stealing" : "even", us / 1000.0,
+						(double) us1 / us, (double) stolen / TILE_SCHED_HOST_REPS);
+			}
+		}
+	}
+	if (maxWorkers < TILE_SCHED_MAX_WORKERS)
+	{
+		printf("\nOnly %u CPUs, so the larger worker counts are time sliced\n", (unsigned) maxWorkers);
+	}
+
+	/*
+	 * Many short jobs of small tiles, so the last tile of a deque is fought
+	 * over as often as possible
+	 */
+	if (TileSchedHostRun(&job, NULL, TILE_SCHED_RACE_W, TILE_SCHED_RACE_H, 16, 8, TILE_SCHED_MAX_WORKERS, 1,
+			TILE_SCHED_RACE_RUNS, &stolen) == 0)
+	{
+		return 1;
+	}
+	printf("\nRace check: %u runs of %ux%u in 16x8 tiles on %u workers, every tile ran once, %u stolen\n",
+			TILE_SCHED_RACE_RUNS, TILE_SCHED_RACE_W, TILE_SCHED_RACE_H, TILE_SCHED_MAX_WORKERS, (unsigned) stolen);
+
+	free(src);
+	free(ref);
+	free(job.dst);
+	free(job.hits);
+
+	return 0;
+}
+#endif
+
+/************************************************************************/
@@ -0,0 +1,135 @@
+/************************************************************************/
+/*																		*/
+/*	tile_sched.h	--	Work stealing tile scheduler for the frame		*/
+/*						functions										*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Cuts a frame job into tiles and shares them between workers,	*/
+/*		one per core. Splitting the lines evenly, as AmpRunBands does,	*/
+/*		leaves one core idle whenever the cost of a line depends on		*/
+/*		the picture (regions of interest, skipped tiles, early outs).	*/
+/*		Here each worker starts with an even, contiguous share of the	*/
+/*		tiles in its own deque and works through it from the top of		*/
+/*		the frame down. A worker whose deque is empty steals from the	*/
+/*		far end of another's, so the cores finish within one tile of	*/
+/*		each other whatever the cost map looks like.					*/
+/*																		*/
+/*		Tiles are tileW x tileH pixels, clipped at the frame edges.		*/
+/*		A tileW of 0 gives full width bands of tileH lines, for			*/
+/*		kernels that can't start in the middle of a line cheaply.		*/
+/*																		*/
+/*		The deques are Chase-Lev deques without a push: the owner		*/
+/*		takes from the bottom without a lock, thieves take from the		*/
+/*		top with a compare and swap, and only the last tile of a		*/
+/*		deque is ever contended. The tiles of a job are known up		*/
+/*		front, so a deque is just a range of tile numbers. The			*/
+/*		scheduler state must be in shareable cacheable memory, such		*/
+/*		as the stack of CPU0, for the exclusive accesses to work		*/
+/*		between the cores.												*/
+/*																		*/
+/*		On the Zynq, TileSchedRun runs the workers on CPU0 and CPU1		*/
+/*		through amp. Tile functions run on both cores at once, so		*/
+/*		they must only write their own tile, and must not print,		*/
+/*		profile or touch fb_policy.										*/
+/*																		*/
+/*		On Linux the module builds with pthreads instead. With			*/
+/*		TILE_SCHED_MAIN defined it is a stand-alone host program that	*/
+/*		measures scaling with the number of workers on a kernel with	*/
+/*		a skewed cost map, and checks every tile runs exactly once		*/
+/*		and the output matches one worker:								*/
+/*			gcc -O2 -pthread -DTILE_SCHED_MAIN -I<bsp>/include -I.		*/
+/*				tile_sched/tile_sched.c -o tile_sched					*/
+/*		Add -fsanitize=thread to check the kernel data for races too.	*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Write the kernel as a TileSchedFn that processes the			*/
+/*		   pixels [x0, x1) x [y0, y1).									*/
+/*		2) Call TileSchedInit with TileSchedWorkers() workers, then		*/
+/*		   TileSchedRun.												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef TILE_SCHED_H_
+#define TILE_SCHED_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Default tile size
+ */
+#define TILE_SCHED_TILE_W 128
+#define TILE_SCHED_TILE_H 64
+
+#define TILE_SCHED_MAX_WORKERS 4
+
+/*
+ * Deques are padded to this, so workers don't share a cache line
+ */
+#define TILE_SCHED_LINE 64
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Processes the pixels [x0, x1) x [y0, y1) of the job described by ref
+ */
+typedef void (*TileSchedFn)(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+
+/*
+ * Tiles of one worker. Slots [top, bottom) are left; slot s holds tile
+ * mirror - s, so the owner, taking from the bottom, goes through its share
+ * in frame order and thieves take the tiles furthest from it.
+ */
+typedef struct {
+		s32 top; /* Changed by thieves and the owner */
+		s32 bottom; /* Changed by the owner only */
+		s32 mirror;
+		u32 run; /* Tiles this worker ran, stolen ones included */
+		u32 stolen; /* Tiles this worker took from other deques */
+} __attribute__((aligned(TILE_SCHED_LINE))) TileSchedDeque;
+
+typedef struct {
+		TileSchedFn fn;
+		void *ref;
+		u32 width;
+		u32 height;
+		u32 tileW;
+		u32 tileH;
+		u32 cols; /* Tiles per row */
+		u32 numTiles;
+		u32 numWorkers;
+		int fSteal; /* Cleared to measure the plain even split */
+		TileSchedDeque deques[TILE_SCHED_MAX_WORKERS];
+} TileSched;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int TileSchedInit(TileSched *schedPtr, TileSchedFn fn, void *ref, u32 width, u32 height, u32 tileW, u32 tileH, u32 numWorkers);
+void TileSchedWork(TileSched *schedPtr, u32 worker);
+u32 TileSchedWorkers();
+void TileSchedRun(TileSched *schedPtr);
+void TileSchedTotals(u32 worker, u32 *runPtr, u32 *stolenPtr);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* TILE_SCHED_H_ */
@@ -12,6 +12,11 @@
 /*		Code from this module will cause conflicts with other code that */
 /*		requires the Zynq's scu timer.									*/
 /*																		*/
+/*		The scu timer also drives a small software timer service with	*/
+/*		one-shot and periodic callbacks. The timer is not ticked; it is	*/
+/*		reprogrammed to interrupt at the next deadline only. A			*/
+/*		monotonic microsecond clock is read from the global timer.		*/
+/*																		*/
 /*		This module contains code from the Xilinx Demo titled			*/
 /*		"xscutimer_polled_example.c"									*/
 /*																		*/
@@ -19,6 +24,9 @@
 /*  Revision History:													*/
 /* 																		*/
 /*		2/14/2014(SamB): Created										*/
+/*		10/19/2026: Added interrupt driven timer service, TimerGetUs	*/
+/*					and TimerSleep. TimerDelay no longer spins on the	*/
+/*					scu timer.											*/
 /*																		*/
 /************************************************************************/
 
@@ -29,6 +37,37 @@
 #include "timer_ps.h"
 #include "xscutimer.h"
 #include "xil_types.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * The global timer and the scu private timer are both clocked at half the
+ * CPU clock, so deadlines are kept in global timer ticks and loaded into
+ * the private timer unconverted.
+ */
+#define TIMER_TICKS_PER_US (TIMER_FREQ_HZ / 1000000)
+
+/*
+ * Shortest interval loaded into the scu timer, so a deadline that is already
+ * due still produces an interrupt instead of being missed
+ */
+#define TIMER_MIN_LOAD 64
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	XTime deadline; /* Global timer value at which the callback is due */
+	XTime period; /* Reload interval in ticks, 0 for one-shot timers */
+	TimerCallBack callBack; /* NULL if the slot is free */
+	void *callBackRef;
+} SoftTimer;
 
 /* ------------------------------------------------------------ */
 /*				Global Variables								*/
@@ -36,6 +75,18 @@
 
 XScuTimer TimerInstance;	/* Cortex A9 Scu Private Timer Instance */
 
+static SoftTimer softTimers[TIMER_MAX_SOFT];
+static volatile int fServiceStarted = 0;
+
+/* ------------------------------------------------------------ */
+/*				Local Procedure Declarations					*/
+/* ------------------------------------------------------------ */
+
+static XTime TimerNow();
+static int TimerAdd(XTime delay, XTime period, TimerCallBack CallBackFunc, void *CallBackRef);
+static void TimerReprogram();
+static void TimerDelayDone(void *callBackRef);
+
 /* ------------------------------------------------------------ */
 /*				Procedure Definitions							*/
 /* ------------------------------------------------------------ */
@@ -73,7 +124,7 @@ int TimerInitialize(u16 TimerDeviceId)
 	 */
 	Status = XScuTimer_CfgInitialize(TimerInstancePtr, ConfigTmrPtr,
 			ConfigTmrPtr->BaseAddr);
-	if (Status != XST_SUCCESS || Status != XST_DEVICE_IS_STARTED) {
+	if (Status != XST_SUCCESS && Status != XST_DEVICE_IS_STARTED) {
 		return XST_FAILURE;
 	}
 
@@ -97,23 +148,341 @@ int TimerInitialize(u16 TimerDeviceId)
 **
 **	Description: Blocks execution for the desired amount of time.
 **			TimerInitialize must have been called at least once
-**			before calling this function.
+**			before calling this function. Once the timer service is
+**			started the core sleeps in WFI until a one-shot timer
+**			ends the delay, otherwise the global timer is polled.
+**			Must not be called from a timer callback.
 */
 /* ------------------------------------------------------------ */
 void TimerDelay(u32 uSDelay)
 {
-	u32 timerCnt;
+	volatile int fDone = 0;
+	XTime end;
+	u32 cpsr;
+
+	end = TimerNow() + ((XTime) uSDelay) * TIMER_TICKS_PER_US;
+
+	if (fServiceStarted && TimerAddOneShot(uSDelay, TimerDelayDone, (void *) &fDone) >= 0)
+	{
+		/*
+		 * Check the flag with IRQs masked so the interrupt cannot slip in
+		 * between the check and the WFI. A pending IRQ still wakes the core,
+		 * and it is taken as soon as IRQs are unmasked again.
+		 */
+		cpsr = mfcpsr();
+		mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+		while (!fDone)
+		{
+			TimerSleep();
+			mtcpsr(cpsr);
+			mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+		}
+		mtcpsr(cpsr);
+		return;
+	}
 
-	timerCnt = (TIMER_FREQ_HZ / 1000000) * uSDelay;
+	while (TimerNow() < end)
+	{}
+
+	return;
+}
+/* ------------------------------------------------------------ */
 
+/***	TimerStartService()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description: Starts the interrupt driven timer service. The
+**			interrupt controller must already be enabled with the
+**			timerIvt entry in its vector table. Timers added before
+**			this call start counting immediately but are not
+**			delivered until the service is started.
+*/
+void TimerStartService()
+{
 	XScuTimer_Stop(&TimerInstance);
 	XScuTimer_DisableAutoReload(&TimerInstance);
-	XScuTimer_LoadTimer(&TimerInstance, timerCnt);
+	XScuTimer_ClearInterruptStatus(&TimerInstance);
+	XScuTimer_EnableInterrupt(&TimerInstance);
+	fServiceStarted = 1;
+	TimerReprogram();
+}
+/* ------------------------------------------------------------ */
+
+/***	TimerAddOneShot(u32 uSDelay, TimerCallBack CallBackFunc, void *CallBackRef)
+**
+**	Parameters:
+**		uSDelay - Time until the callback is called, in micro seconds
+**		CallBackFunc - Callback function
+**		CallBackRef - Data to pass to callback function
+**
+**	Return Value: int
+**		Handle that can be passed to TimerCancel, or -1 if all
+**		TIMER_MAX_SOFT timers are in use
+**
+**	Errors:
+**
+**	Description: Calls CallBackFunc once, from interrupt context, after
+**			uSDelay micro seconds. The slot is freed before the
+**			callback runs.
+*/
+int TimerAddOneShot(u32 uSDelay, TimerCallBack CallBackFunc, void *CallBackRef)
+{
+	return TimerAdd(((XTime) uSDelay) * TIMER_TICKS_PER_US, 0, CallBackFunc, CallBackRef);
+}
+/* ------------------------------------------------------------ */
+
+/***	TimerAddPeriodic(u32 uSPeriod, TimerCallBack CallBackFunc, void *CallBackRef)
+**
+**	Parameters:
+**		uSPeriod - Callback period, in micro seconds
+**		CallBackFunc - Callback function
+**		CallBackRef - Data to pass to callback function
+**
+**	Return Value: int
+**		Handle that can be passed to TimerCancel, or -1 if all
+**		TIMER_MAX_SOFT timers are in use
+**
+**	Errors:
+**
+**	Description: Calls CallBackFunc from interrupt context every
+**			uSPeriod micro seconds until it is cancelled. Deadlines
+**			do not drift; if the callback falls a whole period
+**			behind, the missed calls are dropped.
+*/
+int TimerAddPeriodic(u32 uSPeriod, TimerCallBack CallBackFunc, void *CallBackRef)
+{
+	XTime period = ((XTime) uSPeriod) * TIMER_TICKS_PER_US;
+
+	if (period == 0)
+	{
+		return -1;
+	}
+	return TimerAdd(period, period, CallBackFunc, CallBackRef);
+}
+/* ------------------------------------------------------------ */
+
+/***	TimerCancel(int handle)
+**
+**	Parameters:
+**		handle - Handle returned by TimerAddOneShot/TimerAddPeriodic
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description: Stops a software timer. Cancelling a one-shot timer
+**			that already fired is harmless as long as its slot has
+**			not been reused.
+*/
+void TimerCancel(int handle)
+{
+	u32 cpsr;
+
+	if (handle < 0 || handle >= TIMER_MAX_SOFT)
+	{
+		return;
+	}
+
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	softTimers[handle].callBack = NULL;
+	TimerReprogram();
+	mtcpsr(cpsr);
+}
+/* ------------------------------------------------------------ */
+
+/***	TimerGetUs()
+**
+**	Parameters:
+**
+**	Return Value: u64
+**		Micro seconds counted by the global timer since it was reset
+**
+**	Errors:
+**
+**	Description: Monotonic clock, safe to call from any context and
+**			before TimerInitialize.
+*/
+u64 TimerGetUs()
+{
+	return TimerNow() / TIMER_TICKS_PER_US;
+}
+/* ------------------------------------------------------------ */
+
+/***	TimerSleep()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description: Puts the core to sleep until the next interrupt. Use
+**			in wait loops in place of spinning. The core also wakes
+**			if IRQs are masked, which lets callers check their wake
+**			condition with IRQs masked and sleep without a race.
+*/
+void TimerSleep()
+{
+	dsb();
+	__asm__ __volatile__ ("wfi" : : : "memory");
+}
+/* ------------------------------------------------------------ */
+
+/***	TimerIsr(void *InstancePtr)
+**
+**	Parameters:
+**		InstancePtr - unused
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description: scu timer interrupt handler. Runs every callback that
+**			is due and reloads the timer for the next deadline.
+*/
+void TimerIsr(void *InstancePtr)
+{
+	int i;
+	XTime now;
+	TimerCallBack callBack;
+
+	XScuTimer_ClearInterruptStatus(&TimerInstance);
+
+	now = TimerNow();
+	for (i = 0; i < TIMER_MAX_SOFT; i++)
+	{
+		callBack = softTimers[i].callBack;
+		if (callBack == NULL || softTimers[i].deadline > now)
+		{
+			continue;
+		}
+
+		if (softTimers[i].period)
+		{
+			softTimers[i].deadline += softTimers[i].period;
+			if (softTimers[i].deadline <= now)
+			{
+				softTimers[i].deadline = now + softTimers[i].period;
+			}
+		}
+		else
+		{
+			softTimers[i].callBack = NULL;
+		}
+
+		callBack(softTimers[i].callBackRef);
+	}
+
+	TimerReprogram();
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Reads the 64-bit global timer
+ */
+static XTime TimerNow()
+{
+	XTime now;
+
+	XTime_GetTime(&now);
+	return now;
+}
+
+/*
+ * Claims a free slot. IRQs are masked so this can be called from both the
+ * main loop and timer callbacks.
+ */
+static int TimerAdd(XTime delay, XTime period, TimerCallBack CallBackFunc, void *CallBackRef)
+{
+	int i;
+	int handle = -1;
+	u32 cpsr;
+
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	for (i = 0; i < TIMER_MAX_SOFT; i++)
+	{
+		if (softTimers[i].callBack == NULL)
+		{
+			softTimers[i].deadline = TimerNow() + delay;
+			softTimers[i].period = period;
+			softTimers[i].callBackRef = CallBackRef;
+			softTimers[i].callBack = CallBackFunc;
+			handle = i;
+			break;
+		}
+	}
+	if (handle >= 0)
+	{
+		TimerReprogram();
+	}
+	mtcpsr(cpsr);
+
+	return handle;
+}
+
+/*
+ * Loads the scu timer so that it expires at the earliest pending deadline,
+ * or stops it if no timers are active. Must be called with IRQs masked.
+ */
+static void TimerReprogram()
+{
+	int i;
+	int fActive = 0;
+	XTime next = 0;
+	XTime now;
+	XTime load;
+
+	if (!fServiceStarted)
+	{
+		return;
+	}
+
+	for (i = 0; i < TIMER_MAX_SOFT; i++)
+	{
+		if (softTimers[i].callBack != NULL && (!fActive || softTimers[i].deadline < next))
+		{
+			next = softTimers[i].deadline;
+			fActive = 1;
+		}
+	}
+
+	XScuTimer_Stop(&TimerInstance);
+	if (!fActive)
+	{
+		return;
+	}
+
+	now = TimerNow();
+	load = (next > now) ? (next - now) : 0;
+	if (load < TIMER_MIN_LOAD)
+	{
+		load = TIMER_MIN_LOAD;
+	}
+	else if (load > 0xFFFFFFFF)
+	{
+		/*
+		 * Too far away for the 32-bit timer, wake up early and reload
+		 */
+		load = 0xFFFFFFFF;
+	}
+
+	XScuTimer_LoadTimer(&TimerInstance, (u32) load);
 	XScuTimer_Start(&TimerInstance);
-	while (XScuTimer_GetCounterValue(&TimerInstance))
-	{}
+}
 
-	return;
+/*
+ * One-shot callback used by TimerDelay
+ */
+static void TimerDelayDone(void *callBackRef)
+{
+	*((volatile int *) callBackRef) = 1;
 }
 
 /************************************************************************/
@@ -12,6 +12,18 @@
 /*		Code from this module will cause conflicts with other code that */
 /*		requires the Zynq's scu timer.									*/
 /*																		*/
+/*		The scu timer also drives a small software timer service with	*/
+/*		one-shot and periodic callbacks. The timer is not ticked; it is	*/
+/*		reprogrammed to interrupt at the next deadline only. A			*/
+/*		monotonic microsecond clock is read from the global timer.		*/
+/*																		*/
+/*		To use the timer service:										*/
+/*		1) Call TimerInitialize.										*/
+/*		2) Add timerIvt to the interrupt vector table passed to			*/
+/*		   fnEnableInterrupts.											*/
+/*		3) Call TimerStartService.										*/
+/*		4) Add callbacks with TimerAddOneShot/TimerAddPeriodic.			*/
+/*																		*/
 /*		This module contains code from the Xilinx Demo titled			*/
 /*		"xscutimer_polled_example.c"									*/
 /*																		*/
@@ -19,6 +31,9 @@
 /*  Revision History:													*/
 /* 																		*/
 /*		2/14/2014(SamB): Created										*/
+/*		10/19/2026: Added interrupt driven timer service, TimerGetUs	*/
+/*					and TimerSleep. TimerDelay no longer spins on the	*/
+/*					scu timer.											*/
 /*																		*/
 /************************************************************************/
 #ifndef TIMER_PS_H_
@@ -33,12 +48,40 @@
 
 #define TIMER_FREQ_HZ (XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2)
 
+/*
+ * Number of software timers that can be active at once
+ */
+#define TIMER_MAX_SOFT 8
+
+/*
+ * Macro for the timer IVT.
+ * 	x=SCU private timer Interrupt ID (XPAR_SCUTIMER_INTR)
+ */
+#define timerIvt(x)\
+	{x, (XInterruptHandler)TimerIsr, NULL, 0xA8, 0x3}
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * typedef for software timer callbacks. Called from interrupt context.
+ */
+typedef void (*TimerCallBack)(void *callBackRef);
+
 /* ------------------------------------------------------------ */
 /*					Procedure Declarations						*/
 /* ------------------------------------------------------------ */
 
 int TimerInitialize(u16 TimerDeviceId);
 void TimerDelay(u32 uSDelay);
+void TimerStartService();
+int TimerAddOneShot(u32 uSDelay, TimerCallBack CallBackFunc, void *CallBackRef);
+int TimerAddPeriodic(u32 uSPeriod, TimerCallBack CallBackFunc, void *CallBackRef);
+void TimerCancel(int handle);
+u64 TimerGetUs();
+void TimerSleep();
+void TimerIsr(void *InstancePtr);
 
 /* ------------------------------------------------------------ */
 
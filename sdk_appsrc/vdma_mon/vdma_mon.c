@@ -0,0 +1,329 @@
+/************************************************************************/
+/*																		*/
+/*	vdma_mon.c	--	Continuous AXI VDMA error monitor					*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Counts VDMA channel errors from the error interrupts and a		*/
+/*		periodic status sample, and keeps per second history. See		*/
+/*		vdma_mon.h.														*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "vdma_mon.h"
+#include "xstatus.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "../timer_ps/timer_ps.h"
+#include "../uart_ps/uart_ps.h"
+#include <string.h>
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Status register bit counted by each error counter
+ */
+static const u32 errMasks[VDMA_MON_NUM_ERRORS] = {
+	XAXIVDMA_SR_ERR_INTERNAL_MASK,
+	XAXIVDMA_SR_ERR_SLAVE_MASK,
+	XAXIVDMA_SR_ERR_DECODE_MASK,
+	XAXIVDMA_SR_ERR_FSZ_LESS_MASK,
+	XAXIVDMA_SR_ERR_LSZ_LESS_MASK,
+	XAXIVDMA_SR_ERR_FSZ_MORE_MASK,
+	VDMA_MON_SR_EOL_LATE_MASK
+};
+
+static const char *errNames[VDMA_MON_NUM_ERRORS] = {
+	"Internal", "Slave", "Decode", "SOF early", "EOL early", "SOF late", "EOL late"
+};
+
+static const char *chanNames[VDMA_MON_NUM_CHANNELS] = {"MM2S", "S2MM"};
+
+/*
+ * Driver direction of each channel index
+ */
+static const u16 chanDirs[VDMA_MON_NUM_CHANNELS] = {XAXIVDMA_READ, XAXIVDMA_WRITE};
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Counts and clears the error bits set in the status register of one
+ * channel. Returns the status register as read.
+ */
+static u32 VdmaMonCount(VdmaMon *monPtr, int chan)
+{
+	u32 status;
+	u32 errors;
+	int i;
+
+	status = XAxiVdma_GetStatus(monPtr->vdma, chanDirs[chan]);
+	errors = status & (XAXIVDMA_SR_ERR_ALL_MASK | VDMA_MON_SR_EOL_LATE_MASK);
+	if (errors == 0)
+	{
+		return status;
+	}
+
+	for (i = 0; i < VDMA_MON_NUM_ERRORS; i++)
+	{
+		if (errors & errMasks[i])
+		{
+			if (monPtr->cur.errors[chan][i] != 0xFFFF)
+			{
+				monPtr->cur.errors[chan][i]++;
+			}
+			monPtr->total[chan][i]++;
+		}
+	}
+	XAxiVdma_ClearDmaChannelErrors(monPtr->vdma, chanDirs[chan], errors);
+
+	return status;
+}
+
+/*
+ * Error callbacks of the VDMA driver, called from the channel interrupt
+ */
+static void VdmaMonReadErr(void *callBackRef, u32 mask)
+{
+	VdmaMon *monPtr = (VdmaMon *) callBackRef;
+
+	monPtr->irqCount[VDMA_MON_MM2S]++;
+	VdmaMonCount(monPtr, VDMA_MON_MM2S);
+}
+
+static void VdmaMonWriteErr(void *callBackRef, u32 mask)
+{
+	VdmaMon *monPtr = (VdmaMon *) callBackRef;
+
+	monPtr->irqCount[VDMA_MON_S2MM]++;
+	VdmaMonCount(monPtr, VDMA_MON_S2MM);
+}
+
+/*
+ * The driver interrupt handlers return without acknowledging anything
+ * unless a completion callback is set, so one is needed even though only
+ * the error interrupt is enabled
+ */
+static void VdmaMonCompletion(void *callBackRef, u32 mask)
+{
+}
+
+/*
+ * Timer callback. Picks up errors that did not interrupt, re-enables the
+ * error interrupts and files the finished sample.
+ */
+static void VdmaMonTick(void *callBackRef)
+{
+	VdmaMon *monPtr = (VdmaMon *) callBackRef;
+	int chan;
+
+	for (chan = 0; chan < VDMA_MON_NUM_CHANNELS; chan++)
+	{
+		monPtr->cur.status[chan] = VdmaMonCount(monPtr, chan);
+		XAxiVdma_IntrEnable(monPtr->vdma, XAXIVDMA_IXR_ERROR_MASK, chanDirs[chan]);
+	}
+	monPtr->cur.timeUs = TimerGetUs();
+
+	monPtr->history[monPtr->head] = monPtr->cur;
+	monPtr->head = (monPtr->head + 1) % VDMA_MON_HISTORY;
+	if (monPtr->numSamples < VDMA_MON_HISTORY)
+	{
+		monPtr->numSamples++;
+	}
+
+	memset(&monPtr->cur, 0, sizeof(monPtr->cur));
+	monPtr->cur.activity = monPtr->activity;
+}
+/* ------------------------------------------------------------ */
+
+/***	VdmaMonInit(VdmaMon *monPtr, XAxiVdma *vdma)
+**
+**	Parameters:
+**		monPtr - Pointer to the struct that will hold the monitor state
+**		vdma - Pointer to the initialized VDMA driver struct
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_FAILURE if no software timer is free
+**
+**	Errors:
+**
+**	Description:
+**		Clears the counters, hooks the driver error callbacks, enables
+**		the error interrupt of both channels and starts sampling every
+**		VDMA_MON_PERIOD_US. Errors already latched are counted in the
+**		first sample.
+**
+*/
+int VdmaMonInit(VdmaMon *monPtr, XAxiVdma *vdma)
+{
+	int chan;
+
+	memset(monPtr, 0, sizeof(*monPtr));
+	monPtr->vdma = vdma;
+
+	XAxiVdma_SetCallBack(vdma, XAXIVDMA_HANDLER_GENERAL, (void *) VdmaMonCompletion, monPtr, XAXIVDMA_READ);
+	XAxiVdma_SetCallBack(vdma, XAXIVDMA_HANDLER_ERROR, (void *) VdmaMonReadErr, monPtr, XAXIVDMA_READ);
+	XAxiVdma_SetCallBack(vdma, XAXIVDMA_HANDLER_GENERAL, (void *) VdmaMonCompletion, monPtr, XAXIVDMA_WRITE);
+	XAxiVdma_SetCallBack(vdma, XAXIVDMA_HANDLER_ERROR, (void *) VdmaMonWriteErr, monPtr, XAXIVDMA_WRITE);
+	for (chan = 0; chan < VDMA_MON_NUM_CHANNELS; chan++)
+	{
+		XAxiVdma_IntrEnable(vdma, XAXIVDMA_IXR_ERROR_MASK, chanDirs[chan]);
+	}
+
+	monPtr->timer = TimerAddPeriodic(VDMA_MON_PERIOD_US, VdmaMonTick, monPtr);
+	if (monPtr->timer < 0)
+	{
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	VdmaMonSetActivity(VdmaMon *monPtr, const char *activity)
+**
+**	Parameters:
+**		monPtr - Pointer to the initialized VdmaMon struct
+**		activity - Short name of what the CPU is doing, or NULL. Must
+**				remain valid, normally a string literal.
+**
+**	Return Value:
+**
+**	Description:
+**		Names the current CPU activity. Each sample keeps the last name
+**		set while it was counted, or the one carried over from the
+**		previous sample.
+**
+*/
+void VdmaMonSetActivity(VdmaMon *monPtr, const char *activity)
+{
+	monPtr->activity = activity;
+	monPtr->cur.activity = activity;
+}
+/* ------------------------------------------------------------ */
+
+/***	VdmaMonGetSample(VdmaMon *monPtr, u32 age, VdmaMonSample *samplePtr)
+**
+**	Parameters:
+**		monPtr - Pointer to the initialized VdmaMon struct
+**		age - 0 for the most recent finished sample, 1 for the one
+**				before, and so on
+**		samplePtr - Receives a copy of the sample
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_NO_DATA if fewer than age + 1 samples are kept
+**
+**	Description:
+**		Copies one sample out of the history with the timer interrupt
+**		masked, so it is never seen half written.
+**
+*/
+int VdmaMonGetSample(VdmaMon *monPtr, u32 age, VdmaMonSample *samplePtr)
+{
+	u32 cpsr;
+	int status = XST_NO_DATA;
+
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	if (age < monPtr->numSamples)
+	{
+		*samplePtr = monPtr->history[(monPtr->head + VDMA_MON_HISTORY - 1 - age) % VDMA_MON_HISTORY];
+		status = XST_SUCCESS;
+	}
+	mtcpsr(cpsr);
+
+	return status;
+}
+/* ------------------------------------------------------------ */
+
+/***	VdmaMonPrint(VdmaMon *monPtr, u32 seconds)
+**
+**	Parameters:
+**		monPtr - Pointer to the initialized VdmaMon struct
+**		seconds - Number of most recent samples to list
+**
+**	Return Value:
+**
+**	Description:
+**		Prints the error totals of both channels, then the recent
+**		samples that had errors, oldest first, with the channel status
+**		and CPU activity of each.
+**
+*/
+void VdmaMonPrint(VdmaMon *monPtr, u32 seconds)
+{
+	VdmaMonSample sample;
+	int chan;
+	int i;
+	u32 age;
+	u32 sum;
+
+	UartPrintf("%-10s", "Totals");
+	for (i = 0; i < VDMA_MON_NUM_ERRORS; i++)
+	{
+		UartPrintf(" %9s", errNames[i]);
+	}
+	UartPrintf(" %9s\n\r", "IRQs");
+	for (chan = 0; chan < VDMA_MON_NUM_CHANNELS; chan++)
+	{
+		UartPrintf("%-10s", chanNames[chan]);
+		for (i = 0; i < VDMA_MON_NUM_ERRORS; i++)
+		{
+			UartPrintf(" %9lu", (unsigned long) monPtr->total[chan][i]);
+		}
+		UartPrintf(" %9lu\n\r", (unsigned long) monPtr->irqCount[chan]);
+	}
+
+	UartPrintf("\n\rSeconds with errors (time, channel, errors, status, activity):\n\r");
+	if (seconds > VDMA_MON_HISTORY)
+	{
+		seconds = VDMA_MON_HISTORY;
+	}
+	for (age = seconds; age-- > 0;)
+	{
+		if (VdmaMonGetSample(monPtr, age, &sample) != XST_SUCCESS)
+		{
+			continue;
+		}
+		for (chan = 0; chan < VDMA_MON_NUM_CHANNELS; chan++)
+		{
+			sum = 0;
+			for (i = 0; i < VDMA_MON_NUM_ERRORS; i++)
+			{
+				sum += sample.errors[chan][i];
+			}
+			if (sum == 0)
+			{
+				continue;
+			}
+			UartPrintf("%8llu.%03llu %s", (unsigned long long) (sample.timeUs / 1000000),
+					(unsigned long long) ((sample.timeUs / 1000) % 1000), chanNames[chan]);
+			for (i = 0; i < VDMA_MON_NUM_ERRORS; i++)
+			{
+				if (sample.errors[chan][i] != 0)
+				{
+					UartPrintf(" %s:%u", errNames[i], sample.errors[chan][i]);
+				}
+			}
+			UartPrintf(" SR=0x%08lx %s\n\r", (unsigned long) sample.status[chan],
+					(sample.activity != NULL) ? sample.activity : "-");
+		}
+	}
+}
+
+/************************************************************************/
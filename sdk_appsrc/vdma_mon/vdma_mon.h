@@ -0,0 +1,136 @@
+/************************************************************************/
+/*																		*/
+/*	vdma_mon.h	--	Continuous AXI VDMA error monitor					*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Counts VDMA channel errors per channel and per second and		*/
+/*		keeps the last VDMA_MON_HISTORY seconds in a ring, so a			*/
+/*		dropout on the display or in the capture can be matched with	*/
+/*		what the CPU was doing at the time.								*/
+/*																		*/
+/*		Errors are counted from two places. The error interrupt of		*/
+/*		each channel reads the status register, counts the error bits	*/
+/*		that are set and clears them. Once per period a timer callback	*/
+/*		also samples both status registers, which catches errors		*/
+/*		raised while the interrupt was disabled (a VDMA reset, as done	*/
+/*		by VideoStop, clears the interrupt enables) and turns the		*/
+/*		error interrupt back on.										*/
+/*																		*/
+/*		The frame size errors are the closest thing the VDMA reports	*/
+/*		to underflow and overflow: SOF/EOL early mean a frame or line	*/
+/*		ended before the programmed size was moved, SOF/EOL late (S2MM	*/
+/*		only) that the input delivered more than programmed.			*/
+/*		Internal, slave and decode errors are AXI errors and halt the	*/
+/*		channel.														*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Add vdmaMonReadIvt and vdmaMonWriteIvt to the interrupt		*/
+/*		   vector table passed to fnEnableInterrupts.					*/
+/*		2) After TimerStartService, call VdmaMonInit.					*/
+/*		3) Optionally name what the CPU is doing with					*/
+/*		   VdmaMonSetActivity; the name is kept with each sample.		*/
+/*		4) Read samples with VdmaMonGetSample or print them with		*/
+/*		   VdmaMonPrint.												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef VDMA_MON_H_
+#define VDMA_MON_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "xaxivdma.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Length of one sample and number of samples kept
+ */
+#define VDMA_MON_PERIOD_US 1000000
+#define VDMA_MON_HISTORY 64
+
+/*
+ * Channel indices
+ */
+#define VDMA_MON_MM2S 0
+#define VDMA_MON_S2MM 1
+#define VDMA_MON_NUM_CHANNELS 2
+
+/*
+ * Error counter indices, one per status register error bit
+ */
+#define VDMA_MON_ERR_INTERNAL 0
+#define VDMA_MON_ERR_SLAVE 1
+#define VDMA_MON_ERR_DECODE 2
+#define VDMA_MON_ERR_SOF_EARLY 3
+#define VDMA_MON_ERR_EOL_EARLY 4
+#define VDMA_MON_ERR_SOF_LATE 5
+#define VDMA_MON_ERR_EOL_LATE 6
+#define VDMA_MON_NUM_ERRORS 7
+
+/*
+ * EOL late error bit of the S2MM status register, which xaxivdma_hw.h does
+ * not define
+ */
+#define VDMA_MON_SR_EOL_LATE_MASK 0x00008000
+
+/*
+ * Macros for the VDMA IVTs. Errors are not urgent, so they run below every
+ * other source.
+ * 	x=MM2S or S2MM Interrupt ID
+ * 	y=pointer to the XAxiVdma struct
+ */
+#define vdmaMonReadIvt(x,y)\
+	{x, (XInterruptHandler)XAxiVdma_ReadIntrHandler, y, 0xC0, 0x3}
+#define vdmaMonWriteIvt(x,y)\
+	{x, (XInterruptHandler)XAxiVdma_WriteIntrHandler, y, 0xC0, 0x3}
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u64 timeUs; /* TimerGetUs at the end of the sample */
+		u16 errors[VDMA_MON_NUM_CHANNELS][VDMA_MON_NUM_ERRORS];
+		u32 status[VDMA_MON_NUM_CHANNELS]; /* Status register at the end of the sample */
+		const char *activity; /* Last activity set during the sample, or NULL */
+} VdmaMonSample;
+
+typedef struct {
+		XAxiVdma *vdma;
+		int timer; /* Handle of the periodic sampling timer */
+		VdmaMonSample cur; /* Sample being counted */
+		VdmaMonSample history[VDMA_MON_HISTORY];
+		u32 head; /* Slot the next finished sample goes in */
+		u32 numSamples; /* Finished samples, saturates at VDMA_MON_HISTORY */
+		u32 total[VDMA_MON_NUM_CHANNELS][VDMA_MON_NUM_ERRORS]; /* Since VdmaMonInit */
+		u32 irqCount[VDMA_MON_NUM_CHANNELS]; /* Error interrupts taken */
+		const char *activity;
+} VdmaMon;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int VdmaMonInit(VdmaMon *monPtr, XAxiVdma *vdma);
+void VdmaMonSetActivity(VdmaMon *monPtr, const char *activity);
+int VdmaMonGetSample(VdmaMon *monPtr, u32 age, VdmaMonSample *samplePtr);
+void VdmaMonPrint(VdmaMon *monPtr, u32 seconds);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* VDMA_MON_H_ */
@@ -59,6 +59,8 @@
  * Ver   Who          Date         Changes
  * ----- ------------ -----------  -----------------------------------------------
  * 1.00  Sam Bobrowicz 2015-Nov-25 First Release
+ * 1.01               2026-Oct-19 Framebuffer pixel format taken from the S2MM
+ *                                 stream width
  *
  * </pre>
  *
@@ -76,6 +78,7 @@
 #include "xvtc.h"
 #include "xgpio.h"
 #include "../intc/intc.h"
+#include "../pixfmt/pixfmt.h"
 
 /* ------------------------------------------------------------ */
 /*					Miscellaneous Declarations					*/
@@ -136,6 +139,7 @@ typedef struct {
 		INTC *intc; /*Interrupt controller driver struct*/
 		u8 *framePtr[VIDEO_NUM_FRAMES]; /* Array of pointers to the framebuffers */
 		u32 stride; /* The line stride of the framebuffers, in bytes */
+		PixFmt fmt; /* Pixel format of the framebuffers, set by the width of the S2MM stream */
 		u32 curFrame; /* Current frame being displayed */
 		XGpio gpio; /* XGPIO driver struct */
 		u16 vtcId; /* Device ID of VTC core as defined in xparameters.h */
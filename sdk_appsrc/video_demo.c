@@ -18,6 +18,43 @@
 /*  Revision History:													*/
 /* 																		*/
 /*		11/25/2015(SamB): Created										*/
+/*		10/19/2026: Menus sleep until a key or video detect event		*/
+/*					instead of polling the UART							*/
+/*		10/19/2026: Menus print through the buffered UartPrintf			*/
+/*		10/19/2026: Main menu only redraws the fields that changed		*/
+/*		10/19/2026: Added performance counter profiling of the frame	*/
+/*					functions											*/
+/*		10/19/2026: Added kernel benchmark								*/
+/*		10/19/2026: Added golden image check of the frame functions		*/
+/*		10/19/2026: Resolution changes are checked against the memory	*/
+/*					bandwidth budget, and the headroom is shown			*/
+/*		10/19/2026: Added VDMA error monitor, printed with the			*/
+/*					performance counters								*/
+/*		10/19/2026: Added memory bandwidth benchmark					*/
+/*		10/19/2026: Frame functions leave cache maintenance to			*/
+/*					fb_policy, and the framebuffer mapping can be		*/
+/*					switched from the benchmark							*/
+/*		10/19/2026: Invert and scale are split into row bands shared	*/
+/*					with a worker on CPU1								*/
+/*		10/19/2026: Invert and scale are cut into tiles and scheduled	*/
+/*					on both cores by work stealing						*/
+/*		10/19/2026: Frame fills and copies use the blit library, which	*/
+/*					is also benchmarked from the memory benchmark		*/
+/*		10/19/2026: Invert and scale run from OCM, and the scaler reads	*/
+/*					its source lines through a ring in OCM				*/
+/*		10/19/2026: Invert and scale in XRGB8888 as well, through work	*/
+/*					frames converted on the CPU							*/
+/*		10/19/2026: Invert and scale have tiles specialized for each	*/
+/*					video mode, picked by the frame functions			*/
+/*		10/19/2026: Invert is one case of a per channel LUT stage,		*/
+/*					which grades live video from menu option 7			*/
+/*		10/19/2026: Added single pass frame statistics, shown for the	*/
+/*					video input while grading and used for				*/
+/*					auto-contrast										*/
+/*		10/19/2026: Added a 16x16 tile motion map, which DemoGrade can	*/
+/*					use to regrade only the tiles that changed			*/
+/*		10/19/2026: Added an on-screen display of the menu status,		*/
+/*					blended into the frames DemoGrade produces			*/
 /*																		*/
 /************************************************************************/
 
@@ -37,6 +74,23 @@
 #include "xil_types.h"
 #include "xil_cache.h"
 #include "timer_ps/timer_ps.h"
+#include "uart_ps/uart_ps.h"
+#include "term_ui/term_ui.h"
+#include "prof/prof.h"
+#include "bench/bench.h"
+#include "golden/golden.h"
+#include "ref_kernels/ref_kernels.h"
+#include "bw_budget/bw_budget.h"
+#include "vdma_mon/vdma_mon.h"
+#include "membench/membench.h"
+#include "fb_policy/fb_policy.h"
+#include "amp/amp.h"
+#include "tile_sched/tile_sched.h"
+#include "blit/blit.h"
+#include "ocm/ocm.h"
+#include "pixfmt/pixfmt.h"
+#include "color_lut/color_lut.h"
+#include <string.h>
 #include "xparameters.h"
 
 /*
@@ -50,7 +104,11 @@
 #define HDMI_IN_VTC_IRPT_ID 	XPAR_FABRIC_V_TC_IN_IRQ_INTR
 #define HDMI_IN_GPIO_IRPT_ID 	XPAR_FABRIC_AXI_GPIO_VIDEO_IP2INTC_IRPT_INTR
 #define SCU_TIMER_ID 			XPAR_SCUTIMER_DEVICE_ID
+#define SCU_TIMER_IRPT_ID 		XPAR_SCUTIMER_INTR
 #define UART_BASEADDR 			XPAR_PS7_UART_1_BASEADDR
+#define UART_IRPT_ID 			XPAR_PS7_UART_1_INTR
+#define VDMA_MM2S_IRPT_ID 		XPAR_FABRIC_AXI_VDMA_0_MM2S_INTROUT_INTR
+#define VDMA_S2MM_IRPT_ID 		XPAR_FABRIC_AXI_VDMA_0_S2MM_INTROUT_INTR
 
 /* ------------------------------------------------------------ */
 /*				Global Variables								*/
@@ -64,19 +122,90 @@ XAxiVdma vdma;
 VideoCapture videoCapt;
 INTC intc;
 char fRefresh; //flag used to trigger a refresh of the Menu on video detect
+TermUi termUi; //model of the main menu screen
+VdmaMon vdmaMon; //VDMA error counters
 
 /*
- * Framebuffers for video data
+ * Framebuffers for video data. Section aligned so fb_policy can remap all
+ * but the tail of the last frame.
  */
-u8 frameBuf[DISPLAY_NUM_FRAMES][DEMO_MAX_FRAME] __attribute__((aligned(0x20)));
+u8 frameBuf[DISPLAY_NUM_FRAMES][DEMO_MAX_FRAME] __attribute__((aligned(FB_POLICY_SECTION)));
 u8 *pFrames[DISPLAY_NUM_FRAMES]; //array of pointers to the frame buffers
 
+/*
+ * Reference and test outputs of DemoVerify, and PPM images of the first
+ * mismatch it finds
+ */
+u8 verifyBuf[2][DEMO_MAX_FRAME] __attribute__((aligned(0x20)));
+u8 ppmBuf[2][GOLDEN_PPM_SIZE(1920, 1080)] __attribute__((aligned(0x20)));
+
+/*
+ * One line of DemoPrintTest pattern 1, which is the same on every line. Kept
+ * out of the frame so it is never read back from a write-combined mapping.
+ */
+u8 testLine[DEMO_STRIDE] __attribute__((aligned(0x20)));
+
+/*
+ * Source and result of a grabbed frame processed in a format the
+ * framebuffers are not in, and of the XRGB8888 benchmarks and checks
+ */
+u8 workBuf[2][DEMO_MAX_FRAME_XRGB] __attribute__((aligned(0x20)));
+PixFmt procFmt = DEMO_PROC_FMT; //format grabbed frames are inverted and scaled in
+
+/*
+ * Scaler columns, for when OCM has no room for them
+ */
+DemoScaleCol scaleCols[DEMO_MAX_WIDTH];
+int fModeKernels = 1; //use the tiles specialized for the resolution when there are some
+
+/*
+ * Color tables: plain inversion for DemoInvertFrame, the grading DemoGrade
+ * applies to grabbed frames, and a grade that needs the table lookups for
+ * DemoBenchmark
+ */
+ColorLut invertLut;
+ColorLut gradeLut;
+ColorLut benchLut;
+
+/*
+ * Frame statistics: the partial results of each core, for when OCM has no
+ * room for them, the last ones of the video input, shown by DemoGrade, and
+ * the results of DemoBenchmark
+ */
+FrameStats statsParts[AMP_NUM_CPUS];
+FrameStats inputStats;
+FrameStats benchStats;
+
+/*
+ * Change map of the last grab DemoGrade compared or of DemoBenchmark, the
+ * framebuffer holding the grab before it and when capture last moved
+ */
+MotionMap motionMap;
+u32 motionPrev;
+u64 motionSwitchUs;
+
+/*
+ * Status text drawn over the frames DemoGrade produces
+ */
+Osd osd;
+int fOsd = 1;
+
+/*
+ * Four XRGB8888 pixels
+ */
+typedef u32 DemoVec __attribute__((vector_size(16)));
+
 /*
  * Interrupt vector table
  */
 const ivt_t ivt[] = {
 	videoGpioIvt(HDMI_IN_GPIO_IRPT_ID, &videoCapt),
-	videoVtcIvt(HDMI_IN_VTC_IRPT_ID, &(videoCapt.vtc))
+	videoVtcIvt(HDMI_IN_VTC_IRPT_ID, &(videoCapt.vtc)),
+	timerIvt(SCU_TIMER_IRPT_ID),
+	uartIvt(UART_IRPT_ID),
+	vdmaMonReadIvt(VDMA_MM2S_IRPT_ID, &vdma),
+	vdmaMonWriteIvt(VDMA_S2MM_IRPT_ID, &vdma),
+	ampIvt(AMP_SGI_DONE)
 };
 
 /* ------------------------------------------------------------ */
@@ -99,6 +228,28 @@ void DemoInitialize()
 	XAxiVdma_Config *vdmaConfig;
 	int i;
 
+	ColorLutParams lutParams;
+
+	/*
+	 * Move the OCM_TEXT code into OCM before anything calls it
+	 */
+	OcmInit();
+
+	/*
+	 * Build the color tables. Grading starts out as plain inversion, what
+	 * option 7 did before it graded.
+	 */
+	ColorLutDefaults(&lutParams);
+	lutParams.fInvert = 1;
+	ColorLutSet(&invertLut, &lutParams);
+	ColorLutSet(&gradeLut, &lutParams);
+	ColorLutDefaults(&lutParams);
+	lutParams.gamma = 180;
+	lutParams.contrast = 120;
+	lutParams.temperature = 30;
+	ColorLutSet(&benchLut, &lutParams);
+	OsdInit(&osd, DEMO_OSD_X, DEMO_OSD_Y, 1, DEMO_OSD_COLOR, DEMO_OSD_DIM);
+
 	/*
 	 * Initialize an array of pointers to the 3 frame buffers
 	 */
@@ -144,6 +295,31 @@ void DemoInitialize()
 		return;
 	}
 
+	/*
+	 * Buffer console input in the UART interrupt handler
+	 */
+	UartInitialize(UART_BASEADDR);
+	TermUiInit(&termUi);
+
+	/*
+	 * Start the performance counters used to profile the frame functions
+	 */
+	ProfInit();
+
+	/*
+	 * Start the memory bandwidth budget with no CPU stages
+	 */
+	BwInit();
+
+	/*
+	 * Map the framebuffers for the frame functions
+	 */
+	Status = FbPolicyInit(frameBuf[0], sizeof(frameBuf), DEMO_FB_MAPPING);
+	if (Status != XST_SUCCESS)
+	{
+		xil_printf("Framebuffer mapping failed during demo initialization%d\r\n", Status);
+	}
+
 	/*
 	 * Initialize the Interrupt controller and start it.
 	 */
@@ -154,6 +330,29 @@ void DemoInitialize()
 	}
 	fnEnableInterrupts(&intc, &ivt[0], sizeof(ivt)/sizeof(ivt[0]));
 
+	/*
+	 * Switch the delay timer over to interrupts, so delays sleep instead of spin
+	 */
+	TimerStartService();
+
+	/*
+	 * Start CPU1 as a second core for the frame functions
+	 */
+	Status = AmpInit(&intc);
+	if (Status != XST_SUCCESS)
+	{
+		xil_printf("CPU1 did not start, frame functions run on CPU0 only\r\n");
+	}
+
+	/*
+	 * Count VDMA errors from now on
+	 */
+	Status = VdmaMonInit(&vdmaMon, &vdma);
+	if (Status != XST_SUCCESS)
+	{
+		xil_printf("VDMA monitor initialization failed during demo initialization%d\r\n", Status);
+	}
+
 	/*
 	 * Initialize the Video Capture device
 	 */
@@ -179,26 +378,22 @@ void DemoRun()
 	int nextFrame = 0;
 	char userInput = 0;
 
-	/* Flush UART FIFO */
-	while (XUartPs_IsReceiveData(UART_BASEADDR))
-	{
-		XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-	}
+	/* Flush UART receive buffer */
+	UartFlushRx();
 
 	while (userInput != 'q')
 	{
 		fRefresh = 0;
 		DemoPrintMenu();
 
-		/* Wait for data on UART */
-		while (!XUartPs_IsReceiveData(UART_BASEADDR) && !fRefresh)
-		{}
-
-		/* Store the first character in the UART receive FIFO and echo it */
-		if (XUartPs_IsReceiveData(UART_BASEADDR))
+		/* Sleep until a key is received or video is detected, and echo the key */
+		if (UartWaitChar(&userInput, &fRefresh))
 		{
-			userInput = XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-			xil_printf("%c", userInput);
+			if (isprint((int) userInput))
+			{
+				TermUiPrintf(&termUi, DEMO_UI_PROMPT_ROW, "Enter a selection:%c", userInput);
+				TermUiRefresh(&termUi, DEMO_UI_PROMPT_ROW);
+			}
 		}
 		else  //Refresh triggered by video detect interrupt
 		{
@@ -208,7 +403,10 @@ void DemoRun()
 		switch (userInput)
 		{
 		case '1':
+			VdmaMonSetActivity(&vdmaMon, "Change resolution");
 			DemoChangeRes();
+			/* The resolution menu replaced the screen */
+			TermUiInvalidate(&termUi);
 			break;
 		case '2':
 			nextFrame = dispCtrl.curFrame + 1;
@@ -219,9 +417,11 @@ void DemoRun()
 			DisplayChangeFrame(&dispCtrl, nextFrame);
 			break;
 		case '3':
+			VdmaMonSetActivity(&vdmaMon, "Test pattern");
 			DemoPrintTest(pFrames[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, DEMO_STRIDE, DEMO_PATTERN_0);
 			break;
 		case '4':
+			VdmaMonSetActivity(&vdmaMon, "Test pattern");
 			DemoPrintTest(pFrames[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, DEMO_STRIDE, DEMO_PATTERN_1);
 			break;
 		case '5':
@@ -239,35 +439,46 @@ void DemoRun()
 			VideoChangeFrame(&videoCapt, nextFrame);
 			break;
 		case '7':
-			nextFrame = videoCapt.curFrame + 1;
-			if (nextFrame >= DISPLAY_NUM_FRAMES)
-			{
-				nextFrame = 0;
-			}
-			VideoStop(&videoCapt);
-			DemoInvertFrame(pFrames[videoCapt.curFrame], pFrames[nextFrame], videoCapt.timing.HActiveVideo, videoCapt.timing.VActiveVideo, DEMO_STRIDE);
-			VideoStart(&videoCapt);
-			DisplayChangeFrame(&dispCtrl, nextFrame);
+			VdmaMonSetActivity(&vdmaMon, "Grade");
+			DemoGrade();
+			TermUiInvalidate(&termUi);
 			break;
 		case '8':
+			VdmaMonSetActivity(&vdmaMon, "Scale");
 			nextFrame = videoCapt.curFrame + 1;
 			if (nextFrame >= DISPLAY_NUM_FRAMES)
 			{
 				nextFrame = 0;
 			}
 			VideoStop(&videoCapt);
-			DemoScaleFrame(pFrames[videoCapt.curFrame], pFrames[nextFrame], videoCapt.timing.HActiveVideo, videoCapt.timing.VActiveVideo, dispCtrl.vMode.width, dispCtrl.vMode.height, DEMO_STRIDE);
+			DemoProcessFrame(nextFrame, 1);
 			VideoStart(&videoCapt);
 			DisplayChangeFrame(&dispCtrl, nextFrame);
 			break;
+		case 'v':
+			VdmaMonSetActivity(&vdmaMon, "Verify");
+			DemoVerify();
+			TermUiInvalidate(&termUi);
+			break;
+		case 'b':
+			VdmaMonSetActivity(&vdmaMon, "Benchmark");
+			DemoBenchmark();
+			TermUiInvalidate(&termUi);
+			break;
+		case 'p':
+			DemoPrintProfile();
+			TermUiInvalidate(&termUi);
+			break;
 		case 'q':
 			break;
 		case 'r':
 			break;
 		default :
-			xil_printf("\n\rInvalid Selection");
+			TermUiPrintf(&termUi, DEMO_UI_MSG_ROW, "Invalid Selection");
+			TermUiRefresh(&termUi, DEMO_UI_MSG_ROW);
 			TimerDelay(500000);
 		}
+		VdmaMonSetActivity(&vdmaMon, NULL);
 	}
 
 	return;
@@ -275,31 +486,45 @@ void DemoRun()
 
 void DemoPrintMenu()
 {
-	xil_printf("\x1B[H"); //Set cursor to top left of terminal
-	xil_printf("\x1B[2J"); //Clear terminal
-	xil_printf("**************************************************\n\r");
-	xil_printf("*                ZYBO Video Demo                 *\n\r");
-	xil_printf("**************************************************\n\r");
-	xil_printf("*Display Resolution: %28s*\n\r", dispCtrl.vMode.label);
-	printf("*Display Pixel Clock Freq. (MHz): %15.3f*\n\r", dispCtrl.pxlFreq);
-	xil_printf("*Display Frame Index: %27d*\n\r", dispCtrl.curFrame);
-	if (videoCapt.state == VIDEO_DISCONNECTED) xil_printf("*Video Capture Resolution: %22s*\n\r", "!HDMI UNPLUGGED!");
-	else xil_printf("*Video Capture Resolution: %17dx%-4d*\n\r", videoCapt.timing.HActiveVideo, videoCapt.timing.VActiveVideo);
-	xil_printf("*Video Frame Index: %29d*\n\r", videoCapt.curFrame);
-	xil_printf("**************************************************\n\r");
-	xil_printf("\n\r");
-	xil_printf("1 - Change Display Resolution\n\r");
-	xil_printf("2 - Change Display Framebuffer Index\n\r");
-	xil_printf("3 - Print Blended Test Pattern to Display Framebuffer\n\r");
-	xil_printf("4 - Print Color Bar Test Pattern to Display Framebuffer\n\r");
-	xil_printf("5 - Start/Stop Video stream into Video Framebuffer\n\r");
-	xil_printf("6 - Change Video Framebuffer Index\n\r");
-	xil_printf("7 - Grab Video Frame and invert colors\n\r");
-	xil_printf("8 - Grab Video Frame and scale to Display resolution\n\r");
-	xil_printf("q - Quit\n\r");
-	xil_printf("\n\r");
-	xil_printf("\n\r");
-	xil_printf("Enter a selection:");
+	BwReport bw;
+
+	BwEvaluate(&dispCtrl.vMode, &videoCapt, &bw);
+
+	TermUiPrintf(&termUi, 0, "**************************************************");
+	TermUiPrintf(&termUi, 1, "*                ZYBO Video Demo                 *");
+	TermUiPrintf(&termUi, 2, "**************************************************");
+	TermUiPrintf(&termUi, 3, "*Display Resolution: %28s*", dispCtrl.vMode.label);
+	TermUiPrintf(&termUi, 4, "*Display Pixel Clock Freq. (MHz): %15.3f*", dispCtrl.pxlFreq);
+	TermUiPrintf(&termUi, 5, "*Display Frame Index: %27d*", dispCtrl.curFrame);
+	if (videoCapt.state == VIDEO_DISCONNECTED) TermUiPrintf(&termUi, 6, "*Video Capture Resolution: %22s*", "!HDMI UNPLUGGED!");
+	else TermUiPrintf(&termUi, 6, "*Video Capture Resolution: %17dx%-4d*", videoCapt.timing.HActiveVideo, videoCapt.timing.VActiveVideo);
+	TermUiPrintf(&termUi, 7, "*Video Frame Index: %29d*", videoCapt.curFrame);
+	TermUiPrintf(&termUi, 8, "*Bandwidth Headroom HP0/DDR (MB/s): %6lld/%-6lld*", (long long) (bw.hpHeadroom / 1000000), (long long) (bw.ddrHeadroom / 1000000));
+	TermUiPrintf(&termUi, 9, "**************************************************");
+	TermUiPrintf(&termUi, 10, "1 - Change Display Resolution");
+	TermUiPrintf(&termUi, 11, "2 - Change Display Framebuffer Index");
+	TermUiPrintf(&termUi, 12, "3 - Print Blended Test Pattern to Display Framebuffer");
+	TermUiPrintf(&termUi, 13, "4 - Print Color Bar Test Pattern to Display Framebuffer");
+	TermUiPrintf(&termUi, 14, "5 - Start/Stop Video stream into Video Framebuffer");
+	TermUiPrintf(&termUi, 15, "6 - Change Video Framebuffer Index");
+	TermUiPrintf(&termUi, 16, "7 - Grade Live Video through the Color LUT in %s", PixFmtName(procFmt));
+	TermUiPrintf(&termUi, 17, "8 - Grab Video Frame and scale to Display resolution in %s", PixFmtName(procFmt));
+	TermUiPrintf(&termUi, 18, "b - Benchmark Frame Functions");
+	TermUiPrintf(&termUi, 19, "v - Verify Frame Functions Against Reference");
+	TermUiPrintf(&termUi, 20, "p - Print Performance Counters and VDMA Errors");
+	TermUiPrintf(&termUi, 21, "q - Quit");
+	TermUiPrintf(&termUi, DEMO_UI_PROMPT_ROW, "Enter a selection:");
+	TermUiClearRow(&termUi, DEMO_UI_MSG_ROW);
+	if (bw.status == BW_REFUSE)
+	{
+		/* The input changed to a mode the display can't be run alongside */
+		TermUiPrintf(&termUi, DEMO_UI_MSG_ROW, "WARNING: Video in and out exceed the memory bandwidth budget");
+	}
+
+	/*
+	 * Only the rows that differ from what is on the terminal are sent
+	 */
+	TermUiRefresh(&termUi, DEMO_UI_PROMPT_ROW);
 }
 
 void DemoChangeRes()
@@ -307,243 +532,1845 @@ void DemoChangeRes()
 	int fResSet = 0;
 	int status;
 	char userInput = 0;
+	const VideoMode *newMode;
 
-	/* Flush UART FIFO */
-	while (XUartPs_IsReceiveData(UART_BASEADDR))
-	{
-		XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-	}
+	/* Flush UART receive buffer */
+	UartFlushRx();
 
 	while (!fResSet)
 	{
 		DemoCRMenu();
 
-		/* Wait for data on UART */
-		while (!XUartPs_IsReceiveData(UART_BASEADDR))
-		{}
-
-		/* Store the first character in the UART recieve FIFO and echo it */
-		userInput = XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-		xil_printf("%c", userInput);
+		/* Sleep until a key is received and echo it */
+		UartWaitChar(&userInput, NULL);
+		UartPrintf("%c", userInput);
 		status = XST_SUCCESS;
+		newMode = NULL;
 		switch (userInput)
 		{
 		case '1':
-			status = DisplayStop(&dispCtrl);
-			DisplaySetMode(&dispCtrl, &VMODE_640x480);
-			DisplayStart(&dispCtrl);
-			fResSet = 1;
+			newMode = &VMODE_640x480;
 			break;
 		case '2':
-			status = DisplayStop(&dispCtrl);
-			DisplaySetMode(&dispCtrl, &VMODE_800x600);
-			DisplayStart(&dispCtrl);
-			fResSet = 1;
+			newMode = &VMODE_800x600;
 			break;
 		case '3':
-			status = DisplayStop(&dispCtrl);
-			DisplaySetMode(&dispCtrl, &VMODE_1280x720);
-			DisplayStart(&dispCtrl);
-			fResSet = 1;
+			newMode = &VMODE_1280x720;
 			break;
 		case '4':
-			status = DisplayStop(&dispCtrl);
-			DisplaySetMode(&dispCtrl, &VMODE_1280x1024);
-			DisplayStart(&dispCtrl);
-			fResSet = 1;
+			newMode = &VMODE_1280x1024;
 			break;
 		case '5':
-			status = DisplayStop(&dispCtrl);
-			DisplaySetMode(&dispCtrl, &VMODE_1600x900);
-			DisplayStart(&dispCtrl);
-			fResSet = 1;
+			newMode = &VMODE_1600x900;
 			break;
 		case '6':
-			status = DisplayStop(&dispCtrl);
-			DisplaySetMode(&dispCtrl, &VMODE_1920x1080);
-			DisplayStart(&dispCtrl);
-			fResSet = 1;
+			newMode = &VMODE_1920x1080;
 			break;
 		case 'q':
 			fResSet = 1;
 			break;
 		default :
-			xil_printf("\n\rInvalid Selection");
+			UartPrintf("\n\rInvalid Selection");
 			TimerDelay(500000);
 		}
+		if (newMode != NULL)
+		{
+			if (BwEvaluate(newMode, &videoCapt, NULL) == BW_REFUSE)
+			{
+				UartPrintf("\n\rNot enough memory bandwidth for %s with the current video input", newMode->label);
+				TimerDelay(2000000);
+			}
+			else
+			{
+				status = DisplayStop(&dispCtrl);
+				DisplaySetMode(&dispCtrl, newMode);
+				DisplayStart(&dispCtrl);
+				fResSet = 1;
+			}
+		}
 		if (status == XST_DMA_ERROR)
 		{
-			xil_printf("\n\rWARNING: AXI VDMA Error detected and cleared\n\r");
+			UartPrintf("\n\rWARNING: AXI VDMA Error detected and cleared\n\r");
 		}
 	}
 }
 
 void DemoCRMenu()
 {
-	xil_printf("\x1B[H"); //Set cursor to top left of terminal
-	xil_printf("\x1B[2J"); //Clear terminal
-	xil_printf("**************************************************\n\r");
-	xil_printf("*                ZYBO Video Demo                 *\n\r");
-	xil_printf("**************************************************\n\r");
-	xil_printf("*Current Resolution: %28s*\n\r", dispCtrl.vMode.label);
-	printf("*Pixel Clock Freq. (MHz): %23.3f*\n\r", dispCtrl.pxlFreq);
-	xil_printf("**************************************************\n\r");
-	xil_printf("\n\r");
-	xil_printf("1 - %s\n\r", VMODE_640x480.label);
-	xil_printf("2 - %s\n\r", VMODE_800x600.label);
-	xil_printf("3 - %s\n\r", VMODE_1280x720.label);
-	xil_printf("4 - %s\n\r", VMODE_1280x1024.label);
-	xil_printf("5 - %s\n\r", VMODE_1600x900.label);
-	xil_printf("6 - %s\n\r", VMODE_1920x1080.label);
-	xil_printf("q - Quit (don't change resolution)\n\r");
-	xil_printf("\n\r");
-	xil_printf("Select a new resolution:");
-}
-
-void DemoInvertFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride)
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("**************************************************\n\r");
+	UartPrintf("*                ZYBO Video Demo                 *\n\r");
+	UartPrintf("**************************************************\n\r");
+	UartPrintf("*Current Resolution: %28s*\n\r", dispCtrl.vMode.label);
+	UartPrintf("*Pixel Clock Freq. (MHz): %23.3f*\n\r", dispCtrl.pxlFreq);
+	UartPrintf("**************************************************\n\r");
+	UartPrintf("\n\r");
+	UartPrintf("    %-20s %s\n\r", "", "Bandwidth used (HP0/DDR)");
+	DemoCRMode('1', &VMODE_640x480);
+	DemoCRMode('2', &VMODE_800x600);
+	DemoCRMode('3', &VMODE_1280x720);
+	DemoCRMode('4', &VMODE_1280x1024);
+	DemoCRMode('5', &VMODE_1600x900);
+	DemoCRMode('6', &VMODE_1920x1080);
+	UartPrintf("q - Quit (don't change resolution)\n\r");
+	UartPrintf("\n\r");
+	UartPrintf("Select a new resolution:");
+}
+
+/*
+ * Prints one line of the resolution menu with the bandwidth the mode would
+ * use alongside the current video input
+ */
+void DemoCRMode(char key, const VideoMode *mode)
+{
+	BwReport bw;
+	static const char *notes[] = {"", " (near limit)", " (not available)"};
+
+	BwEvaluate(mode, &videoCapt, &bw);
+	UartPrintf("%c - %-20s %3lu%%/%lu%%%s\n\r", key, mode->label, (unsigned long) bw.hpPct, (unsigned long) bw.ddrPct, notes[bw.status]);
+}
+
+void DemoPrintProfile()
 {
-	u32 xcoi, ycoi;
-	u32 lineStart = 0;
-	for(ycoi = 0; ycoi < height; ycoi++)
+	char userInput;
+	u32 run0, stolen0, run1, stolen1;
+
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("Per call averages since the last reset, %s framebuffers, ", FbPolicyName(FbPolicyGetMapping()));
+	if (AmpIsRunning())
+	{
+		TileSchedTotals(0, &run0, &stolen0);
+		TileSchedTotals(1, &run1, &stolen1);
+		UartPrintf("tiles run on CPU0/CPU1 %lu/%lu, stolen %lu/%lu:\n\r\n\r", (unsigned long) run0, (unsigned long) run1,
+				(unsigned long) stolen0, (unsigned long) stolen1);
+	}
+	else
+	{
+		UartPrintf("CPU1 not running:\n\r\n\r");
+	}
+	ProfPrint();
+	UartPrintf("\n\rVDMA errors since start-up:\n\r\n\r");
+	VdmaMonPrint(&vdmaMon, DEMO_VDMA_MON_SECONDS);
+	UartPrintf("\n\rPress r to reset the counters, any other key to return");
+
+	UartFlushRx();
+	UartWaitChar(&userInput, NULL);
+	if (userInput == 'r')
+	{
+		ProfReset();
+	}
+}
+
+void DemoBenchmark()
+{
+	DemoBenchRef ref[3];
+	const BenchCase cases[] = {
+		{"DemoInvertFrame", DemoBenchInvert, &ref[0]},
+		{"DemoInvertFrame XRGB", DemoBenchInvert, &ref[2]},
+		{"DemoLutFrame", DemoBenchLut, &ref[0]},
+		{"DemoLutFrame XRGB", DemoBenchLut, &ref[2]},
+		{"DemoStatsFrame", DemoBenchStats, &ref[0]},
+		{"DemoStatsFrame XRGB", DemoBenchStats, &ref[2]},
+		{"DemoMotionFrame", DemoBenchMotion, &ref[0]},
+		{"DemoMotionFrame XRGB", DemoBenchMotion, &ref[2]},
+		{"OsdComposite", DemoBenchOsd, &ref[0]},
+		{"OsdComposite XRGB", DemoBenchOsd, &ref[2]},
+		{"DemoScaleFrame", DemoBenchScale, &ref[0]},
+		{"DemoScaleFrame XRGB", DemoBenchScale, &ref[2]},
+		{"PixFmtConvert", DemoBenchConvert, &ref[0]},
+		{"DemoPrintTest 0", DemoBenchPrintTest, &ref[0]},
+		{"DemoPrintTest 1", DemoBenchPrintTest, &ref[1]}
+	};
+	FbMapping otherMapping;
+	PixFmt otherFmt;
+	int fStreaming;
+	char userInput;
+
+	/*
+	 * Work in the two framebuffers that are not being displayed, with video
+	 * capture stopped so it cannot write into them
+	 */
+	ref[0].srcFrame = pFrames[(dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES];
+	ref[0].destFrame = pFrames[(dispCtrl.curFrame + 2) % DISPLAY_NUM_FRAMES];
+	ref[0].pattern = DEMO_PATTERN_0;
+	ref[0].fmt = PIXFMT_RGB888;
+	ref[0].lut = &benchLut;
+	ref[1] = ref[0];
+	ref[1].pattern = DEMO_PATTERN_1;
+
+	/*
+	 * The XRGB8888 kernels work in the work frames, as they do on grabbed
+	 * frames until the VDMA streams are 32 bits wide
+	 */
+	ref[2] = ref[0];
+	ref[2].srcFrame = workBuf[0];
+	ref[2].destFrame = workBuf[1];
+	ref[2].fmt = PIXFMT_XRGB8888;
+
+	/*
+	 * Rerun under the other framebuffer mapping, or with the other tiles, for
+	 * as long as c or k is pressed. The last choice stays in effect.
+	 */
+	do
 	{
-		for(xcoi = 0; xcoi < (width * 3); xcoi+=3)
+		fStreaming = (videoCapt.state == VIDEO_STREAMING);
+		if (fStreaming)
+		{
+			VideoStop(&videoCapt);
+		}
+
+		otherMapping = (FbPolicyGetMapping() == FB_MAP_WC) ? FB_MAP_CACHED : FB_MAP_WC;
+		otherFmt = (procFmt == PIXFMT_XRGB8888) ? PIXFMT_RGB888 : PIXFMT_XRGB8888;
+		UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+		UartPrintf("\x1B[2J"); //Clear terminal
+		UartPrintf("Running benchmark, stride %d bytes, %s framebuffers, %s tiles...\n\r\n\r", DEMO_STRIDE, FbPolicyName(FbPolicyGetMapping()),
+				fModeKernels ? "specialized" : "generic");
+		BenchRunAll(cases, sizeof(cases) / sizeof(cases[0]), DEMO_BENCH_REPS);
+		UartPrintf("\n\rPress c to switch the framebuffers to %s and rerun,\n\r", FbPolicyName(otherMapping));
+		UartPrintf("k to switch to the %s tiles and rerun,\n\r", fModeKernels ? "generic" : "specialized");
+		UartPrintf("f to invert and scale grabbed frames in %s,\n\r", PixFmtName(otherFmt));
+		UartPrintf("m to measure memory bandwidth, any other key to return");
+
+		if (fStreaming)
+		{
+			VideoStart(&videoCapt);
+		}
+
+		UartFlushRx();
+		UartWaitChar(&userInput, NULL);
+		if (userInput == 'c')
+		{
+			FbPolicySetMapping(otherMapping);
+		}
+		else if (userInput == 'k')
+		{
+			fModeKernels = !fModeKernels;
+		}
+		else if (userInput == 'f')
 		{
-			destFrame[xcoi + lineStart] = ~srcFrame[xcoi + lineStart];         //Red
-			destFrame[xcoi + lineStart + 1] = ~srcFrame[xcoi + lineStart + 1]; //Blue
-			destFrame[xcoi + lineStart + 2] = ~srcFrame[xcoi + lineStart + 2]; //Green
+			procFmt = otherFmt;
 		}
-		lineStart += stride;
+	} while (userInput == 'c' || userInput == 'k');
+
+	if (userInput == 'm')
+	{
+		DemoMemBench();
+	}
+}
+
+void DemoMemBench()
+{
+	int fStreaming;
+	char userInput;
+
+	fStreaming = (videoCapt.state == VIDEO_STREAMING);
+	if (fStreaming)
+	{
+		VideoStop(&videoCapt);
 	}
+
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("Measuring memory bandwidth in the off-screen framebuffers...\n\r\n\r");
+	MemBenchRunAll(pFrames[(dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES], pFrames[(dispCtrl.curFrame + 2) % DISPLAY_NUM_FRAMES], DEMO_MEMBENCH_REPS);
+
 	/*
-	 * Flush the framebuffer memory range to ensure changes are written to the
-	 * actual memory, and therefore accessible by the VDMA.
+	 * MemBenchRunAll leaves the framebuffers cached, put back the selected
+	 * mapping
 	 */
-	Xil_DCacheFlushRange((unsigned int) destFrame, DEMO_MAX_FRAME);
+	FbPolicySetMapping(FbPolicyGetMapping());
+
+	UartPrintf("\n\rBlit library against the code it replaces, %s framebuffers:\n\r\n\r", FbPolicyName(FbPolicyGetMapping()));
+	BlitBenchRunAll(pFrames[(dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES], pFrames[(dispCtrl.curFrame + 2) % DISPLAY_NUM_FRAMES], DEMO_MEMBENCH_REPS);
+	UartPrintf("\n\rPress any key to return");
+
+	if (fStreaming)
+	{
+		VideoStart(&videoCapt);
+	}
+
+	UartFlushRx();
+	UartWaitChar(&userInput, NULL);
 }
 
+/*
+ * Benchmark wrappers. Each returns the bytes read and written by one call.
+ */
+u32 DemoBenchInvert(void *ref, u32 width, u32 height)
+{
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
+	u32 bytes = PixFmtBytes(benchRef->fmt);
+
+	DemoInvertFrame(benchRef->srcFrame, benchRef->destFrame, width, height, DEMO_MAX_WIDTH * bytes, benchRef->fmt);
+
+	return width * height * bytes * 2;
+}
 
 /*
- * Bilinear interpolation algorithm. Assumes both frames have the same stride.
+ * A grade that is not an XOR, so every channel goes through its table
  */
-void DemoScaleFrame(u8 *srcFrame, u8 *destFrame, u32 srcWidth, u32 srcHeight, u32 destWidth, u32 destHeight, u32 stride)
+u32 DemoBenchLut(void *ref, u32 width, u32 height)
 {
-	float xInc, yInc; // Width/height of a destination frame pixel in the source frame coordinate system
-	float xcoSrc, ycoSrc; // Location of the destination pixel being operated on in the source frame coordinate system
-	float x1y1, x2y1, x1y2, x2y2; //Used to store the color data of the four nearest source pixels to the destination pixel
-	int ix1y1, ix2y1, ix1y2, ix2y2; //indexes into the source frame for the four nearest source pixels to the destination pixel
-	float xDist, yDist; //distances between destination pixel and x1y1 source pixels in source frame coordinate system
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
+	u32 bytes = PixFmtBytes(benchRef->fmt);
 
-	int xcoDest, ycoDest; // Location of the destination pixel being operated on in the destination coordinate system
-	int iy1; //Used to store the index of the first source pixel in the line with y1
-	int iDest; //index of the pixel data in the destination frame being operated on
+	DemoLutFrame(benchRef->srcFrame, benchRef->destFrame, width, height, DEMO_MAX_WIDTH * bytes, benchRef->fmt, benchRef->lut);
 
-	int i;
+	return width * height * bytes * 2;
+}
 
-	xInc = ((float) srcWidth - 1.0) / ((float) destWidth);
-	yInc = ((float) srcHeight - 1.0) / ((float) destHeight);
+/*
+ * Statistics of every line; only reads the frame
+ */
+u32 DemoBenchStats(void *ref, u32 width, u32 height)
+{
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
+	u32 bytes = PixFmtBytes(benchRef->fmt);
 
-	ycoSrc = 0.0;
-	for (ycoDest = 0; ycoDest < destHeight; ycoDest++)
-	{
-		iy1 = ((int) ycoSrc) * stride;
-		yDist = ycoSrc - ((float) ((int) ycoSrc));
+	DemoStatsFrame(benchRef->srcFrame, width, height, DEMO_MAX_WIDTH * bytes, benchRef->fmt, 1, &benchStats);
 
-		/*
-		 * Save some cycles in the loop below by presetting the destination
-		 * index to the first pixel in the current line
-		 */
-		iDest = ycoDest * stride;
+	return width * height * bytes;
+}
 
-		xcoSrc = 0.0;
-		for (xcoDest = 0; xcoDest < destWidth; xcoDest++)
-		{
-			ix1y1 = iy1 + ((int) xcoSrc) * 3;
-			ix2y1 = ix1y1 + 3;
-			ix1y2 = ix1y1 + stride;
-			ix2y2 = ix1y1 + stride + 3;
+/*
+ * A frame against itself, so no tile leaves early; only reads the frame
+ */
+u32 DemoBenchMotion(void *ref, u32 width, u32 height)
+{
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
+	u32 bytes = PixFmtBytes(benchRef->fmt);
 
-			xDist = xcoSrc - ((float) ((int) xcoSrc));
+	DemoMotionFrame(benchRef->srcFrame, benchRef->srcFrame, width, height, DEMO_MAX_WIDTH * bytes, benchRef->fmt, DEMO_MOTION_THRESHOLD, &motionMap);
 
-			/*
-			 * For loop handles all three colors
-			 */
-			for (i = 0; i < 3; i++)
-			{
-				x1y1 = (float) srcFrame[ix1y1 + i];
-				x2y1 = (float) srcFrame[ix2y1 + i];
-				x1y2 = (float) srcFrame[ix1y2 + i];
-				x2y2 = (float) srcFrame[ix2y2 + i];
+	return width * height * bytes * 2;
+}
 
-				/*
-				 * Bilinear interpolation function
-				 */
-				destFrame[iDest] = (u8) ((1.0-yDist)*((1.0-xDist)*x1y1+xDist*x2y1) + yDist*((1.0-xDist)*x1y2+xDist*x2y2));
-				iDest++;
-			}
-			xcoSrc += xInc;
-		}
-		ycoSrc += yInc;
+/*
+ * The menu status as DemoGrade draws it on the current display; the bytes
+ * are those of the boxes
+ */
+u32 DemoBenchOsd(void *ref, u32 width, u32 height)
+{
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
+	u32 bytes = PixFmtBytes(benchRef->fmt);
+	u32 x, y, w, h;
+
+	if (osd.rowLen[0] == 0)
+	{
+		DemoOsdStatus(0);
 	}
+	OsdComposite(&osd, benchRef->destFrame, width, height, DEMO_MAX_WIDTH * bytes, benchRef->fmt);
+
+	OsdBounds(&osd, &x, &y, &w, &h);
+	w = (x >= width) ? 0 : (x + w > width) ? width - x : w;
+	h = (y >= height) ? 0 : (y + h > height) ? height - y : h;
+
+	return w * h * bytes * 2;
+}
+
+u32 DemoBenchScale(void *ref, u32 width, u32 height)
+{
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
+	u32 bytes = PixFmtBytes(benchRef->fmt);
 
 	/*
-	 * Flush the framebuffer memory range to ensure changes are written to the
-	 * actual memory, and therefore accessible by the VDMA.
+	 * Upscale from the smallest mode, like scaling a captured frame up to
+	 * the display resolution
 	 */
-	Xil_DCacheFlushRange((unsigned int) destFrame, DEMO_MAX_FRAME);
+	DemoScaleFrame(benchRef->srcFrame, benchRef->destFrame, VMODE_640x480.width, VMODE_640x480.height, width, height, DEMO_MAX_WIDTH * bytes, benchRef->fmt);
 
-	return;
+	return VMODE_640x480.width * VMODE_640x480.height * bytes + width * height * bytes;
 }
 
-void DemoPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern)
+u32 DemoBenchPrintTest(void *ref, u32 width, u32 height)
 {
-	u32 xcoi, ycoi;
-	u32 iPixelAddr;
-	u8 wRed, wBlue, wGreen;
-	u32 wCurrentInt;
-	double fRed, fBlue, fGreen, fColor;
-	u32 xLeft, xMid, xRight, xInt;
-	u32 yMid, yInt;
-	double xInc, yInc;
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
 
+	DemoPrintTest(benchRef->destFrame, width, height, DEMO_STRIDE, benchRef->pattern);
 
-	switch (pattern)
-	{
-	case DEMO_PATTERN_0:
+	return width * height * 3;
+}
 
-		xInt = width / 4; //Four intervals, each with width/4 pixels
-		xLeft = xInt * 3;
-		xMid = xInt * 2 * 3;
-		xRight = xInt * 3 * 3;
-		xInc = 256.0 / ((double) xInt); //256 color intensities are cycled through per interval (overflow must be caught when color=256.0)
+/*
+ * The conversions around an XRGB8888 kernel while the framebuffers are
+ * RGB888: the source framebuffer into a work frame and a work frame back
+ */
+u32 DemoBenchConvert(void *ref, u32 width, u32 height)
+{
+	DemoBenchRef *benchRef = (DemoBenchRef *) ref;
 
-		yInt = height / 2; //Two intervals, each with width/2 lines
-		yMid = yInt;
-		yInc = 256.0 / ((double) yInt); //256 color intensities are cycled through per interval (overflow must be caught when color=256.0)
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, benchRef->srcFrame, height * DEMO_STRIDE);
+	PixFmtConvert(workBuf[0], PIXFMT_XRGB8888, DEMO_STRIDE_XRGB, benchRef->srcFrame, PIXFMT_RGB888, DEMO_STRIDE, width, height);
+	PixFmtConvert(benchRef->destFrame, PIXFMT_RGB888, DEMO_STRIDE, workBuf[0], PIXFMT_XRGB8888, DEMO_STRIDE_XRGB, width, height);
+	FbPolicyEnd(benchRef->destFrame, DEMO_MAX_FRAME);
 
-		fBlue = 0.0;
-		fRed = 256.0;
-		for(xcoi = 0; xcoi < (width*3); xcoi+=3)
-		{
-			/*
-			 * Convert color intensities to integers < 256, and trim values >=256
-			 */
-			wRed = (fRed >= 256.0) ? 255 : ((u8) fRed);
-			wBlue = (fBlue >= 256.0) ? 255 : ((u8) fBlue);
-			iPixelAddr = xcoi;
-			fGreen = 0.0;
-			for(ycoi = 0; ycoi < height; ycoi++)
-			{
+	return width * height * (3 + 4) * 2;
+}
 
-				wGreen = (fGreen >= 256.0) ? 255 : ((u8) fGreen);
-				frame[iPixelAddr] = wRed;
-				frame[iPixelAddr + 1] = wBlue;
-				frame[iPixelAddr + 2] = wGreen;
-				if (ycoi < yMid)
-				{
-					fGreen += yInc;
-				}
-				else
-				{
+/*
+ * Checks the frame functions against the reference copies in ref_kernels at
+ * every resolution, with the specialized or generic tiles as last chosen in
+ * DemoBenchmark. Sources are both test patterns and, if video is connected,
+ * the last captured frame. The first mismatch is exported as PPM images that
+ * can be read out over JTAG.
+ */
+void DemoVerify()
+{
+	const VideoMode *const modes[] = {&VMODE_640x480, &VMODE_800x600, &VMODE_1280x720, &VMODE_1280x1024, &VMODE_1600x900, &VMODE_1920x1080};
+	const char *srcNames[] = {"pattern 0", "pattern 1", "video"};
+	u8 *srcFrame;
+	u8 *patternFrame;
+	u32 m, w, h, i;
+	int src, numSrc;
+	int failures = 0;
+	u32 lutFailures, statsFailures, motionFailures, osdFailures;
+	int fDumped = 0;
+	int fStreaming;
+	char userInput;
+
+	/*
+	 * Stop capture so the captured frame holds still and nothing is written
+	 * into the frame used as the source
+	 */
+	fStreaming = (videoCapt.state == VIDEO_STREAMING);
+	if (fStreaming)
+	{
+		VideoStop(&videoCapt);
+	}
+	numSrc = (videoCapt.state == VIDEO_DISCONNECTED) ? 2 : 3;
+
+	/*
+	 * The patterns go into a frame that is neither shown nor the last
+	 * captured one, which menu 5 or 6 may have parked on the displayed
+	 * frame or any other
+	 */
+	patternFrame = pFrames[0];
+	for (i = 0; i < DISPLAY_NUM_FRAMES; i++)
+	{
+		if (i != dispCtrl.curFrame && i != videoCapt.curFrame)
+		{
+			patternFrame = pFrames[i];
+		}
+	}
+
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("Checking frame functions against reference, %s tiles...\n\r\n\r", fModeKernels ? "specialized" : "generic");
+
+	/*
+	 * The LUT tiles hand each line to ColorLutApply, which checks itself
+	 * against a byte loop over its tables
+	 */
+	lutFailures = ColorLutCheck();
+	UartPrintf("%-20s %-15s %-10s %s\n\r", "ColorLutApply", "", "self check", lutFailures ? "FAILED" : "ok");
+	failures += lutFailures;
+
+	/*
+	 * The statistics tiles hand each sampled line to FrameStatsAccumulate,
+	 * which checks itself against a plain loop
+	 */
+	statsFailures = FrameStatsCheck();
+	UartPrintf("%-20s %-15s %-10s %s\n\r", "FrameStatsAccumulate", "", "self check", statsFailures ? "FAILED" : "ok");
+	failures += statsFailures;
+
+	motionFailures = MotionMapCheck();
+	UartPrintf("%-20s %-15s %-10s %s\n\r", "MotionMapCompare", "", "self check", motionFailures ? "FAILED" : "ok");
+	failures += motionFailures;
+
+	osdFailures = OsdCheck();
+	UartPrintf("%-20s %-15s %-10s %s\n\r", "OsdComposite", "", "self check", osdFailures ? "FAILED" : "ok");
+	failures += osdFailures;
+
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+	{
+		w = modes[m]->width;
+		h = modes[m]->height;
+
+		for (src = 0; src < 2; src++)
+		{
+			RefPrintTest(verifyBuf[0], w, h, DEMO_STRIDE, src);
+			BlitSet(verifyBuf[1], 0xA5, DEMO_MAX_FRAME);
+			DemoPrintTest(verifyBuf[1], w, h, DEMO_STRIDE, src);
+			failures += DemoVerifyCheck("DemoPrintTest", modes[m], srcNames[src], 0, &fDumped);
+		}
+
+		for (src = 0; src < numSrc; src++)
+		{
+			if (src < 2)
+			{
+				srcFrame = patternFrame;
+				RefPrintTest(srcFrame, w, h, DEMO_STRIDE, src);
+			}
+			else
+			{
+				srcFrame = pFrames[videoCapt.curFrame];
+			}
+
+			RefInvertFrame(srcFrame, verifyBuf[0], w, h, DEMO_STRIDE);
+			BlitSet(verifyBuf[1], 0xA5, DEMO_MAX_FRAME);
+			DemoInvertFrame(srcFrame, verifyBuf[1], w, h, DEMO_STRIDE, PIXFMT_RGB888);
+			failures += DemoVerifyCheck("DemoInvertFrame", modes[m], srcNames[src], 0, &fDumped);
+
+			/*
+			 * The XRGB8888 kernels go through the converters both ways, so
+			 * those are checked too
+			 */
+			PixFmtConvert(workBuf[0], PIXFMT_XRGB8888, DEMO_STRIDE_XRGB, srcFrame, PIXFMT_RGB888, DEMO_STRIDE, w, h);
+			DemoInvertFrame(workBuf[0], workBuf[1], w, h, DEMO_STRIDE_XRGB, PIXFMT_XRGB8888);
+			BlitSet(verifyBuf[1], 0xA5, DEMO_MAX_FRAME);
+			PixFmtConvert(verifyBuf[1], PIXFMT_RGB888, DEMO_STRIDE, workBuf[1], PIXFMT_XRGB8888, DEMO_STRIDE_XRGB, w, h);
+			failures += DemoVerifyCheck("DemoInvertFrame XRGB", modes[m], srcNames[src], 0, &fDumped);
+
+			RefScaleFrame(srcFrame, verifyBuf[0], VMODE_640x480.width, VMODE_640x480.height, w, h, DEMO_STRIDE);
+			BlitSet(verifyBuf[1], 0xA5, DEMO_MAX_FRAME);
+			DemoScaleFrame(srcFrame, verifyBuf[1], VMODE_640x480.width, VMODE_640x480.height, w, h, DEMO_STRIDE, PIXFMT_RGB888);
+			failures += DemoVerifyCheck("DemoScaleFrame", modes[m], srcNames[src], DEMO_VERIFY_SCALE_TOL, &fDumped);
+
+			PixFmtConvert(workBuf[0], PIXFMT_XRGB8888, DEMO_STRIDE_XRGB, srcFrame, PIXFMT_RGB888, DEMO_STRIDE, VMODE_640x480.width, VMODE_640x480.height);
+			DemoScaleFrame(workBuf[0], workBuf[1], VMODE_640x480.width, VMODE_640x480.height, w, h, DEMO_STRIDE_XRGB, PIXFMT_XRGB8888);
+			BlitSet(verifyBuf[1], 0xA5, DEMO_MAX_FRAME);
+			PixFmtConvert(verifyBuf[1], PIXFMT_RGB888, DEMO_STRIDE, workBuf[1], PIXFMT_XRGB8888, DEMO_STRIDE_XRGB, w, h);
+			failures += DemoVerifyCheck("DemoScaleFrame XRGB", modes[m], srcNames[src], DEMO_VERIFY_SCALE_TOL, &fDumped);
+		}
+	}
+
+	UartPrintf("\n\r%d check(s) failed\n\r", failures);
+	UartPrintf("Press any key to return");
+
+	if (fStreaming)
+	{
+		VideoStart(&videoCapt);
+	}
+
+	UartFlushRx();
+	UartWaitChar(&userInput, NULL);
+}
+
+/*
+ * Compares the reference output in verifyBuf[0] with the test output in
+ * verifyBuf[1] and prints the result. The first failure is written to ppmBuf
+ * as the test output and a difference heatmap. Returns 1 on a mismatch.
+ */
+int DemoVerifyCheck(const char *name, const VideoMode *mode, const char *srcName, u32 tolerance, int *fDumped)
+{
+	GoldenStats stats;
+	u32 size;
+
+	if (GoldenCompare(verifyBuf[0], verifyBuf[1], mode->width, mode->height, DEMO_STRIDE, tolerance, &stats) == XST_SUCCESS)
+	{
+		UartPrintf("%-20s %-15s %-10s ok, max diff %lu\n\r", name, mode->label, srcName, (unsigned long) stats.maxDiff);
+		return 0;
+	}
+
+	UartPrintf("%-20s %-15s %-10s FAILED, %lu pixels, first at %lu,%lu, max diff %lu\n\r", name, mode->label, srcName,
+			(unsigned long) stats.mismatches, (unsigned long) stats.firstX, (unsigned long) stats.firstY, (unsigned long) stats.maxDiff);
+
+	if (!*fDumped)
+	{
+		size = GoldenWritePpm(ppmBuf[0], verifyBuf[1], mode->width, mode->height, DEMO_STRIDE);
+		UartPrintf("  Output:  mrd -bin -file test.ppm 0x%08lx %lu\n\r", (unsigned long) ppmBuf[0], (unsigned long) (size + 3) / 4);
+		size = GoldenWriteDiffPpm(ppmBuf[1], verifyBuf[0], verifyBuf[1], mode->width, mode->height, DEMO_STRIDE);
+		UartPrintf("  Heatmap: mrd -bin -file diff.ppm 0x%08lx %lu\n\r", (unsigned long) ppmBuf[1], (unsigned long) (size + 3) / 4);
+		*fDumped = 1;
+	}
+
+	return 1;
+}
+
+/*
+ * Grades live video: runs every grabbed frame through gradeLut into one of
+ * the two framebuffers video is not captured into and displays it, as fast
+ * as the LUT stage allows, while keys change the grade. Capture keeps
+ * running, so a frame can tear where the VDMA overtakes the stage. The
+ * statistics of the video input are taken with the frame rate, and 'a'
+ * stretches its luma over the full range. 'm' switches to regrading only
+ * the tiles that changed since the last grab, see DemoGradeChanged; the
+ * whole frame is regraded with each frame rate update and each key, so a
+ * tile the map misses cannot stay stale. 'o' switches the on-screen
+ * display of the menu status, which is blended into every frame produced.
+ * Any key that is not listed returns, leaving the last graded frame
+ * displayed.
+ */
+void DemoGrade()
+{
+	ColorLutParams params = gradeLut.params;
+	ColorLutParams next;
+	u32 outFrame;
+	u32 frames = 0;
+	u64 start, elapsed;
+	u32 rate10 = 0; // Frames per 10 seconds over the last DEMO_GRADE_RATE_US
+	char userInput;
+	int fKey, fStreaming;
+	int fDone = 0;
+	int fMotion = 0;
+	int fFull = 1;
+	u32 motionChanged = 0;
+	u32 motionScore = 0;
+	u32 low, high;
+	int row;
+
+	inputStats.pixels = 0;
+	for (row = 0; row < TERM_UI_ROWS; row++)
+	{
+		TermUiClearRow(&termUi, row);
+	}
+	TermUiPrintf(&termUi, 0, "Grading live video through the color LUT in %s", PixFmtName(procFmt));
+	TermUiPrintf(&termUi, 8, "i   - Invert on/off");
+	TermUiPrintf(&termUi, 9, "r   - Reset to no grading");
+	TermUiPrintf(&termUi, 10, "a   - Auto contrast from the input");
+	TermUiPrintf(&termUi, 11, "m   - Regrade only the tiles that changed on/off");
+	TermUiPrintf(&termUi, 12, "o   - On-screen display on/off");
+	TermUiPrintf(&termUi, 15, "Any other key returns, leaving the last graded frame displayed");
+	TermUiInvalidate(&termUi);
+
+	UartFlushRx();
+	start = TimerGetUs();
+	while (!fDone)
+	{
+		TermUiPrintf(&termUi, 2, "g/G - Gamma       %4d.%02d", params.gamma / 100, params.gamma % 100);
+		TermUiPrintf(&termUi, 3, "b/B - Brightness  %4d", params.brightness);
+		TermUiPrintf(&termUi, 4, "c/C - Contrast    %4d%%", params.contrast);
+		TermUiPrintf(&termUi, 5, "t/T - Temperature %4d", params.temperature);
+		TermUiPrintf(&termUi, 6, "      Invert      %4s", params.fInvert ? "on" : "off");
+		TermUiPrintf(&termUi, 7, "      Changed only%4s", fMotion ? "on" : "off");
+		TermUiClearRow(&termUi, 14);
+		if (videoCapt.state != VIDEO_STREAMING)
+		{
+			TermUiPrintf(&termUi, 13, "No video streaming, waiting");
+			inputStats.pixels = 0;
+		}
+		else if (fMotion)
+		{
+			TermUiPrintf(&termUi, 13, "%lu.%lu updates/s, table lookups on changed tiles", (unsigned long) (rate10 / 10), (unsigned long) (rate10 % 10));
+			TermUiPrintf(&termUi, 14, "Motion: %lu.%lu%% of the frame, %lu of %lu tiles changed", (unsigned long) (motionScore / 10),
+					(unsigned long) (motionScore % 10), (unsigned long) motionChanged, (unsigned long) (motionMap.cols * motionMap.rows));
+		}
+		else
+		{
+			TermUiPrintf(&termUi, 13, "%lu.%lu frames/s, %s", (unsigned long) (rate10 / 10), (unsigned long) (rate10 % 10),
+					gradeLut.fXor ? "XOR, vectors" : "table lookups");
+		}
+		DemoPrintStats(&inputStats, 17);
+		DemoOsdStatus(rate10);
+		TermUiRefresh(&termUi, 15);
+
+		/*
+		 * Grade frames until a key arrives, the frame rate is due or video
+		 * starts or stops
+		 */
+		fKey = 0;
+		fStreaming = (videoCapt.state == VIDEO_STREAMING);
+		while (!fKey && fStreaming == (videoCapt.state == VIDEO_STREAMING))
+		{
+			fKey = UartGetChar(&userInput);
+			if (fKey)
+			{
+				break;
+			}
+			if (!fStreaming)
+			{
+				TimerSleep();
+				continue;
+			}
+
+			if (fMotion)
+			{
+				if (DemoGradeChanged(fFull))
+				{
+					motionChanged = motionMap.changed;
+					motionScore = motionMap.score;
+				}
+				fFull = 0;
+			}
+			else
+			{
+				outFrame = (videoCapt.curFrame + 1) % DISPLAY_NUM_FRAMES;
+				if (outFrame == dispCtrl.curFrame)
+				{
+					outFrame = (outFrame + 1) % DISPLAY_NUM_FRAMES;
+				}
+				DemoProcessFrame(outFrame, 0);
+				if (fOsd)
+				{
+					DemoOsdFrame(pFrames[outFrame]);
+				}
+				DisplayChangeFrame(&dispCtrl, outFrame);
+			}
+			frames++;
+
+			elapsed = TimerGetUs() - start;
+			if (elapsed >= DEMO_GRADE_RATE_US)
+			{
+				rate10 = (u32) (frames * 10000000ull / elapsed);
+				frames = 0;
+				start += elapsed;
+				DemoStatsFrame(pFrames[videoCapt.curFrame], videoCapt.timing.HActiveVideo, videoCapt.timing.VActiveVideo, DEMO_STRIDE,
+						videoCapt.fmt, DEMO_GRADE_STATS_STEP, &inputStats);
+				fFull = 1;
+				break;
+			}
+		}
+		if (!fKey)
+		{
+			continue;
+		}
+
+		fFull = 1;
+		next = params;
+		switch (userInput)
+		{
+		case 'g':
+			next.gamma -= DEMO_GRADE_GAMMA_STEP;
+			break;
+		case 'G':
+			next.gamma += DEMO_GRADE_GAMMA_STEP;
+			break;
+		case 'b':
+			next.brightness -= DEMO_GRADE_BRIGHTNESS_STEP;
+			break;
+		case 'B':
+			next.brightness += DEMO_GRADE_BRIGHTNESS_STEP;
+			break;
+		case 'c':
+			next.contrast -= DEMO_GRADE_CONTRAST_STEP;
+			break;
+		case 'C':
+			next.contrast += DEMO_GRADE_CONTRAST_STEP;
+			break;
+		case 't':
+			next.temperature -= DEMO_GRADE_TEMP_STEP;
+			break;
+		case 'T':
+			next.temperature += DEMO_GRADE_TEMP_STEP;
+			break;
+		case 'i':
+			next.fInvert = !next.fInvert;
+			break;
+		case 'r':
+			ColorLutDefaults(&next);
+			break;
+		case 'a':
+			/*
+			 * Stretch the luma between the percentiles that leave
+			 * DEMO_GRADE_STRETCH_PERMILLE of the pixels out at each end, unless
+			 * there are no statistics yet or the input is nearly flat
+			 */
+			if (inputStats.pixels != 0)
+			{
+				low = FrameStatsPercentile(&inputStats, FRAME_STATS_LUMA, DEMO_GRADE_STRETCH_PERMILLE);
+				high = FrameStatsPercentile(&inputStats, FRAME_STATS_LUMA, 1000 - DEMO_GRADE_STRETCH_PERMILLE);
+				if (high >= low + DEMO_GRADE_STRETCH_MIN)
+				{
+					ColorLutStretch(&next, low, high);
+				}
+			}
+			break;
+		case 'm':
+			fMotion = !fMotion;
+			break;
+		case 'o':
+			fOsd = !fOsd;
+			break;
+		default:
+			fDone = 1;
+		}
+
+		/*
+		 * Settings past their range are refused and left as they were
+		 */
+		if (!fDone && ColorLutSet(&gradeLut, &next) == XST_SUCCESS)
+		{
+			params = next;
+		}
+	}
+}
+
+/*
+ * One step of DemoGrade with motion on, returning nonzero if it compared
+ * grabs. Capture alternates between the two framebuffers that are not
+ * displayed, so the one it last left holds the previous grab. Waits for a
+ * whole frame to land in the one it is on, maps that grab against the
+ * previous one, moves capture to the other framebuffer so the grab holds
+ * still, and grades only its changed tiles into the displayed framebuffer,
+ * which keeps the rest from earlier steps. The grab is still being written
+ * while it is compared, so a change made during the comparison can be
+ * missed until the next full step. With fFull set, or with capture on the
+ * displayed framebuffer, it grades every tile instead. The tiles under the
+ * on-screen display are always regraded, so it is blended over fresh
+ * pixels.
+ */
+int DemoGradeChanged(int fFull)
+{
+	u32 width = videoCapt.timing.HActiveVideo;
+	u32 height = videoCapt.timing.VActiveVideo;
+	u32 cur;
+	u32 x, y, w, h;
+	u64 elapsed;
+
+	if (videoCapt.curFrame == dispCtrl.curFrame || motionPrev == videoCapt.curFrame || motionPrev == dispCtrl.curFrame)
+	{
+		if (videoCapt.curFrame == dispCtrl.curFrame)
+		{
+			VideoChangeFrame(&videoCapt, (dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES);
+			motionSwitchUs = TimerGetUs();
+		}
+		for (motionPrev = 0; motionPrev == videoCapt.curFrame || motionPrev == dispCtrl.curFrame; motionPrev++)
+		{
+		}
+		fFull = 1;
+	}
+
+	elapsed = TimerGetUs() - motionSwitchUs;
+	if (elapsed < DEMO_MOTION_SETTLE_US)
+	{
+		TimerDelay((u32) (DEMO_MOTION_SETTLE_US - elapsed));
+	}
+
+	cur = videoCapt.curFrame;
+	if (fFull)
+	{
+		MotionMapInit(&motionMap, width, height);
+		MotionMapSetAll(&motionMap);
+		MotionMapFinish(&motionMap);
+	}
+	else
+	{
+		DemoMotionFrame(pFrames[cur], pFrames[motionPrev], width, height, DEMO_STRIDE, videoCapt.fmt, DEMO_MOTION_THRESHOLD, &motionMap);
+	}
+
+	VideoChangeFrame(&videoCapt, motionPrev);
+	motionSwitchUs = TimerGetUs();
+	motionPrev = cur;
+	if (fOsd)
+	{
+		OsdBounds(&osd, &x, &y, &w, &h);
+		MotionMapMark(&motionMap, x, y, w, h);
+	}
+	DemoLutChanged(pFrames[cur], pFrames[dispCtrl.curFrame], width, height, DEMO_STRIDE, videoCapt.fmt, &gradeLut, &motionMap);
+	if (fOsd)
+	{
+		DemoOsdFrame(pFrames[dispCtrl.curFrame]);
+	}
+
+	return !fFull;
+}
+
+/*
+ * Sets the on-screen display to the status the main menu shows, plus the
+ * rate DemoGrade produces frames at, drawn at twice the size on wide
+ * displays. Only the characters that changed are rendered again.
+ */
+void DemoOsdStatus(u32 rate10)
+{
+	BwReport bw;
+	u32 scale = (dispCtrl.vMode.width >= DEMO_OSD_WIDE) ? 2 : 1;
+
+	if (osd.scale != scale)
+	{
+		OsdInit(&osd, DEMO_OSD_X, DEMO_OSD_Y, scale, DEMO_OSD_COLOR, DEMO_OSD_DIM);
+	}
+
+	BwEvaluate(&dispCtrl.vMode, &videoCapt, &bw);
+	OsdPrintf(&osd, 0, "Display %s, %.3f MHz", dispCtrl.vMode.label, dispCtrl.pxlFreq);
+	if (videoCapt.state == VIDEO_DISCONNECTED)
+	{
+		OsdPrintf(&osd, 1, "Video in: HDMI unplugged");
+	}
+	else
+	{
+		OsdPrintf(&osd, 1, "Video in: %dx%d", videoCapt.timing.HActiveVideo, videoCapt.timing.VActiveVideo);
+	}
+	OsdPrintf(&osd, 2, "Frame index: display %d, video %d", dispCtrl.curFrame, videoCapt.curFrame);
+	OsdPrintf(&osd, 3, "Grading: %lu.%lu frames/s", (unsigned long) (rate10 / 10), (unsigned long) (rate10 % 10));
+	OsdPrintf(&osd, 4, "Headroom HP0/DDR: %lld/%lld MB/s", (long long) (bw.hpHeadroom / 1000000), (long long) (bw.ddrHeadroom / 1000000));
+	OsdUpdate(&osd);
+}
+
+/*
+ * Blends the on-screen display into a framebuffer just produced, clipped
+ * to the display resolution. Only the boxes are read and written.
+ */
+void DemoOsdFrame(u8 *frame)
+{
+	ProfMark mark;
+	u32 x, y, w, h;
+
+	OsdBounds(&osd, &x, &y, &w, &h);
+	if (h == 0 || y >= dispCtrl.vMode.height)
+	{
+		return;
+	}
+	h = (y + h > dispCtrl.vMode.height) ? dispCtrl.vMode.height - y : h;
+
+	ProfBegin(&mark, "DemoOsdFrame");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, frame + y * DEMO_STRIDE, h * DEMO_STRIDE);
+	OsdComposite(&osd, frame, dispCtrl.vMode.width, dispCtrl.vMode.height, DEMO_STRIDE, dispCtrl.fmt);
+	FbPolicyEnd(frame + y * DEMO_STRIDE, h * DEMO_STRIDE);
+	ProfEnd(&mark);
+}
+
+/*
+ * Puts the statistics of a frame on rows [row, row + 7) of termUi: minimum,
+ * maximum and mean of each channel, the share of clipped pixels and the
+ * luma histogram in 32 bins, each drawn as one character. Clears the rows
+ * when stats holds no pixels.
+ */
+void DemoPrintStats(const FrameStats *stats, u32 row)
+{
+	const char *const names[FRAME_STATS_CHANNELS] = {"Red", "Green", "Blue", "Luma"};
+	const u32 channels[FRAME_STATS_CHANNELS] = {FRAME_STATS_RED, FRAME_STATS_GREEN, FRAME_STATS_BLUE, FRAME_STATS_LUMA};
+	const char shades[] = " .:-=+*#";
+	char bars[33];
+	u32 bins[32];
+	u32 peak = 0;
+	u32 c, i;
+
+	if (stats->pixels == 0)
+	{
+		for (i = 0; i < 7; i++)
+		{
+			TermUiClearRow(&termUi, row + i);
+		}
+		return;
+	}
+
+	TermUiPrintf(&termUi, row, "Input, every %d lines   min  max    mean", DEMO_GRADE_STATS_STEP);
+	for (i = 0; i < FRAME_STATS_CHANNELS; i++)
+	{
+		c = channels[i];
+		TermUiPrintf(&termUi, row + 1 + i, "  %-20s %3lu  %3lu  %3lu.%02lu", names[i], (unsigned long) stats->min[c], (unsigned long) stats->max[c],
+				(unsigned long) (stats->mean100[c] / 100), (unsigned long) (stats->mean100[c] % 100));
+	}
+	TermUiPrintf(&termUi, row + 5, "Clipped pixels: %lu.%lu%% at black, %lu.%lu%% at white",
+			(unsigned long) ((u64) stats->clippedLow * 1000 / stats->pixels / 10), (unsigned long) ((u64) stats->clippedLow * 1000 / stats->pixels % 10),
+			(unsigned long) ((u64) stats->clippedHigh * 1000 / stats->pixels / 10), (unsigned long) ((u64) stats->clippedHigh * 1000 / stats->pixels % 10));
+
+	/*
+	 * Shade each bin by its share of the fullest one, so any bin with
+	 * pixels in it shows
+	 */
+	for (i = 0; i < 32; i++)
+	{
+		bins[i] = 0;
+		for (c = i * 8; c < i * 8 + 8; c++)
+		{
+			bins[i] += stats->hist[FRAME_STATS_LUMA][c];
+		}
+		if (bins[i] > peak)
+		{
+			peak = bins[i];
+		}
+	}
+	for (i = 0; i < 32; i++)
+	{
+		bars[i] = shades[(bins[i] == 0) ? 0 : 1 + (u32) ((u64) bins[i] * (sizeof(shades) - 3) / peak)];
+	}
+	bars[32] = '\0';
+	TermUiPrintf(&termUi, row + 6, "Luma histogram |%s|", bars);
+}
+
+/*
+ * Grades the captured frame through gradeLut, or scales it to the display
+ * resolution, into framebuffer destIndex, working in procFmt. When the framebuffers are in
+ * another format the frame goes through the work frames, converted on the
+ * CPU, as it must until the VDMA streams carry procFmt pixels.
+ */
+void DemoProcessFrame(u32 destIndex, int fScale)
+{
+	u8 *srcFrame = pFrames[videoCapt.curFrame];
+	u8 *destFrame = pFrames[destIndex];
+	u32 srcWidth = videoCapt.timing.HActiveVideo;
+	u32 srcHeight = videoCapt.timing.VActiveVideo;
+	u32 destWidth = fScale ? dispCtrl.vMode.width : srcWidth;
+	u32 destHeight = fScale ? dispCtrl.vMode.height : srcHeight;
+	u32 workStride = DEMO_MAX_WIDTH * PixFmtBytes(procFmt);
+	ProfMark mark;
+
+	if (procFmt == videoCapt.fmt && procFmt == dispCtrl.fmt)
+	{
+		if (fScale)
+		{
+			DemoScaleFrame(srcFrame, destFrame, srcWidth, srcHeight, destWidth, destHeight, DEMO_STRIDE, procFmt);
+		}
+		else
+		{
+			DemoLutFrame(srcFrame, destFrame, srcWidth, srcHeight, DEMO_STRIDE, procFmt, &gradeLut);
+		}
+		return;
+	}
+
+	ProfBegin(&mark, "PixFmtConvert in");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, srcFrame, srcHeight * DEMO_STRIDE);
+	PixFmtConvert(workBuf[0], procFmt, workStride, srcFrame, videoCapt.fmt, DEMO_STRIDE, srcWidth, srcHeight);
+	ProfEnd(&mark);
+
+	if (fScale)
+	{
+		DemoScaleFrame(workBuf[0], workBuf[1], srcWidth, srcHeight, destWidth, destHeight, workStride, procFmt);
+	}
+	else
+	{
+		DemoLutFrame(workBuf[0], workBuf[1], srcWidth, srcHeight, workStride, procFmt, &gradeLut);
+	}
+
+	ProfBegin(&mark, "PixFmtConvert out");
+	PixFmtConvert(destFrame, dispCtrl.fmt, DEMO_STRIDE, workBuf[1], procFmt, workStride, destWidth, destHeight);
+	FbPolicyEnd(destFrame, DEMO_MAX_FRAME);
+	ProfEnd(&mark);
+}
+
+void DemoInvertFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride, PixFmt fmt)
+{
+	DemoLutFrame(srcFrame, destFrame, width, height, stride, fmt, &invertLut);
+}
+
+/*
+ * Runs every channel through lut. Tables that amount to an XOR, inversion
+ * included, go to the invert tiles, which XOR whole vectors; the rest go
+ * to the LUT tiles, which look each channel up.
+ */
+void DemoLutFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride, PixFmt fmt, const ColorLut *lut)
+{
+	DemoFrameJob job;
+	TileSched sched;
+	const DemoModeKernels *kernels;
+	TileSchedFn tileFn;
+	ProfMark mark, flushMark;
+	u32 i;
+
+	ProfBegin(&mark, (fmt == PIXFMT_XRGB8888) ? "DemoLutFrame XRGB" : "DemoLutFrame");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, srcFrame, height * stride);
+
+	kernels = DemoFindKernels(width, height, stride, fmt);
+	if (!lut->fXor)
+	{
+		tileFn = (fmt == PIXFMT_XRGB8888) ? DemoLutTileXrgb : DemoLutTile;
+	}
+	else if (kernels != NULL)
+	{
+		tileFn = kernels->invert[fmt];
+	}
+	else
+	{
+		tileFn = (fmt == PIXFMT_XRGB8888) ? DemoInvertTileXrgb : DemoInvertTile;
+	}
+
+	/*
+	 * Share the tiles between both cores
+	 */
+	job.srcFrame = srcFrame;
+	job.destFrame = destFrame;
+	job.srcWidth = width;
+	job.srcHeight = height;
+	job.destWidth = width;
+	job.destHeight = height;
+	job.stride = stride;
+	for (i = 0; i < AMP_NUM_CPUS; i++)
+	{
+		job.ring[i] = NULL;
+		job.stats[i] = NULL;
+	}
+	job.cols = NULL;
+	job.lut = lut;
+	job.xorMask = ColorLutXorWord(lut, fmt);
+	job.lineStep = 0;
+	job.motion = NULL;
+	job.threshold = 0;
+	TileSchedInit(&sched, tileFn, &job, width, height, TILE_SCHED_TILE_W, TILE_SCHED_TILE_H, TileSchedWorkers());
+	TileSchedRun(&sched);
+
+	/*
+	 * Make the changes visible to the VDMA, flushing them if the framebuffer
+	 * mapping requires it
+	 */
+	ProfBegin(&flushMark, "FbPolicyEnd");
+	FbPolicyEnd(destFrame, (fmt == PIXFMT_XRGB8888) ? DEMO_MAX_FRAME_XRGB : DEMO_MAX_FRAME);
+	ProfEnd(&flushMark);
+	ProfEnd(&mark);
+}
+
+/*
+ * Body of every invert tile: XORs lineBytes bytes from byte xByte of lines
+ * [y0, y1) with mask, from ColorLutXorWord, which leaves the unused byte of
+ * XRGB8888 pixels 0. Always inlined, so a tile that passes constant
+ * lineBytes and stride gets a loop with constant trip counts and no dead
+ * tail.
+ */
+static inline __attribute__((always_inline)) void DemoInvertRows(DemoFrameJob *job, u32 xByte, u32 y0, u32 y1, u32 lineBytes, u32 stride, u32 mask)
+{
+	const DemoVec vmask = {mask, mask, mask, mask};
+	const u8 *src = job->srcFrame + y0 * stride + xByte;
+	u8 *dest = job->destFrame + y0 * stride + xByte;
+	DemoVec v0, v1, v2, v3;
+	u32 i, ycoi;
+
+	for (ycoi = y0; ycoi < y1; ycoi++)
+	{
+		for (i = 0; i + 64 <= lineBytes; i += 64)
+		{
+			memcpy(&v0, src + i, 16);
+			memcpy(&v1, src + i + 16, 16);
+			memcpy(&v2, src + i + 32, 16);
+			memcpy(&v3, src + i + 48, 16);
+			v0 ^= vmask;
+			v1 ^= vmask;
+			v2 ^= vmask;
+			v3 ^= vmask;
+			memcpy(dest + i, &v0, 16);
+			memcpy(dest + i + 16, &v1, 16);
+			memcpy(dest + i + 32, &v2, 16);
+			memcpy(dest + i + 48, &v3, 16);
+		}
+		for (; i + 16 <= lineBytes; i += 16)
+		{
+			memcpy(&v0, src + i, 16);
+			v0 ^= vmask;
+			memcpy(dest + i, &v0, 16);
+		}
+		for (; i < lineBytes; i++)
+		{
+			dest[i] = src[i] ^ (u8) (mask >> ((i & 3) * 8));
+		}
+		src += stride;
+		dest += stride;
+	}
+}
+
+/*
+ * Applies the XOR table of a DemoFrameJob, inversion unless it is graded,
+ * to the pixels [x0, x1) x [y0, y1). Runs on either core.
+ */
+OCM_TEXT void DemoInvertTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+
+	DemoInvertRows(job, x0 * 3, y0, y1, (x1 - x0) * 3, job->stride, job->xorMask);
+}
+
+/*
+ * DemoInvertTile for XRGB8888 frames. Tiles start on a multiple of
+ * TILE_SCHED_TILE_W pixels, so the vectors are aligned.
+ */
+OCM_TEXT void DemoInvertTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+
+	DemoInvertRows(job, x0 * 4, y0, y1, (x1 - x0) * 4, job->stride, job->xorMask);
+}
+
+/*
+ * Looks the pixels [x0, x1) x [y0, y1) of a DemoFrameJob up in its tables.
+ * Runs on either core.
+ */
+OCM_TEXT void DemoLutTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+	u32 offset = y0 * job->stride + x0 * 3;
+	u32 ycoi;
+
+	for (ycoi = y0; ycoi < y1; ycoi++)
+	{
+		ColorLutApply(job->lut, job->destFrame + offset, job->srcFrame + offset, x1 - x0, PIXFMT_RGB888);
+		offset += job->stride;
+	}
+}
+
+/*
+ * DemoLutTile for XRGB8888 frames
+ */
+OCM_TEXT void DemoLutTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+	u32 offset = y0 * job->stride + x0 * 4;
+	u32 ycoi;
+
+	for (ycoi = y0; ycoi < y1; ycoi++)
+	{
+		ColorLutApply(job->lut, job->destFrame + offset, job->srcFrame + offset, x1 - x0, PIXFMT_XRGB8888);
+		offset += job->stride;
+	}
+}
+
+/*
+ * Collects the histograms and statistics of every lineStep-th line of a
+ * frame into stats in one pass, reading the frame and writing nothing.
+ * Each core counts its bands into partial statistics of its own in OCM,
+ * which are added up once the frame is done.
+ */
+void DemoStatsFrame(u8 *frame, u32 width, u32 height, u32 stride, PixFmt fmt, u32 lineStep, FrameStats *stats)
+{
+	DemoFrameJob job;
+	TileSched sched;
+	ProfMark mark;
+	u32 ocmMark;
+	u32 i;
+
+	ProfBegin(&mark, (fmt == PIXFMT_XRGB8888) ? "DemoStatsFrame XRGB" : "DemoStatsFrame");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, frame, height * stride);
+
+	job.srcFrame = frame;
+	job.destFrame = NULL;
+	job.srcWidth = width;
+	job.srcHeight = height;
+	job.destWidth = width;
+	job.destHeight = height;
+	job.stride = stride;
+	job.cols = NULL;
+	job.lut = NULL;
+	job.xorMask = 0;
+	job.lineStep = (lineStep == 0) ? 1 : lineStep;
+	job.motion = NULL;
+	job.threshold = 0;
+
+	ocmMark = OcmMark();
+	for (i = 0; i < AMP_NUM_CPUS; i++)
+	{
+		job.ring[i] = NULL;
+		job.stats[i] = OcmAlloc(sizeof(FrameStats), 0);
+		if (job.stats[i] == NULL)
+		{
+			job.stats[i] = &statsParts[i];
+		}
+		FrameStatsReset(job.stats[i]);
+	}
+
+	/*
+	 * Full width bands, so each sampled line is one call
+	 */
+	TileSchedInit(&sched, (fmt == PIXFMT_XRGB8888) ? DemoStatsTileXrgb : DemoStatsTile, &job, width, height, 0, TILE_SCHED_TILE_H,
+			TileSchedWorkers());
+	TileSchedRun(&sched);
+
+	FrameStatsReset(stats);
+	for (i = 0; i < AMP_NUM_CPUS; i++)
+	{
+		FrameStatsMerge(stats, job.stats[i]);
+	}
+	FrameStatsFinish(stats);
+	OcmRelease(ocmMark);
+
+	ProfEnd(&mark);
+}
+
+/*
+ * Counts the lines of [y0, y1) that fall on the job's line step into the
+ * statistics of the core it runs on
+ */
+OCM_TEXT void DemoStatsTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+	FrameStats *stats = job->stats[AmpCpuId()];
+	u32 ycoi;
+
+	for (ycoi = ((y0 + job->lineStep - 1) / job->lineStep) * job->lineStep; ycoi < y1; ycoi += job->lineStep)
+	{
+		FrameStatsAccumulate(stats, job->srcFrame + ycoi * job->stride + x0 * 3, x1 - x0, PIXFMT_RGB888);
+	}
+}
+
+/*
+ * DemoStatsTile for XRGB8888 frames
+ */
+OCM_TEXT void DemoStatsTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+	FrameStats *stats = job->stats[AmpCpuId()];
+	u32 ycoi;
+
+	for (ycoi = ((y0 + job->lineStep - 1) / job->lineStep) * job->lineStep; ycoi < y1; ycoi += job->lineStep)
+	{
+		FrameStatsAccumulate(stats, job->srcFrame + ycoi * job->stride + x0 * 4, x1 - x0, PIXFMT_XRGB8888);
+	}
+}
+
+/*
+ * Maps the 16x16 tiles of cur that differ from prev by a SAD of more than
+ * threshold into map, and sets its score. Only reads the frames. Both
+ * cores take full width bands of TILE_SCHED_TILE_H lines, which hold whole
+ * rows of motion tiles, so each writes only the map rows of its bands.
+ */
+void DemoMotionFrame(u8 *cur, u8 *prev, u32 width, u32 height, u32 stride, PixFmt fmt, u32 threshold, MotionMap *map)
+{
+	DemoFrameJob job;
+	TileSched sched;
+	ProfMark mark;
+	u32 i;
+
+	ProfBegin(&mark, (fmt == PIXFMT_XRGB8888) ? "DemoMotionFrame XRGB" : "DemoMotionFrame");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, cur, height * stride);
+	if (prev != cur)
+	{
+		FbPolicyBegin(FB_READ_MODIFY_WRITE, prev, height * stride);
+	}
+
+	if (MotionMapInit(map, width, height) != XST_SUCCESS)
+	{
+		ProfEnd(&mark);
+		return;
+	}
+
+	job.srcFrame = cur;
+	job.destFrame = prev;
+	job.srcWidth = width;
+	job.srcHeight = height;
+	job.destWidth = width;
+	job.destHeight = height;
+	job.stride = stride;
+	for (i = 0; i < AMP_NUM_CPUS; i++)
+	{
+		job.ring[i] = NULL;
+		job.stats[i] = NULL;
+	}
+	job.cols = NULL;
+	job.lut = NULL;
+	job.xorMask = 0;
+	job.lineStep = 0;
+	job.motion = map;
+	job.threshold = threshold;
+	TileSchedInit(&sched, (fmt == PIXFMT_XRGB8888) ? DemoMotionTileXrgb : DemoMotionTile, &job, width, height, 0, TILE_SCHED_TILE_H,
+			TileSchedWorkers());
+	TileSchedRun(&sched);
+
+	MotionMapFinish(map);
+	ProfEnd(&mark);
+}
+
+/*
+ * Compares the motion tile rows of the band [y0, y1). Runs on either core.
+ */
+OCM_TEXT void DemoMotionTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+
+	MotionMapCompare(job->motion, job->srcFrame, job->destFrame, job->stride, PIXFMT_RGB888, job->threshold, y0 / MOTION_MAP_TILE,
+			(y1 + MOTION_MAP_TILE - 1) / MOTION_MAP_TILE);
+}
+
+/*
+ * DemoMotionTile for XRGB8888 frames
+ */
+OCM_TEXT void DemoMotionTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+
+	MotionMapCompare(job->motion, job->srcFrame, job->destFrame, job->stride, PIXFMT_XRGB8888, job->threshold, y0 / MOTION_MAP_TILE,
+			(y1 + MOTION_MAP_TILE - 1) / MOTION_MAP_TILE);
+}
+
+/*
+ * Runs the tiles map marks changed through lut, leaving the rest of
+ * destFrame as it was. Both cores share the scheduler's tiles, whose edges
+ * fall on motion tile edges.
+ */
+void DemoLutChanged(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride, PixFmt fmt, const ColorLut *lut, MotionMap *map)
+{
+	DemoFrameJob job;
+	TileSched sched;
+	ProfMark mark, flushMark;
+	u32 i;
+
+	ProfBegin(&mark, (fmt == PIXFMT_XRGB8888) ? "DemoLutChanged XRGB" : "DemoLutChanged");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, srcFrame, height * stride);
+
+	job.srcFrame = srcFrame;
+	job.destFrame = destFrame;
+	job.srcWidth = width;
+	job.srcHeight = height;
+	job.destWidth = width;
+	job.destHeight = height;
+	job.stride = stride;
+	for (i = 0; i < AMP_NUM_CPUS; i++)
+	{
+		job.ring[i] = NULL;
+		job.stats[i] = NULL;
+	}
+	job.cols = NULL;
+	job.lut = lut;
+	job.xorMask = 0;
+	job.lineStep = 0;
+	job.motion = map;
+	job.threshold = 0;
+	TileSchedInit(&sched, (fmt == PIXFMT_XRGB8888) ? DemoLutChangedTileXrgb : DemoLutChangedTile, &job, width, height, TILE_SCHED_TILE_W,
+			TILE_SCHED_TILE_H, TileSchedWorkers());
+	TileSchedRun(&sched);
+
+	ProfBegin(&flushMark, "FbPolicyEnd");
+	FbPolicyEnd(destFrame, (fmt == PIXFMT_XRGB8888) ? DEMO_MAX_FRAME_XRGB : DEMO_MAX_FRAME);
+	ProfEnd(&flushMark);
+	ProfEnd(&mark);
+}
+
+/*
+ * Body of the changed-tile LUT tiles: looks up each run of changed motion
+ * tiles in [x0, x1) x [y0, y1) one line at a time
+ */
+static inline __attribute__((always_inline)) void DemoLutChangedRows(DemoFrameJob *job, u32 x0, u32 y0, u32 x1, u32 y1, u32 bytes, PixFmt fmt)
+{
+	u32 row, col, end, x, xEnd, y, yEnd, offset;
+
+	for (row = y0 / MOTION_MAP_TILE; row * MOTION_MAP_TILE < y1; row++)
+	{
+		y = row * MOTION_MAP_TILE;
+		yEnd = (y + MOTION_MAP_TILE < y1) ? y + MOTION_MAP_TILE : y1;
+		for (col = x0 / MOTION_MAP_TILE; col * MOTION_MAP_TILE < x1; col = end)
+		{
+			end = col + 1;
+			if (!MotionMapTest(job->motion, col, row))
+			{
+				continue;
+			}
+			while (end * MOTION_MAP_TILE < x1 && MotionMapTest(job->motion, end, row))
+			{
+				end++;
+			}
+
+			x = col * MOTION_MAP_TILE;
+			xEnd = (end * MOTION_MAP_TILE < x1) ? end * MOTION_MAP_TILE : x1;
+			for (offset = y * job->stride + x * bytes; offset < yEnd * job->stride; offset += job->stride)
+			{
+				ColorLutApply(job->lut, job->destFrame + offset, job->srcFrame + offset, xEnd - x, fmt);
+			}
+		}
+	}
+}
+
+/*
+ * Looks up the changed motion tiles of [x0, x1) x [y0, y1). Runs on either
+ * core.
+ */
+OCM_TEXT void DemoLutChangedTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoLutChangedRows((DemoFrameJob *) ref, x0, y0, x1, y1, 3, PIXFMT_RGB888);
+}
+
+/*
+ * DemoLutChangedTile for XRGB8888 frames
+ */
+OCM_TEXT void DemoLutChangedTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoLutChangedRows((DemoFrameJob *) ref, x0, y0, x1, y1, 4, PIXFMT_XRGB8888);
+}
+
+
+/*
+ * Bilinear interpolation algorithm. Assumes both frames have the same stride.
+ */
+void DemoScaleFrame(u8 *srcFrame, u8 *destFrame, u32 srcWidth, u32 srcHeight, u32 destWidth, u32 destHeight, u32 stride, PixFmt fmt)
+{
+	DemoFrameJob job;
+	TileSched sched;
+	const DemoModeKernels *kernels;
+	TileSchedFn tileFn;
+	DemoScaleCol *cols;
+	ProfMark mark, flushMark;
+	float xInc; // Width of a destination frame pixel in the source frame coordinate system
+	float xcoSrc; // Location of the destination column in the source frame coordinate system
+	u32 ocmMark;
+	u32 i;
+
+	ProfBegin(&mark, (fmt == PIXFMT_XRGB8888) ? "DemoScaleFrame XRGB" : "DemoScaleFrame");
+	FbPolicyBegin(FB_READ_MODIFY_WRITE, srcFrame, srcHeight * stride);
+
+	kernels = DemoFindKernels(destWidth, destHeight, stride, fmt);
+	if (kernels != NULL)
+	{
+		tileFn = kernels->scale[fmt];
+	}
+	else
+	{
+		tileFn = (fmt == PIXFMT_XRGB8888) ? DemoScaleTileXrgb : DemoScaleTile;
+	}
+
+	/*
+	 * Share the destination between both cores in full width bands, which
+	 * the specialized scale tiles rely on
+	 */
+	job.srcFrame = srcFrame;
+	job.destFrame = destFrame;
+	job.srcWidth = srcWidth;
+	job.srcHeight = srcHeight;
+	job.destWidth = destWidth;
+	job.destHeight = destHeight;
+	job.stride = stride;
+
+	/*
+	 * Work out the source column and weight of every destination column
+	 * once, stepping xcoSrc the way each line used to so the results round
+	 * the same. Every line of every band reads them from OCM.
+	 */
+	ocmMark = OcmMark();
+	cols = OcmAlloc(destWidth * sizeof(DemoScaleCol), 0);
+	if (cols == NULL)
+	{
+		cols = scaleCols;
+	}
+	xInc = ((float) srcWidth - 1.0) / ((float) destWidth);
+	xcoSrc = 0.0;
+	for (i = 0; i < destWidth; i++)
+	{
+		cols[i].ix = (int) xcoSrc;
+		cols[i].dist = xcoSrc - ((float) ((int) xcoSrc));
+		xcoSrc += xInc;
+	}
+	job.cols = cols;
+	job.lut = NULL;
+	job.xorMask = 0;
+	job.lineStep = 0;
+	job.motion = NULL;
+	job.threshold = 0;
+
+	/*
+	 * Give each core its source lines in OCM, so every source line is read
+	 * from DDR once, with vector loads, however many destination lines
+	 * use it. A core that gets no OCM reads the frame directly.
+	 */
+	for (i = 0; i < AMP_NUM_CPUS; i++)
+	{
+		job.ring[i] = OcmAlloc(DEMO_RING_LINES * stride, 0);
+		job.stats[i] = NULL;
+	}
+
+	TileSchedInit(&sched, tileFn, &job, destWidth, destHeight, 0, TILE_SCHED_TILE_H, TileSchedWorkers());
+	TileSchedRun(&sched);
+	OcmRelease(ocmMark);
+
+	/*
+	 * Make the changes visible to the VDMA, flushing them if the framebuffer
+	 * mapping requires it
+	 */
+	ProfBegin(&flushMark, "FbPolicyEnd");
+	FbPolicyEnd(destFrame, (fmt == PIXFMT_XRGB8888) ? DEMO_MAX_FRAME_XRGB : DEMO_MAX_FRAME);
+	ProfEnd(&flushMark);
+	ProfEnd(&mark);
+
+	return;
+}
+
+/*
+ * Points line1 and line2 at source lines iy1 and iy1 + 1, taking them from
+ * the core's ring in OCM when it has one and copying in any line it does
+ * not hold yet. Lines iy1 and iy1 + 1 always fall in different slots.
+ */
+static inline __attribute__((always_inline)) void DemoScaleLines(DemoFrameJob *job, u8 *ring, int ringRow[DEMO_RING_LINES], int iy1, u32 lineBytes, u32 stride,
+		const u8 **line1, const u8 **line2)
+{
+	int slot;
+	int i;
+
+	if (ring == NULL)
+	{
+		*line1 = job->srcFrame + iy1 * stride;
+		*line2 = *line1 + stride;
+		return;
+	}
+
+	for (i = 0; i < DEMO_RING_LINES; i++)
+	{
+		slot = (iy1 + i) % DEMO_RING_LINES;
+		if (ringRow[slot] != iy1 + i)
+		{
+			BlitCopy(ring + slot * stride, job->srcFrame + (iy1 + i) * stride, lineBytes);
+			ringRow[slot] = iy1 + i;
+		}
+	}
+	*line1 = ring + (iy1 % DEMO_RING_LINES) * stride;
+	*line2 = ring + ((iy1 + 1) % DEMO_RING_LINES) * stride;
+}
+
+/*
+ * Body of the RGB888 scale tiles, always inlined so a tile that passes
+ * constant x0, x1 and stride gets loops with constant trip counts
+ */
+static inline __attribute__((always_inline)) void DemoScaleRows(DemoFrameJob *job, u32 x0, u32 y0, u32 x1, u32 y1, u32 stride)
+{
+	u8 *destFrame = job->destFrame;
+	const DemoScaleCol *cols = job->cols;
+	u8 *ring = job->ring[AmpCpuId()];
+	int ringRow[DEMO_RING_LINES] = {-1, -1}; // Source line held in each ring slot
+	const u8 *line1, *line2; // Source lines with y1 and y2
+	float yInc; // Height of a destination frame pixel in the source frame coordinate system
+	float ycoSrc; // Location of the destination line being operated on in the source frame coordinate system
+	float x1y1, x2y1, x1y2, x2y2; //Used to store the color data of the four nearest source pixels to the destination pixel
+	int ix1, ix2; //indexes into the source lines for the two nearest source pixels to the destination pixel on each line
+	float xDist, yDist; //distances between destination pixel and x1y1 source pixels in source frame coordinate system
+
+	u32 xcoDest, ycoDest; // Location of the destination pixel being operated on in the destination coordinate system
+	int iy1; //Used to store the source line with y1
+	u32 iDest; //index of the pixel data in the destination frame being operated on
+
+	int i;
+
+	yInc = ((float) job->srcHeight - 1.0) / ((float) job->destHeight);
+
+	/*
+	 * Step ycoSrc up to the first line of the tile the same way the loop
+	 * does, so every tile rounds exactly like a single pass
+	 */
+	ycoSrc = 0.0;
+	for (ycoDest = 0; ycoDest < y0; ycoDest++)
+	{
+		ycoSrc += yInc;
+	}
+
+	for (ycoDest = y0; ycoDest < y1; ycoDest++)
+	{
+		iy1 = (int) ycoSrc;
+		yDist = ycoSrc - ((float) ((int) ycoSrc));
+		DemoScaleLines(job, ring, ringRow, iy1, job->srcWidth * 3, stride, &line1, &line2);
+
+		/*
+		 * Save some cycles in the loop below by presetting the destination
+		 * index to the first pixel in the current line
+		 */
+		iDest = ycoDest * stride + x0 * 3;
+
+		for (xcoDest = x0; xcoDest < x1; xcoDest++)
+		{
+			ix1 = cols[xcoDest].ix * 3;
+			ix2 = ix1 + 3;
+			xDist = cols[xcoDest].dist;
+
+			/*
+			 * For loop handles all three colors
+			 */
+			for (i = 0; i < 3; i++)
+			{
+				x1y1 = (float) line1[ix1 + i];
+				x2y1 = (float) line1[ix2 + i];
+				x1y2 = (float) line2[ix1 + i];
+				x2y2 = (float) line2[ix2 + i];
+
+				/*
+				 * Bilinear interpolation function
+				 */
+				destFrame[iDest] = (u8) ((1.0-yDist)*((1.0-xDist)*x1y1+xDist*x2y1) + yDist*((1.0-xDist)*x1y2+xDist*x2y2));
+				iDest++;
+			}
+		}
+		ycoSrc += yInc;
+	}
+}
+
+/*
+ * Color at bit shift of four XRGB8888 pixels, weighted, returned at the same
+ * shift
+ */
+static inline u32 DemoScaleChannel(const float w[4], u32 p11, u32 p21, u32 p12, u32 p22, int shift)
+{
+	return ((u32) (u8) (w[0] * (float) ((p11 >> shift) & 0xFF) + w[1] * (float) ((p21 >> shift) & 0xFF) +
+			w[2] * (float) ((p12 >> shift) & 0xFF) + w[3] * (float) ((p22 >> shift) & 0xFF))) << shift;
+}
+
+/*
+ * Body of the XRGB8888 scale tiles. Each of the four source pixels is one
+ * word load and each result one word store, in place of three byte
+ * accesses each. The four bilinear weights are worked out once per pixel in
+ * single precision rather than per color in double, which can round a color
+ * one step differently (DEMO_VERIFY_SCALE_TOL).
+ */
+static inline __attribute__((always_inline)) void DemoScaleRowsXrgb(DemoFrameJob *job, u32 x0, u32 y0, u32 x1, u32 y1, u32 stride)
+{
+	const DemoScaleCol *cols = job->cols;
+	u8 *ring = job->ring[AmpCpuId()];
+	int ringRow[DEMO_RING_LINES] = {-1, -1}; // Source line held in each ring slot
+	const u8 *line1, *line2; // Source lines with y1 and y2
+	const u32 *src1, *src2;
+	u32 *destLine;
+	float yInc; // Height of a destination frame pixel in the source frame coordinate system
+	float ycoSrc; // Location of the destination line being operated on in the source frame coordinate system
+	u32 p11, p21, p12, p22; // The four nearest source pixels to the destination pixel
+	float w[4]; // Weights of p11, p21, p12 and p22
+	int ix1; //index into the source lines of the left two source pixels
+	float xDist, yDist; //distances between destination pixel and x1y1 source pixels in source frame coordinate system
+
+	u32 xcoDest, ycoDest; // Location of the destination pixel being operated on in the destination coordinate system
+	int iy1; //Used to store the source line with y1
+
+	yInc = ((float) job->srcHeight - 1.0) / ((float) job->destHeight);
+
+	ycoSrc = 0.0;
+	for (ycoDest = 0; ycoDest < y0; ycoDest++)
+	{
+		ycoSrc += yInc;
+	}
+
+	for (ycoDest = y0; ycoDest < y1; ycoDest++)
+	{
+		iy1 = (int) ycoSrc;
+		yDist = ycoSrc - ((float) ((int) ycoSrc));
+		DemoScaleLines(job, ring, ringRow, iy1, job->srcWidth * 4, stride, &line1, &line2);
+		src1 = (const u32 *) line1;
+		src2 = (const u32 *) line2;
+
+		destLine = (u32 *) (job->destFrame + ycoDest * stride);
+
+		for (xcoDest = x0; xcoDest < x1; xcoDest++)
+		{
+			ix1 = cols[xcoDest].ix;
+			p11 = src1[ix1];
+			p21 = src1[ix1 + 1];
+			p12 = src2[ix1];
+			p22 = src2[ix1 + 1];
+
+			xDist = cols[xcoDest].dist;
+			w[0] = (1.0f - yDist) * (1.0f - xDist);
+			w[1] = (1.0f - yDist) * xDist;
+			w[2] = yDist * (1.0f - xDist);
+			w[3] = yDist * xDist;
+
+			destLine[xcoDest] = DemoScaleChannel(w, p11, p21, p12, p22, 0) |
+					DemoScaleChannel(w, p11, p21, p12, p22, 8) |
+					DemoScaleChannel(w, p11, p21, p12, p22, 16);
+		}
+		ycoSrc += yInc;
+	}
+}
+
+/*
+ * Scales the destination pixels [x0, x1) x [y0, y1) of a DemoFrameJob. Runs
+ * on either core.
+ */
+OCM_TEXT void DemoScaleTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+
+	DemoScaleRows(job, x0, y0, x1, y1, job->stride);
+}
+
+/*
+ * DemoScaleTile for XRGB8888 frames
+ */
+OCM_TEXT void DemoScaleTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1)
+{
+	DemoFrameJob *job = (DemoFrameJob *) ref;
+
+	DemoScaleRowsXrgb(job, x0, y0, x1, y1, job->stride);
+}
+
+/*
+ * Tiles specialized for one resolution of DEMO_KERNEL_MODES, in frames of
+ * the DEMO_STRIDE or DEMO_STRIDE_XRGB stride. Width, edge tile width and
+ * stride are constants, so the inlined bodies above compile to loops with
+ * fixed trip counts and strides, the invert ones to whole vectors only.
+ * The scale tiles take full width bands, as DemoScaleFrame schedules them.
+ */
+#define DEMO_MODE_TILES(w, h) \
+OCM_TEXT static void DemoInvertTile_##w##x##h(void *ref, u32 x0, u32 y0, u32 x1, u32 y1) \
+{ \
+	if (x1 - x0 == TILE_SCHED_TILE_W) \
+		DemoInvertRows((DemoFrameJob *) ref, x0 * 3, y0, y1, TILE_SCHED_TILE_W * 3, DEMO_STRIDE, ((DemoFrameJob *) ref)->xorMask); \
+	else \
+		DemoInvertRows((DemoFrameJob *) ref, x0 * 3, y0, y1, ((w) % TILE_SCHED_TILE_W) * 3, DEMO_STRIDE, ((DemoFrameJob *) ref)->xorMask); \
+} \
+OCM_TEXT static void DemoInvertTileXrgb_##w##x##h(void *ref, u32 x0, u32 y0, u32 x1, u32 y1) \
+{ \
+	if (x1 - x0 == TILE_SCHED_TILE_W) \
+		DemoInvertRows((DemoFrameJob *) ref, x0 * 4, y0, y1, TILE_SCHED_TILE_W * 4, DEMO_STRIDE_XRGB, ((DemoFrameJob *) ref)->xorMask); \
+	else \
+		DemoInvertRows((DemoFrameJob *) ref, x0 * 4, y0, y1, ((w) % TILE_SCHED_TILE_W) * 4, DEMO_STRIDE_XRGB, ((DemoFrameJob *) ref)->xorMask); \
+} \
+OCM_TEXT static void DemoScaleTile_##w##x##h(void *ref, u32 x0, u32 y0, u32 x1, u32 y1) \
+{ \
+	DemoScaleRows((DemoFrameJob *) ref, 0, y0, (w), y1, DEMO_STRIDE); \
+} \
+OCM_TEXT static void DemoScaleTileXrgb_##w##x##h(void *ref, u32 x0, u32 y0, u32 x1, u32 y1) \
+{ \
+	DemoScaleRowsXrgb((DemoFrameJob *) ref, 0, y0, (w), y1, DEMO_STRIDE_XRGB); \
+}
+
+#define DEMO_MODE_ENTRY(w, h) \
+	{(w), (h), {DemoInvertTile_##w##x##h, DemoInvertTileXrgb_##w##x##h}, {DemoScaleTile_##w##x##h, DemoScaleTileXrgb_##w##x##h}},
+
+DEMO_KERNEL_MODES(DEMO_MODE_TILES)
+
+/*
+ * Specialized tiles of each resolution, looked up by DemoFindKernels
+ */
+static const DemoModeKernels modeKernels[] = {
+	DEMO_KERNEL_MODES(DEMO_MODE_ENTRY)
+};
+
+/*
+ * Returns the tiles specialized for width x height frames of the given
+ * format, or NULL if there are none, the frames do not have the stride
+ * they were built for, or fModeKernels is off. The frame functions fall
+ * back to the generic tiles on NULL.
+ */
+const DemoModeKernels *DemoFindKernels(u32 width, u32 height, u32 stride, PixFmt fmt)
+{
+	u32 i;
+
+	if (!fModeKernels || stride != DEMO_MAX_WIDTH * PixFmtBytes(fmt))
+	{
+		return NULL;
+	}
+
+	for (i = 0; i < sizeof(modeKernels) / sizeof(modeKernels[0]); i++)
+	{
+		if (modeKernels[i].width == width && modeKernels[i].height == height)
+		{
+			return &modeKernels[i];
+		}
+	}
+
+	return NULL;
+}
+
+void DemoPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern)
+{
+	u32 xcoi, ycoi;
+	u32 iPixelAddr;
+	u8 wRed, wBlue, wGreen;
+	u32 wCurrentInt;
+	double fRed, fBlue, fGreen, fColor;
+	u32 xLeft, xMid, xRight, xInt;
+	u32 yMid, yInt;
+	double xInc, yInc;
+	ProfMark mark, flushMark;
+
+
+	ProfBegin(&mark, "DemoPrintTest");
+	FbPolicyBegin(FB_WRITE_ONLY, NULL, 0);
+	switch (pattern)
+	{
+	case DEMO_PATTERN_0:
+
+		xInt = width / 4; //Four intervals, each with width/4 pixels
+		xLeft = xInt * 3;
+		xMid = xInt * 2 * 3;
+		xRight = xInt * 3 * 3;
+		xInc = 256.0 / ((double) xInt); //256 color intensities are cycled through per interval (overflow must be caught when color=256.0)
+
+		yInt = height / 2; //Two intervals, each with width/2 lines
+		yMid = yInt;
+		yInc = 256.0 / ((double) yInt); //256 color intensities are cycled through per interval (overflow must be caught when color=256.0)
+
+		fBlue = 0.0;
+		fRed = 256.0;
+		for(xcoi = 0; xcoi < (width*3); xcoi+=3)
+		{
+			/*
+			 * Convert color intensities to integers < 256, and trim values >=256
+			 */
+			wRed = (fRed >= 256.0) ? 255 : ((u8) fRed);
+			wBlue = (fBlue >= 256.0) ? 255 : ((u8) fBlue);
+			iPixelAddr = xcoi;
+			fGreen = 0.0;
+			for(ycoi = 0; ycoi < height; ycoi++)
+			{
+
+				wGreen = (fGreen >= 256.0) ? 255 : ((u8) fGreen);
+				frame[iPixelAddr] = wRed;
+				frame[iPixelAddr + 1] = wBlue;
+				frame[iPixelAddr + 2] = wGreen;
+				if (ycoi < yMid)
+				{
+					fGreen += yInc;
+				}
+				else
+				{
 					fGreen -= yInc;
 				}
 
@@ -576,10 +2403,12 @@ void DemoPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern)
 			}
 		}
 		/*
-		 * Flush the framebuffer memory range to ensure changes are written to the
-		 * actual memory, and therefore accessible by the VDMA.
+		 * Make the changes visible to the VDMA, flushing them if the framebuffer
+		 * mapping requires it
 		 */
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
+		ProfBegin(&flushMark, "FbPolicyEnd");
+		FbPolicyEnd(frame, DEMO_MAX_FRAME);
+		ProfEnd(&flushMark);
 		break;
 	case DEMO_PATTERN_1:
 
@@ -618,19 +2447,9 @@ void DemoPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern)
 					wGreen = 0;
 			}
 
-			iPixelAddr = xcoi;
-
-			for(ycoi = 0; ycoi < height; ycoi++)
-			{
-				frame[iPixelAddr] = wRed;
-				frame[iPixelAddr + 1] = wBlue;
-				frame[iPixelAddr + 2] = wGreen;
-				/*
-				 * This pattern is printed one vertical line at a time, so the address must be incremented
-				 * by the stride instead of just 1.
-				 */
-				iPixelAddr += stride;
-			}
+			testLine[xcoi] = wRed;
+			testLine[xcoi + 1] = wBlue;
+			testLine[xcoi + 2] = wGreen;
 
 			fColor += xInc;
 			if (fColor >= 256.0)
@@ -639,15 +2458,24 @@ void DemoPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern)
 				wCurrentInt++;
 			}
 		}
+
+		/*
+		 * Every line of this pattern is the same, so it is built once and
+		 * copied down the frame
+		 */
+		BlitCopy2D(frame, stride, testLine, 0, width * 3, height);
 		/*
-		 * Flush the framebuffer memory range to ensure changes are written to the
-		 * actual memory, and therefore accessible by the VDMA.
+		 * Make the changes visible to the VDMA, flushing them if the framebuffer
+		 * mapping requires it
 		 */
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
+		ProfBegin(&flushMark, "FbPolicyEnd");
+		FbPolicyEnd(frame, DEMO_MAX_FRAME);
+		ProfEnd(&flushMark);
 		break;
 	default :
 		xil_printf("Error: invalid pattern passed to DemoPrintTest");
 	}
+	ProfEnd(&mark);
 }
 
 void DemoISR(void *callBackRef, void *pVideo)
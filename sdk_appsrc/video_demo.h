@@ -18,6 +18,22 @@
 /*  Revision History:													*/
 /* 																		*/
 /*		11/25/2015(SamB): Created										*/
+/*		10/19/2026: Added main menu screen rows							*/
+/*		10/19/2026: Added DemoPrintProfile								*/
+/*		10/19/2026: Added DemoBenchmark									*/
+/*		10/19/2026: Added DemoVerify									*/
+/*		10/19/2026: Added DemoCRMode									*/
+/*		10/19/2026: Added DemoMemBench									*/
+/*		10/19/2026: Added DEMO_FB_MAPPING								*/
+/*		10/19/2026: Added DemoFrameJob and the band functions			*/
+/*		10/19/2026: Band functions replaced by tile functions			*/
+/*		10/19/2026: DemoFrameJob carries the OCM line buffers			*/
+/*		10/19/2026: Frame functions take a pixel format					*/
+/*		10/19/2026: Added the tiles specialized per video mode			*/
+/*		10/19/2026: Added DemoLutFrame and DemoGrade					*/
+/*		10/19/2026: Added DemoStatsFrame								*/
+/*		10/19/2026: Added DemoMotionFrame and DemoLutChanged			*/
+/*		10/19/2026: Added the on-screen display							*/
 /*																		*/
 /************************************************************************/
 
@@ -29,6 +45,14 @@
 /* ------------------------------------------------------------ */
 
 #include "xil_types.h"
+#include "display_ctrl/vga_modes.h"
+#include "amp/amp.h"
+#include "pixfmt/pixfmt.h"
+#include "tile_sched/tile_sched.h"
+#include "color_lut/color_lut.h"
+#include "frame_stats/frame_stats.h"
+#include "motion_map/motion_map.h"
+#include "osd/osd.h"
 
 /* ------------------------------------------------------------ */
 /*					Miscellaneous Declarations					*/
@@ -37,15 +61,178 @@
 #define DEMO_PATTERN_0 0
 #define DEMO_PATTERN_1 1
 
+#define DEMO_MAX_WIDTH 1920
 #define DEMO_MAX_FRAME (1920*1080*3)
 #define DEMO_STRIDE (1920 * 3)
 
+/*
+ * Size and stride of the XRGB8888 work frames
+ */
+#define DEMO_MAX_FRAME_XRGB (1920*1080*4)
+#define DEMO_STRIDE_XRGB (DEMO_MAX_WIDTH * 4)
+
+/*
+ * Format grabbed frames are inverted and scaled in at start-up. When it is
+ * not the format of the framebuffers, they are converted to it and back
+ * on the CPU.
+ */
+#define DEMO_PROC_FMT PIXFMT_RGB888
+
+/*
+ * Source lines DemoScaleTile keeps in OCM per core: the two it
+ * interpolates between
+ */
+#define DEMO_RING_LINES 2
+
+/*
+ * Resolutions, width and height, that invert and scale have tiles
+ * specialized for, one per VMODE_* in vga_modes.h. X(w, h) is expanded
+ * once per mode.
+ */
+#define DEMO_KERNEL_MODES(X) \
+	X(640, 480) \
+	X(800, 600) \
+	X(1280, 720) \
+	X(1280, 1024) \
+	X(1600, 900) \
+	X(1920, 1080)
+
 /*
  * Configure the Video capture driver to start streaming on signal
  * detection
  */
 #define DEMO_START_ON_DET 1
 
+/*
+ * Number of runs of each kernel at each resolution in DemoBenchmark
+ */
+#define DEMO_BENCH_REPS 2
+
+/*
+ * Number of passes of each memory bandwidth test at each resolution in
+ * DemoMemBench
+ */
+#define DEMO_MEMBENCH_REPS 2
+
+/*
+ * Largest channel difference DemoVerify accepts from DemoScaleFrame, which
+ * may round differently once it is optimized
+ */
+#define DEMO_VERIFY_SCALE_TOL 1
+
+/*
+ * Seconds of VDMA error history listed by DemoPrintProfile
+ */
+#define DEMO_VDMA_MON_SECONDS 16
+
+/*
+ * Framebuffer mapping used at start-up, FB_MAP_CACHED or FB_MAP_WC
+ */
+#define DEMO_FB_MAPPING FB_MAP_CACHED
+
+/*
+ * DemoGrade steps for each key press, and how often it updates the frame
+ * rate, in microseconds
+ */
+#define DEMO_GRADE_GAMMA_STEP 10
+#define DEMO_GRADE_BRIGHTNESS_STEP 8
+#define DEMO_GRADE_CONTRAST_STEP 10
+#define DEMO_GRADE_TEMP_STEP 10
+#define DEMO_GRADE_RATE_US 500000
+
+/*
+ * Lines DemoGrade samples for the statistics of the video input, and the
+ * share of the darkest and brightest pixels, in permille, auto-contrast
+ * lets clip
+ */
+#define DEMO_GRADE_STATS_STEP 4
+#define DEMO_GRADE_STRETCH_PERMILLE 5
+
+/*
+ * Fewest levels auto-contrast stretches over the full range
+ */
+#define DEMO_GRADE_STRETCH_MIN 16
+
+/*
+ * SAD of a 16x16 tile, over its channels, past which DemoGrade counts it
+ * as changed (8 levels a pixel), and how long it waits after moving
+ * capture to another frame for a whole frame to land in it (two frames at
+ * 60 Hz, as the move takes effect at the next frame start)
+ */
+#define DEMO_MOTION_THRESHOLD (16 * 16 * 8)
+#define DEMO_MOTION_SETTLE_US 34000
+
+/*
+ * On-screen display: top left corner, text color, how much the boxes
+ * darken the video (of 256), and the display width from which it is drawn
+ * at twice the size
+ */
+#define DEMO_OSD_X 16
+#define DEMO_OSD_Y 16
+#define DEMO_OSD_COLOR 0x00FFFFFF
+#define DEMO_OSD_DIM 144
+#define DEMO_OSD_WIDE 1280
+
+/*
+ * Main menu rows holding the selection prompt and status messages
+ */
+#define DEMO_UI_PROMPT_ROW 22
+#define DEMO_UI_MSG_ROW 23
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Buffers and options passed to the benchmark wrappers
+ */
+typedef struct {
+		u8 *srcFrame;
+		u8 *destFrame;
+		int pattern;
+		PixFmt fmt; /* Format of srcFrame and destFrame */
+		const ColorLut *lut; /* Tables for DemoBenchLut */
+} DemoBenchRef;
+
+/*
+ * Where a destination column of DemoScaleFrame falls in the source
+ */
+typedef struct {
+		u32 ix; /* Source pixel left of it */
+		float dist; /* Distance from that pixel, in source pixels */
+} DemoScaleCol;
+
+/*
+ * Arguments of one frame function call, shared by its tiles
+ */
+typedef struct {
+		u8 *srcFrame;
+		u8 *destFrame;
+		u32 srcWidth;
+		u32 srcHeight;
+		u32 destWidth;
+		u32 destHeight;
+		u32 stride;
+		u8 *ring[AMP_NUM_CPUS]; /* DEMO_RING_LINES lines of stride bytes in OCM per core, NULL to read the frame directly */
+		const DemoScaleCol *cols; /* destWidth columns for the scaler, NULL otherwise */
+		const ColorLut *lut; /* Tables for the LUT tiles, NULL for the scaler */
+		u32 xorMask; /* Word the invert tiles XOR each 4 bytes with */
+		FrameStats *stats[AMP_NUM_CPUS]; /* Partial statistics of each core, for the statistics tiles */
+		u32 lineStep; /* The statistics tiles count every lineStep-th line */
+		MotionMap *motion; /* Map the motion tiles fill, comparing srcFrame with the older destFrame, and DemoLutChanged reads */
+		u32 threshold; /* SAD past which a motion tile counts as changed */
+} DemoFrameJob;
+
+/*
+ * Tiles specialized for one resolution, indexed by PixFmt
+ */
+typedef struct {
+		u32 width;
+		u32 height;
+		TileSchedFn invert[2];
+		TileSchedFn scale[2];
+} DemoModeKernels;
+
 /* ------------------------------------------------------------ */
 /*					Procedure Declarations						*/
 /* ------------------------------------------------------------ */
@@ -55,9 +242,46 @@ void DemoRun();
 void DemoPrintMenu();
 void DemoChangeRes();
 void DemoCRMenu();
-void DemoInvertFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride);
+void DemoCRMode(char key, const VideoMode *mode);
+void DemoPrintProfile();
+void DemoBenchmark();
+void DemoMemBench();
+void DemoVerify();
+int DemoVerifyCheck(const char *name, const VideoMode *mode, const char *srcName, u32 tolerance, int *fDumped);
+u32 DemoBenchInvert(void *ref, u32 width, u32 height);
+u32 DemoBenchScale(void *ref, u32 width, u32 height);
+u32 DemoBenchPrintTest(void *ref, u32 width, u32 height);
+u32 DemoBenchConvert(void *ref, u32 width, u32 height);
+u32 DemoBenchLut(void *ref, u32 width, u32 height);
+u32 DemoBenchStats(void *ref, u32 width, u32 height);
+u32 DemoBenchMotion(void *ref, u32 width, u32 height);
+u32 DemoBenchOsd(void *ref, u32 width, u32 height);
+void DemoGrade();
+int DemoGradeChanged(int fFull);
+void DemoPrintStats(const FrameStats *stats, u32 row);
+void DemoOsdStatus(u32 rate10);
+void DemoOsdFrame(u8 *frame);
+void DemoProcessFrame(u32 destIndex, int fScale);
+void DemoInvertFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride, PixFmt fmt);
+void DemoLutFrame(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride, PixFmt fmt, const ColorLut *lut);
+void DemoInvertTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoInvertTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoLutTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoLutTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoStatsFrame(u8 *frame, u32 width, u32 height, u32 stride, PixFmt fmt, u32 lineStep, FrameStats *stats);
+void DemoStatsTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoStatsTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoMotionFrame(u8 *cur, u8 *prev, u32 width, u32 height, u32 stride, PixFmt fmt, u32 threshold, MotionMap *map);
+void DemoMotionTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoMotionTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoLutChanged(u8 *srcFrame, u8 *destFrame, u32 width, u32 height, u32 stride, PixFmt fmt, const ColorLut *lut, MotionMap *map);
+void DemoLutChangedTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoLutChangedTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
 void DemoPrintTest(u8 *frame, u32 width, u32 height, u32 stride, int pattern);
-void DemoScaleFrame(u8 *srcFrame, u8 *destFrame, u32 srcWidth, u32 srcHeight, u32 destWidth, u32 destHeight, u32 stride);
+void DemoScaleFrame(u8 *srcFrame, u8 *destFrame, u32 srcWidth, u32 srcHeight, u32 destWidth, u32 destHeight, u32 stride, PixFmt fmt);
+void DemoScaleTile(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+void DemoScaleTileXrgb(void *ref, u32 x0, u32 y0, u32 x1, u32 y1);
+const DemoModeKernels *DemoFindKernels(u32 width, u32 height, u32 stride, PixFmt fmt);
 void DemoISR(void *callBackRef, void *pVideo);
 
 /* ------------------------------------------------------------ */
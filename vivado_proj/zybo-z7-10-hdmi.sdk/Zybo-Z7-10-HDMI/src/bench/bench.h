@@ -0,0 +1,71 @@
+/************************************************************************/
+/*																		*/
+/*	bench.h	--	Framebuffer kernel benchmark							*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Runs framebuffer kernels at every resolution in vga_modes.h		*/
+/*		and prints their throughput and cache behavior. Each kernel is	*/
+/*		wrapped in a BenchKernel function that draws one width x height	*/
+/*		frame at the caller's stride and returns the bytes it read and	*/
+/*		wrote, so different kernels can be compared per pixel.			*/
+/*																		*/
+/*		Time comes from TimerGetUs and the counters from the prof		*/
+/*		module, so ProfInit must have been called.						*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "../prof/prof.h"
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * typedef for a benchmarked kernel. Processes one width x height frame and
+ * returns the number of bytes read and written.
+ */
+typedef u32 (*BenchKernel)(void *ref, u32 width, u32 height);
+
+typedef struct {
+		const char *name;
+		BenchKernel fn;
+		void *ref; /* Data to pass to fn */
+} BenchCase;
+
+typedef struct {
+		u32 width;
+		u32 height;
+		u32 reps;
+		u64 us; /* Total time of all repetitions */
+		u64 bytes; /* Total bytes returned by the kernel */
+		ProfCounts counts; /* Total counter increments */
+} BenchResult;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void BenchRunCase(const BenchCase *casePtr, u32 width, u32 height, u32 reps, BenchResult *resultPtr);
+void BenchPrintResult(const BenchCase *casePtr, const BenchResult *resultPtr);
+void BenchRunAll(const BenchCase *cases, u32 numCases, u32 reps);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* BENCH_H_ */
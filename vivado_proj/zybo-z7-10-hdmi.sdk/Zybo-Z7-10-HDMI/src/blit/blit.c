@@ -0,0 +1,684 @@
+/************************************************************************/
+/*																		*/
+/*	blit.c	--	Block copy and fill primitives for framebuffers			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Vector copy, set and 24-bit fill loops, the 2D wrappers			*/
+/*		around them, and their self check and benchmark. See blit.h.	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Inner loops run from OCM							*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "blit.h"
+#include "xil_mem.h"
+#include "../ocm/ocm.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+ #include <stdlib.h>
+ #include <time.h>
+ #define BLIT_PRINTF printf
+ #define BLIT_LIBC "glibc"
+#else
+ #include "../timer_ps/timer_ps.h"
+ #include "../uart_ps/uart_ps.h"
+ #define BLIT_PRINTF UartPrintf
+ #define BLIT_LIBC "newlib"
+#endif
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define BLIT_VEC 16
+
+/*
+ * Bytes in one period of the 24-bit fill pattern, the least multiple of
+ * both 3 and BLIT_VEC
+ */
+#define BLIT_PATTERN 48
+
+/*
+ * Self check sizes: the largest length tried, and the guard bytes kept
+ * around it
+ */
+#define BLIT_CHECK_MAX 300
+#define BLIT_CHECK_GUARD 32
+#define BLIT_CHECK_BUF (BLIT_CHECK_MAX + 2 * BLIT_CHECK_GUARD)
+
+/*
+ * Window moved by the 2D copy benchmark, in the frame stride
+ */
+#define BLIT_BENCH_STRIDE (1920 * 3)
+#define BLIT_BENCH_2D_W 1280
+#define BLIT_BENCH_2D_H 720
+
+/*
+ * Runs of each test in the host program
+ */
+#define BLIT_HOST_REPS 20
+
+/* ------------------------------------------------------------ */
+/*				Local Type Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * One q register. Loaded and stored with memcpy, which GCC turns into a
+ * single unaligned vector access.
+ */
+typedef u8 BlitVec __attribute__((vector_size(BLIT_VEC)));
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static u8 checkSrc[BLIT_CHECK_BUF];
+static u8 checkDst[BLIT_CHECK_BUF];
+static u8 checkRef[BLIT_CHECK_BUF];
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+static inline BlitVec BlitLoad(const u8 *src)
+{
+	BlitVec v;
+
+	memcpy(&v, src, sizeof(v));
+
+	return v;
+}
+
+static inline void BlitStore(u8 *dst, BlitVec v)
+{
+	memcpy(__builtin_assume_aligned(dst, BLIT_VEC), &v, sizeof(v));
+}
+
+/*
+ * Bytes to store one at a time before dst is on a vector boundary, at
+ * most len
+ */
+static inline u32 BlitHead(const u8 *dst, u32 len)
+{
+	u32 head = (BLIT_VEC - ((UINTPTR) dst & (BLIT_VEC - 1))) & (BLIT_VEC - 1);
+
+	return (head < len) ? head : len;
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitCopy(void *dst, const void *src, u32 len)
+**
+**	Parameters:
+**		dst - Destination, any alignment
+**		src - Source, any alignment, must not overlap dst
+**		len - Number of bytes
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		memcpy for large blocks.
+**
+*/
+OCM_TEXT void BlitCopy(void *dst, const void *src, u32 len)
+{
+	u8 *d = (u8 *) dst;
+	const u8 *s = (const u8 *) src;
+	BlitVec v0, v1, v2, v3;
+	u32 head;
+
+	for (head = BlitHead(d, len); head > 0; head--)
+	{
+		*d++ = *s++;
+		len--;
+	}
+
+	while (len >= BLIT_BLOCK)
+	{
+		__builtin_prefetch(s + BLIT_PLD_AHEAD);
+		v0 = BlitLoad(s);
+		v1 = BlitLoad(s + BLIT_VEC);
+		v2 = BlitLoad(s + 2 * BLIT_VEC);
+		v3 = BlitLoad(s + 3 * BLIT_VEC);
+		BlitStore(d, v0);
+		BlitStore(d + BLIT_VEC, v1);
+		BlitStore(d + 2 * BLIT_VEC, v2);
+		BlitStore(d + 3 * BLIT_VEC, v3);
+		s += BLIT_BLOCK;
+		d += BLIT_BLOCK;
+		len -= BLIT_BLOCK;
+	}
+	while (len >= BLIT_VEC)
+	{
+		BlitStore(d, BlitLoad(s));
+		s += BLIT_VEC;
+		d += BLIT_VEC;
+		len -= BLIT_VEC;
+	}
+	while (len > 0)
+	{
+		*d++ = *s++;
+		len--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitSet(void *dst, u8 value, u32 len)
+**
+**	Parameters:
+**		dst - Destination, any alignment
+**		value - Byte to store
+**		len - Number of bytes
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		memset for large blocks.
+**
+*/
+OCM_TEXT void BlitSet(void *dst, u8 value, u32 len)
+{
+	u8 *d = (u8 *) dst;
+	BlitVec v;
+	u32 head;
+
+	for (head = BlitHead(d, len); head > 0; head--)
+	{
+		*d++ = value;
+		len--;
+	}
+
+	memset(&v, value, sizeof(v));
+	while (len >= BLIT_BLOCK)
+	{
+		BlitStore(d, v);
+		BlitStore(d + BLIT_VEC, v);
+		BlitStore(d + 2 * BLIT_VEC, v);
+		BlitStore(d + 3 * BLIT_VEC, v);
+		d += BLIT_BLOCK;
+		len -= BLIT_BLOCK;
+	}
+	while (len >= BLIT_VEC)
+	{
+		BlitStore(d, v);
+		d += BLIT_VEC;
+		len -= BLIT_VEC;
+	}
+	while (len > 0)
+	{
+		*d++ = value;
+		len--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitCopy2D(u8 *dst, u32 dstStride, const u8 *src, u32 srcStride, u32 lineBytes, u32 lines)
+**
+**	Parameters:
+**		dst - First destination line
+**		dstStride - Bytes between destination lines
+**		src - First source line
+**		srcStride - Bytes between source lines, 0 to copy one line to
+**				every destination line
+**		lineBytes - Bytes per line
+**		lines - Number of lines
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Copies a rectangle between two strided buffers, in one block if
+**		both are contiguous.
+**
+*/
+void BlitCopy2D(u8 *dst, u32 dstStride, const u8 *src, u32 srcStride, u32 lineBytes, u32 lines)
+{
+	if (dstStride == lineBytes && srcStride == lineBytes)
+	{
+		BlitCopy(dst, src, lineBytes * lines);
+		return;
+	}
+
+	while (lines > 0)
+	{
+		BlitCopy(dst, src, lineBytes);
+		dst += dstStride;
+		src += srcStride;
+		lines--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitFill24(u8 *dst, u32 color, u32 pixels)
+**
+**	Parameters:
+**		dst - First pixel, any alignment
+**		color - Pixel value, see PixFmtFromRgb
+**		pixels - Number of 3 byte pixels
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Fills a run of 24-bit pixels with one color.
+**
+*/
+OCM_TEXT void BlitFill24(u8 *dst, u32 color, u32 pixels)
+{
+	u8 px[3];
+	u8 pattern[BLIT_PATTERN];
+	BlitVec v0, v1, v2;
+	u32 len = pixels * 3;
+	u32 phase = 0;
+	u32 head;
+	u32 i;
+
+	px[0] = (u8) color;
+	px[1] = (u8) (color >> 8);
+	px[2] = (u8) (color >> 16);
+
+	for (head = BlitHead(dst, len); head > 0; head--)
+	{
+		*dst++ = px[phase];
+		phase = (phase == 2) ? 0 : phase + 1;
+		len--;
+	}
+
+	/*
+	 * BLIT_PATTERN is a multiple of 3, so the pattern starting at the
+	 * current phase repeats exactly
+	 */
+	for (i = 0; i < BLIT_PATTERN; i++)
+	{
+		pattern[i] = px[(phase + i) % 3];
+	}
+	v0 = BlitLoad(pattern);
+	v1 = BlitLoad(pattern + BLIT_VEC);
+	v2 = BlitLoad(pattern + 2 * BLIT_VEC);
+
+	while (len >= 2 * BLIT_PATTERN)
+	{
+		BlitStore(dst, v0);
+		BlitStore(dst + BLIT_VEC, v1);
+		BlitStore(dst + 2 * BLIT_VEC, v2);
+		BlitStore(dst + 3 * BLIT_VEC, v0);
+		BlitStore(dst + 4 * BLIT_VEC, v1);
+		BlitStore(dst + 5 * BLIT_VEC, v2);
+		dst += 2 * BLIT_PATTERN;
+		len -= 2 * BLIT_PATTERN;
+	}
+	if (len >= BLIT_PATTERN)
+	{
+		BlitStore(dst, v0);
+		BlitStore(dst + BLIT_VEC, v1);
+		BlitStore(dst + 2 * BLIT_VEC, v2);
+		dst += BLIT_PATTERN;
+		len -= BLIT_PATTERN;
+	}
+	for (i = 0; i < len; i++)
+	{
+		dst[i] = pattern[i];
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitFillRect(u8 *frame, u32 stride, u32 x, u32 y, u32 width, u32 height, u32 color)
+**
+**	Parameters:
+**		frame - Framebuffer of 3 byte pixels
+**		stride - Bytes between framebuffer lines
+**		x, y - Top left pixel of the rectangle
+**		width, height - Size of the rectangle in pixels
+**		color - Pixel value, see PixFmtFromRgb
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Fills a rectangle one line at a time. The frame is only written,
+**		never read, so it suits write-combined framebuffers.
+**
+*/
+void BlitFillRect(u8 *frame, u32 stride, u32 x, u32 y, u32 width, u32 height, u32 color)
+{
+	u8 *line = frame + y * stride + x * 3;
+
+	while (height > 0)
+	{
+		BlitFill24(line, color, width);
+		line += stride;
+		height--;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Microseconds from a monotonic clock
+ */
+static u64 BlitUs(void)
+{
+#ifdef __linux__
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (u64) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+	return TimerGetUs();
+#endif
+}
+
+/*
+ * Fills checkSrc with a pattern and checkDst and checkRef with the same
+ * background
+ */
+static void BlitCheckReset(void)
+{
+	u32 i;
+
+	for (i = 0; i < BLIT_CHECK_BUF; i++)
+	{
+		checkSrc[i] = (u8) (i * 7 + 1);
+		checkDst[i] = (u8) ~i;
+		checkRef[i] = (u8) ~i;
+	}
+}
+
+/*
+ * Compares checkDst with checkRef, guard bytes included, and prints the
+ * case on a mismatch. Returns 1 on a mismatch.
+ */
+static u32 BlitCheckCompare(const char *name, u32 dstOff, u32 srcOff, u32 len)
+{
+	if (memcmp(checkDst, checkRef, BLIT_CHECK_BUF) == 0)
+	{
+		return 0;
+	}
+
+	BLIT_PRINTF("%s FAILED: dst+%lu src+%lu length %lu\n\r", name, (unsigned long) dstOff, (unsigned long) srcOff, (unsigned long) len);
+
+	return 1;
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitCheck()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of failed cases, 0 if every primitive matched
+**
+**	Errors:
+**
+**	Description:
+**		Runs every primitive against a byte loop for all 16 destination
+**		and source alignments and lengths up to past two blocks, and
+**		checks nothing outside the destination was written. Failures
+**		are printed.
+**
+*/
+u32 BlitCheck()
+{
+	static const u32 lengths[] = {0, 1, 2, 3, 15, 16, 17, 47, 48, 63, 64, 65, 95, 96, 97, 127, 128, 129, 191, 200, 257};
+	u32 failures = 0;
+	u32 dstOff, srcOff, n, i, len;
+	u8 *d, *r;
+	const u8 *s;
+
+	for (dstOff = 0; dstOff < BLIT_VEC; dstOff++)
+	{
+		for (n = 0; n < sizeof(lengths) / sizeof(lengths[0]); n++)
+		{
+			len = lengths[n];
+			d = checkDst + BLIT_CHECK_GUARD + dstOff;
+			r = checkRef + BLIT_CHECK_GUARD + dstOff;
+
+			for (srcOff = 0; srcOff < BLIT_VEC; srcOff++)
+			{
+				s = checkSrc + BLIT_CHECK_GUARD + srcOff;
+				BlitCheckReset();
+				BlitCopy(d, s, len);
+				for (i = 0; i < len; i++)
+				{
+					r[i] = s[i];
+				}
+				failures += BlitCheckCompare("BlitCopy", dstOff, srcOff, len);
+			}
+
+			BlitCheckReset();
+			BlitSet(d, 0x5A, len);
+			for (i = 0; i < len; i++)
+			{
+				r[i] = 0x5A;
+			}
+			failures += BlitCheckCompare("BlitSet", dstOff, 0, len);
+
+			/*
+			 * Lengths are in pixels here, kept inside the buffer
+			 */
+			BlitCheckReset();
+			BlitFill24(d, 0x123456, len * 3 > BLIT_CHECK_MAX ? BLIT_CHECK_MAX / 3 : len);
+			for (i = 0; i < (len * 3 > BLIT_CHECK_MAX ? BLIT_CHECK_MAX : len * 3); i += 3)
+			{
+				r[i] = 0x56;
+				r[i + 1] = 0x34;
+				r[i + 2] = 0x12;
+			}
+			failures += BlitCheckCompare("BlitFill24", dstOff, 0, len);
+		}
+	}
+
+	/*
+	 * A 5 line rectangle, strided and with a repeated source line
+	 */
+	for (srcOff = 0; srcOff < 2; srcOff++)
+	{
+		BlitCheckReset();
+		d = checkDst + BLIT_CHECK_GUARD + 3;
+		r = checkRef + BLIT_CHECK_GUARD + 3;
+		s = checkSrc + BLIT_CHECK_GUARD;
+		BlitCopy2D(d, 50, s, srcOff ? 0 : 37, 21, 5);
+		for (n = 0; n < 5; n++)
+		{
+			for (i = 0; i < 21; i++)
+			{
+				r[n * 50 + i] = s[(srcOff ? 0 : n * 37) + i];
+			}
+		}
+		failures += BlitCheckCompare("BlitCopy2D", 3, srcOff ? 0 : 37, 21);
+	}
+
+	BlitCheckReset();
+	BlitFillRect(checkDst + BLIT_CHECK_GUARD, 60, 3, 1, 17, 4, 0xABCDEF);
+	for (n = 1; n < 5; n++)
+	{
+		for (i = 3 * 3; i < 20 * 3; i += 3)
+		{
+			r = checkRef + BLIT_CHECK_GUARD + n * 60 + i;
+			r[0] = 0xEF;
+			r[1] = 0xCD;
+			r[2] = 0xAB;
+		}
+	}
+	failures += BlitCheckCompare("BlitFillRect", 0, 0, 17);
+
+	return failures;
+}
+/* ------------------------------------------------------------ */
+
+/*
+ * Plain 24-bit fill, the baseline for BlitFill24
+ */
+static void BlitBenchFillLoop(u8 *dst, u32 color, u32 pixels)
+{
+	u32 i;
+
+	for (i = 0; i < pixels; i++)
+	{
+		dst[0] = (u8) color;
+		dst[1] = (u8) (color >> 8);
+		dst[2] = (u8) (color >> 16);
+		dst += 3;
+	}
+}
+
+/*
+ * Prints one result as bytes read plus written per microsecond
+ */
+static void BlitBenchPrint(const char *test, const char *code, u64 bytes, u64 us)
+{
+	BLIT_PRINTF("%-24s %-14s %8lu\n\r", test, code, (unsigned long) (bytes / (us ? us : 1)));
+}
+/* ------------------------------------------------------------ */
+
+/***	BlitBenchRunAll(u8 *src, u8 *dst, u32 reps)
+**
+**	Parameters:
+**		src - Source buffer, at least BLIT_BENCH_SIZE bytes
+**		dst - Destination buffer, at least BLIT_BENCH_SIZE bytes
+**		reps - Number of passes per test
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Runs BlitCheck, then prints the throughput in MB/s of every
+**		primitive next to the code it replaces: Xil_MemCpy and the C
+**		library for copies, the C library for set, and plain loops for
+**		the 24-bit fill and the 2D copy. Copies are timed with both
+**		buffers aligned and with the destination one byte off. The
+**		contents of both buffers are overwritten.
+**
+*/
+void BlitBenchRunAll(u8 *src, u8 *dst, u32 reps)
+{
+	u32 failures;
+	u32 size = BLIT_BENCH_SIZE - BLIT_VEC;
+	u32 off;
+	u32 r, y;
+	u64 start;
+	u64 copied;
+	char test[24];
+
+	failures = BlitCheck();
+	BLIT_PRINTF("Self check: %lu failure(s)\n\r\n\r", (unsigned long) failures);
+	BLIT_PRINTF("%-24s %-14s %8s\n\r", "Test", "Code", "MB/s");
+
+	for (off = 0; off <= 1; off++)
+	{
+		snprintf(test, sizeof(test), "copy, dst+%lu", (unsigned long) off);
+		copied = (u64) 2 * size * reps;
+
+		start = BlitUs();
+		for (r = 0; r < reps; r++)
+		{
+			Xil_MemCpy(dst + off, src, size);
+		}
+		BlitBenchPrint(test, "Xil_MemCpy", copied, BlitUs() - start);
+
+		start = BlitUs();
+		for (r = 0; r < reps; r++)
+		{
+			memcpy(dst + off, src, size);
+		}
+		BlitBenchPrint(test, BLIT_LIBC, copied, BlitUs() - start);
+
+		start = BlitUs();
+		for (r = 0; r < reps; r++)
+		{
+			BlitCopy(dst + off, src, size);
+		}
+		BlitBenchPrint(test, "BlitCopy", copied, BlitUs() - start);
+	}
+
+	start = BlitUs();
+	for (r = 0; r < reps; r++)
+	{
+		memset(dst, r, size);
+	}
+	BlitBenchPrint("set", BLIT_LIBC, (u64) size * reps, BlitUs() - start);
+
+	start = BlitUs();
+	for (r = 0; r < reps; r++)
+	{
+		BlitSet(dst, r, size);
+	}
+	BlitBenchPrint("set", "BlitSet", (u64) size * reps, BlitUs() - start);
+
+	start = BlitUs();
+	for (r = 0; r < reps; r++)
+	{
+		BlitBenchFillLoop(dst, 0x102030 + r, size / 3);
+	}
+	BlitBenchPrint("24-bit fill", "pixel loop", (u64) (size / 3 * 3) * reps, BlitUs() - start);
+
+	start = BlitUs();
+	for (r = 0; r < reps; r++)
+	{
+		BlitFill24(dst, 0x102030 + r, size / 3);
+	}
+	BlitBenchPrint("24-bit fill", "BlitFill24", (u64) (size / 3 * 3) * reps, BlitUs() - start);
+
+	snprintf(test, sizeof(test), "2D copy %ux%u", BLIT_BENCH_2D_W, BLIT_BENCH_2D_H);
+	copied = (u64) 2 * BLIT_BENCH_2D_W * 3 * BLIT_BENCH_2D_H * reps;
+
+	start = BlitUs();
+	for (r = 0; r < reps; r++)
+	{
+		for (y = 0; y < BLIT_BENCH_2D_H; y++)
+		{
+			memcpy(dst + y * BLIT_BENCH_STRIDE + 3, src + y * BLIT_BENCH_STRIDE, BLIT_BENCH_2D_W * 3);
+		}
+	}
+	BlitBenchPrint(test, "line memcpy", copied, BlitUs() - start);
+
+	start = BlitUs();
+	for (r = 0; r < reps; r++)
+	{
+		BlitCopy2D(dst + 3, BLIT_BENCH_STRIDE, src, BLIT_BENCH_STRIDE, BLIT_BENCH_2D_W * 3, BLIT_BENCH_2D_H);
+	}
+	BlitBenchPrint(test, "BlitCopy2D", copied, BlitUs() - start);
+}
+
+#if defined(__linux__) && defined(BLIT_MAIN)
+int main(void)
+{
+	u8 *bufs;
+
+	if (posix_memalign((void **) &bufs, 64, 2 * BLIT_BENCH_SIZE) != 0)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+
+	/*
+	 * Touch every page so the first test does not time page faults
+	 */
+	memset(bufs, 0, 2 * BLIT_BENCH_SIZE);
+	BlitBenchRunAll(bufs, bufs + BLIT_BENCH_SIZE, BLIT_HOST_REPS);
+	free(bufs);
+
+	return BlitCheck() ? 1 : 0;
+}
+#endif
+
+/************************************************************************/
@@ -0,0 +1,86 @@
+/************************************************************************/
+/*																		*/
+/*	blit.h	--	Block copy and fill primitives for framebuffers			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Copy, set, strided 2D copy, 24-bit pattern fill and rectangle	*/
+/*		fill, for the code that moves whole lines of framebuffer		*/
+/*		memory. Xil_MemCpy moves 4 bytes per iteration and the C		*/
+/*		library has nothing for 3 byte pixels or strides.				*/
+/*																		*/
+/*		The inner loops move 64 bytes per iteration as four 16 byte		*/
+/*		vectors, with a PLD BLIT_PLD_AHEAD bytes ahead of the source.	*/
+/*		They use GCC vector types, which become NEON q register			*/
+/*		loads and stores with -mfpu=neon and SSE on a host, so the		*/
+/*		host program below runs the same code. Each call first			*/
+/*		steps the destination to a 16 byte boundary a byte at a time,	*/
+/*		so no store crosses a cache line; the source may have any		*/
+/*		alignment. Copy, set and the 24-bit fill are OCM_TEXT, so they	*/
+/*		fetch no instructions from DDR.									*/
+/*																		*/
+/*		24-bit fills store a 48 byte pattern, 16 pixels, rotated to		*/
+/*		the byte the aligned part starts on. A pixel holds color,		*/
+/*		color >> 8 and color >> 16 in memory order, so color is a		*/
+/*		pixel value as PixFmtFromRgb makes from a 0xRRGGBB color.		*/
+/*																		*/
+/*		BlitBenchRunAll checks every primitive against a plain byte		*/
+/*		loop over many alignments and lengths, then times them against	*/
+/*		Xil_MemCpy, the C library and plain loops over one 1920x1080	*/
+/*		frame. With BLIT_MAIN defined on Linux the module builds as a	*/
+/*		stand-alone host program:										*/
+/*			gcc -O2 -DBLIT_MAIN -I<bsp>/include -I. blit/blit.c			*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_mem.c -o blit		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Inner loops run from OCM							*/
+/*																		*/
+/************************************************************************/
+
+#ifndef BLIT_H_
+#define BLIT_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Bytes moved per inner loop iteration, and how far ahead of the source
+ * it prefetches
+ */
+#define BLIT_BLOCK 64
+#define BLIT_PLD_AHEAD 256
+
+/*
+ * Bytes in one 1920x1080 frame, the least each buffer passed to
+ * BlitBenchRunAll must hold
+ */
+#define BLIT_BENCH_SIZE (1920 * 3 * 1080)
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void BlitCopy(void *dst, const void *src, u32 len);
+void BlitSet(void *dst, u8 value, u32 len);
+void BlitCopy2D(u8 *dst, u32 dstStride, const u8 *src, u32 srcStride, u32 lineBytes, u32 lines);
+void BlitFill24(u8 *dst, u32 color, u32 pixels);
+void BlitFillRect(u8 *frame, u32 stride, u32 x, u32 y, u32 width, u32 height, u32 color);
+u32 BlitCheck();
+void BlitBenchRunAll(u8 *src, u8 *dst, u32 reps);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* BLIT_H_ */
@@ -0,0 +1,305 @@
+/************************************************************************/
+/*																		*/
+/*	bw_budget.c	--	Memory bandwidth budget for the video pipeline		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Adds up VDMA and CPU memory traffic and checks it against the	*/
+/*		HP0 port and DDR budgets. See bw_budget.h.						*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Prints to stdout when built for Linux				*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "bw_budget.h"
+#include <stddef.h>
+
+#ifdef __linux__
+ #include <stdio.h>
+ #define BW_PRINTF printf
+#else
+ #include "../uart_ps/uart_ps.h"
+ #define BW_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static BwStage stages[BW_MAX_STAGES];
+static u64 hpBudget = BW_HP_PEAK_BPS * BW_DEFAULT_HP_PCT / 100;
+static u64 ddrBudget = BW_DDR_PEAK_BPS * BW_DEFAULT_DDR_PCT / 100;
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	BwInit()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Description:
+**		Removes every stage and restores the default budgets.
+**
+*/
+void BwInit()
+{
+	int i;
+
+	for (i = 0; i < BW_MAX_STAGES; i++)
+	{
+		stages[i].name = NULL;
+		stages[i].bytesPerSec = 0;
+	}
+	hpBudget = BW_HP_PEAK_BPS * BW_DEFAULT_HP_PCT / 100;
+	ddrBudget = BW_DDR_PEAK_BPS * BW_DEFAULT_DDR_PCT / 100;
+}
+/* ------------------------------------------------------------ */
+
+/***	BwSetBudget(u64 hp, u64 ddr)
+**
+**	Parameters:
+**		hp - Bytes per second the VDMA can move through HP0
+**		ddr - Bytes per second DDR sustains for all masters together
+**
+**	Return Value:
+**
+**	Description:
+**		Replaces the budgets, normally with measured figures. A value
+**		of 0 leaves that budget unchanged.
+**
+*/
+void BwSetBudget(u64 hp, u64 ddr)
+{
+	if (hp != 0)
+	{
+		hpBudget = hp;
+	}
+	if (ddr != 0)
+	{
+		ddrBudget = ddr;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BwAddStage(const char *name, u64 bytesPerSec)
+**
+**	Parameters:
+**		name - Name shown by BwPrintReport. Must remain valid, normally
+**				a string literal.
+**		bytesPerSec - Bytes read plus bytes written per second
+**
+**	Return Value: int
+**		Stage handle for BwRemoveStage, or -1 if all slots are in use
+**
+**	Description:
+**		Registers CPU work that runs continuously alongside the VDMA,
+**		such as a per-frame processing loop.
+**
+*/
+int BwAddStage(const char *name, u64 bytesPerSec)
+{
+	int i;
+
+	for (i = 0; i < BW_MAX_STAGES; i++)
+	{
+		if (stages[i].name == NULL)
+		{
+			stages[i].name = name;
+			stages[i].bytesPerSec = bytesPerSec;
+			return i;
+		}
+	}
+
+	return -1;
+}
+/* ------------------------------------------------------------ */
+
+/***	BwRemoveStage(int stage)
+**
+**	Parameters:
+**		stage - Handle returned by BwAddStage. -1 is ignored.
+**
+**	Return Value:
+**
+**	Description:
+**		Frees a stage registered with BwAddStage.
+**
+*/
+void BwRemoveStage(int stage)
+{
+	if (stage >= 0 && stage < BW_MAX_STAGES)
+	{
+		stages[stage].name = NULL;
+		stages[stage].bytesPerSec = 0;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	BwDisplayDemand(const VideoMode *mode)
+**
+**	Parameters:
+**		mode - Display mode
+**
+**	Return Value: u64
+**		Bytes per second MM2S reads while lines are active
+**
+**	Description:
+**		One line of active pixels is fetched per line period of the
+**		mode (hmax + 1 pixel clocks).
+**
+*/
+u64 BwDisplayDemand(const VideoMode *mode)
+{
+	double lineRate;
+
+	lineRate = mode->freq * 1000000.0 / (mode->hmax + 1);
+
+	return (u64) (lineRate * mode->width * BW_BYTES_PER_PIXEL);
+}
+/* ------------------------------------------------------------ */
+
+/***	BwCaptureDemand(const VideoCapture *videoPtr)
+**
+**	Parameters:
+**		videoPtr - Capture device, or NULL
+**
+**	Return Value: u64
+**		Bytes per second S2MM writes while lines are active, 0 if the
+**		capture is not streaming
+**
+**	Description:
+**		Uses the detected input timing at BW_CAPTURE_FPS frames per
+**		second.
+**
+*/
+u64 BwCaptureDemand(const VideoCapture *videoPtr)
+{
+	const XVtc_Timing *t;
+	u64 lineRate;
+
+	if (videoPtr == NULL || videoPtr->state != VIDEO_STREAMING)
+	{
+		return 0;
+	}
+
+	t = &videoPtr->timing;
+	lineRate = (u64) (t->VActiveVideo + t->V0FrontPorch + t->V0SyncWidth + t->V0BackPorch) * BW_CAPTURE_FPS;
+
+	return lineRate * t->HActiveVideo * BW_BYTES_PER_PIXEL;
+}
+/* ------------------------------------------------------------ */
+
+/***	BwEvaluate(const VideoMode *mode, const VideoCapture *videoPtr, BwReport *reportPtr)
+**
+**	Parameters:
+**		mode - Display mode to check, current or planned
+**		videoPtr - Capture device, or NULL to leave capture out
+**		reportPtr - Receives the breakdown, may be NULL
+**
+**	Return Value: BwStatus
+**		BW_OK if both loads are under BW_WARN_PCT of their budgets,
+**		BW_WARN if either is above that but within budget, BW_REFUSE if
+**		either budget is exceeded
+**
+**	Description:
+**		Adds the display, capture and stage demands and compares them
+**		with the HP0 and DDR budgets.
+**
+*/
+BwStatus BwEvaluate(const VideoMode *mode, const VideoCapture *videoPtr, BwReport *reportPtr)
+{
+	BwReport report;
+	int i;
+
+	report.displayBps = BwDisplayDemand(mode);
+	report.captureBps = BwCaptureDemand(videoPtr);
+	report.stageBps = 0;
+	for (i = 0; i < BW_MAX_STAGES; i++)
+	{
+		if (stages[i].name != NULL)
+		{
+			report.stageBps += stages[i].bytesPerSec;
+		}
+	}
+
+	report.hpBps = report.displayBps + report.captureBps;
+	report.ddrBps = report.hpBps + report.stageBps;
+	report.hpBudget = hpBudget;
+	report.ddrBudget = ddrBudget;
+	report.hpHeadroom = (s64) hpBudget - (s64) report.hpBps;
+	report.ddrHeadroom = (s64) ddrBudget - (s64) report.ddrBps;
+	report.hpPct = (u32) (report.hpBps * 100 / hpBudget);
+	report.ddrPct = (u32) (report.ddrBps * 100 / ddrBudget);
+
+	if (report.hpHeadroom < 0 || report.ddrHeadroom < 0)
+	{
+		report.status = BW_REFUSE;
+	}
+	else if (report.hpPct > BW_WARN_PCT || report.ddrPct > BW_WARN_PCT)
+	{
+		report.status = BW_WARN;
+	}
+	else
+	{
+		report.status = BW_OK;
+	}
+
+	if (reportPtr != NULL)
+	{
+		*reportPtr = report;
+	}
+
+	return report.status;
+}
+/* ------------------------------------------------------------ */
+
+/***	BwPrintReport(const BwReport *reportPtr)
+**
+**	Parameters:
+**		reportPtr - Report filled in by BwEvaluate
+**
+**	Return Value:
+**
+**	Description:
+**		Prints the demand of each part and the load on both budgets, in
+**		MB/s.
+**
+*/
+void BwPrintReport(const BwReport *reportPtr)
+{
+	int i;
+
+	BW_PRINTF("%-20s %10s\n\r", "Consumer", "MB/s");
+	BW_PRINTF("%-20s %10llu\n\r", "Display (MM2S)", (unsigned long long) (reportPtr->displayBps / 1000000));
+	BW_PRINTF("%-20s %10llu\n\r", "Capture (S2MM)", (unsigned long long) (reportPtr->captureBps / 1000000));
+	for (i = 0; i < BW_MAX_STAGES; i++)
+	{
+		if (stages[i].name != NULL)
+		{
+			BW_PRINTF("%-20.20s %10llu\n\r", stages[i].name, (unsigned long long) (stages[i].bytesPerSec / 1000000));
+		}
+	}
+	BW_PRINTF("\n\r%-20s %10s %10s %6s\n\r", "Limit", "Load", "Budget", "Used");
+	BW_PRINTF("%-20s %10llu %10llu %5lu%%\n\r", "HP0 port",
+			(unsigned long long) (reportPtr->hpBps / 1000000),
+			(unsigned long long) (reportPtr->hpBudget / 1000000),
+			(unsigned long) reportPtr->hpPct);
+	BW_PRINTF("%-20s %10llu %10llu %5lu%%\n\r", "DDR",
+			(unsigned long long) (reportPtr->ddrBps / 1000000),
+			(unsigned long long) (reportPtr->ddrBudget / 1000000),
+			(unsigned long) reportPtr->ddrPct);
+}
+
+/************************************************************************/
@@ -0,0 +1,244 @@
+/************************************************************************/
+/*																		*/
+/*	fb_policy.c	--	Framebuffer memory attributes and cache upkeep		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Remaps the framebuffer sections cached or write-combined and	*/
+/*		flushes only what the current mapping requires. See				*/
+/*		fb_policy.h.													*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "fb_policy.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#include "xil_mmu.h"
+#include "xil_io.h"
+#include "xl2cc.h"
+#include "xparameters_ps.h"
+#include "xpseudo_asm.h"
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Whole sections of the framebuffer region, [mapStart, mapEnd). Empty
+ * until FbPolicyInit, so every range is treated as cached.
+ */
+static UINTPTR mapStart = 0;
+static UINTPTR mapEnd = 0;
+static FbMapping curMapping = FB_MAP_CACHED;
+
+static const char *mappingNames[] = {"cached", "write-combined"};
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Flushes the parts of [addr, addr + len) that are cached under the current
+ * mapping
+ */
+static void FbPolicyFlushCached(const u8 *addr, u32 len)
+{
+	UINTPTR start = (UINTPTR) addr;
+	UINTPTR end = start + len;
+
+	if (len == 0)
+	{
+		return;
+	}
+	if (curMapping != FB_MAP_WC || end <= mapStart || start >= mapEnd)
+	{
+		Xil_DCacheFlushRange(start, len);
+		return;
+	}
+
+	if (start < mapStart)
+	{
+		Xil_DCacheFlushRange(start, mapStart - start);
+	}
+	if (end > mapEnd)
+	{
+		Xil_DCacheFlushRange(mapEnd, end - mapEnd);
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	FbPolicyInit(u8 *base, u32 size, FbMapping mapping)
+**
+**	Parameters:
+**		base - Start of the framebuffers, ideally FB_POLICY_SECTION
+**				aligned
+**		size - Bytes in all framebuffers together
+**		mapping - Initial mapping
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_INVALID_PARAM if the region holds no whole section
+**
+**	Description:
+**		Records which sections belong to the framebuffers and maps them.
+**		Sections only partly inside the region are never remapped, since
+**		they are shared with other data.
+**
+*/
+int FbPolicyInit(u8 *base, u32 size, FbMapping mapping)
+{
+	UINTPTR start;
+	UINTPTR end;
+
+	start = ((UINTPTR) base + FB_POLICY_SECTION - 1) & ~(FB_POLICY_SECTION - 1);
+	end = ((UINTPTR) base + size) & ~(FB_POLICY_SECTION - 1);
+	if (end <= start)
+	{
+		return XST_INVALID_PARAM;
+	}
+
+	/*
+	 * Put back the default mapping of the old region before taking the new
+	 * one
+	 */
+	FbPolicySetMapping(FB_MAP_CACHED);
+	mapStart = start;
+	mapEnd = end;
+
+	return FbPolicySetMapping(mapping);
+}
+/* ------------------------------------------------------------ */
+
+/***	FbPolicySetMapping(FbMapping mapping)
+**
+**	Parameters:
+**		mapping - FB_MAP_CACHED or FB_MAP_WC
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_INVALID_PARAM if mapping is not a known value
+**
+**	Description:
+**		Rewrites the section entries of the framebuffers. The data cache
+**		is flushed first, so no dirty line from the cached mapping can be
+**		written back over later uncached stores. Xil_SetTlbAttributes
+**		flushes the whole data cache for every section, so this takes
+**		milliseconds and is meant for mode changes, not per frame use.
+**		Calling it again with the current mapping restores the table
+**		after something else, such as membench, changed it.
+**
+*/
+int FbPolicySetMapping(FbMapping mapping)
+{
+	UINTPTR addr;
+
+	if (mapping != FB_MAP_CACHED && mapping != FB_MAP_WC)
+	{
+		return XST_INVALID_PARAM;
+	}
+
+	Xil_DCacheFlush();
+	for (addr = mapStart; addr < mapEnd; addr += FB_POLICY_SECTION)
+	{
+		Xil_SetTlbAttributes(addr, (mapping == FB_MAP_WC) ? NORM_NONCACHE : NORM_WB_CACHE);
+	}
+	curMapping = mapping;
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	FbPolicyGetMapping()
+**
+**	Parameters:
+**
+**	Return Value: FbMapping
+**		Current mapping of the framebuffers
+**
+**	Description:
+**
+*/
+FbMapping FbPolicyGetMapping()
+{
+	return curMapping;
+}
+/* ------------------------------------------------------------ */
+
+/***	FbPolicyName(FbMapping mapping)
+**
+**	Parameters:
+**		mapping - Mapping to name
+**
+**	Return Value: const char *
+**		Lower case name of the mapping, for menus
+**
+**	Description:
+**
+*/
+const char *FbPolicyName(FbMapping mapping)
+{
+	return (mapping == FB_MAP_WC) ? mappingNames[FB_MAP_WC] : mappingNames[FB_MAP_CACHED];
+}
+/* ------------------------------------------------------------ */
+
+/***	FbPolicyBegin(FbAccess access, const u8 *src, u32 len)
+**
+**	Parameters:
+**		access - What the kernel does with frame memory
+**		src - Frame the kernel reads, ignored for FB_WRITE_ONLY
+**		len - Bytes of src the kernel reads
+**
+**	Return Value:
+**
+**	Description:
+**		Called by a kernel before it touches a frame. A read-modify-write
+**		kernel gets the cached parts of its source flushed, so it reads
+**		what the VDMA or another kernel last wrote rather than stale
+**		lines. A write-only kernel needs nothing.
+**
+*/
+void FbPolicyBegin(FbAccess access, const u8 *src, u32 len)
+{
+	if (access == FB_READ_MODIFY_WRITE)
+	{
+		FbPolicyFlushCached(src, len);
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	FbPolicyEnd(const u8 *dst, u32 len)
+**
+**	Parameters:
+**		dst - Start of the bytes the kernel wrote
+**		len - Number of bytes written
+**
+**	Return Value:
+**
+**	Description:
+**		Makes the written bytes visible to the VDMA. Cached parts are
+**		flushed. Write-combined stores are drained with a barrier and an
+**		L2 cache sync, which empties the store buffer of the L2
+**		controller the uncached writes pass through.
+**
+*/
+void FbPolicyEnd(const u8 *dst, u32 len)
+{
+	FbPolicyFlushCached(dst, len);
+	if (curMapping == FB_MAP_WC)
+	{
+		dsb();
+		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_SYNC_OFFSET, 0x0U);
+	}
+}
+
+/************************************************************************/
@@ -0,0 +1,100 @@
+/************************************************************************/
+/*																		*/
+/*	fb_policy.h	--	Framebuffer memory attributes and cache upkeep		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Chooses how the framebuffers are mapped in the MMU table and	*/
+/*		does the cache maintenance the frame kernels need under that	*/
+/*		mapping, so the kernels no longer call Xil_DCacheFlushRange		*/
+/*		themselves.														*/
+/*																		*/
+/*		FB_MAP_CACHED keeps the framebuffers normal write-back cached.	*/
+/*		CPU reads are fast, but every frame written must be flushed		*/
+/*		before the VDMA sees it, and a frame written by the VDMA must	*/
+/*		be flushed before the CPU reads it. FB_MAP_WC maps them normal	*/
+/*		non-cacheable, which the store buffers turn into write-		*/
+/*		combining: writes need no maintenance at all, but every read	*/
+/*		goes to DDR.													*/
+/*																		*/
+/*		Each kernel declares its access with FbPolicyBegin:				*/
+/*		- FB_WRITE_ONLY kernels only store to the frame (fills, test	*/
+/*		  patterns). They need no maintenance before they start.		*/
+/*		- FB_READ_MODIFY_WRITE kernels read a frame (invert, scale).	*/
+/*		  Under FB_MAP_CACHED their source is flushed first, so stale	*/
+/*		  lines are not read in place of what the VDMA wrote.			*/
+/*		FbPolicyEnd then publishes the written range: a flush under		*/
+/*		FB_MAP_CACHED, only a barrier under FB_MAP_WC. Write-only		*/
+/*		producers under FB_MAP_WC therefore skip cache maintenance		*/
+/*		entirely, while read-modify-write kernels usually run faster	*/
+/*		under FB_MAP_CACHED (see membench).								*/
+/*																		*/
+/*		The MMU maps DDR in 1MB sections, so only the sections that		*/
+/*		lie wholly inside the framebuffer region are remapped; align	*/
+/*		the region to FB_POLICY_SECTION to lose nothing at the start.	*/
+/*		Bytes outside the remapped sections, including buffers that		*/
+/*		are not framebuffers at all, stay cached and are always			*/
+/*		flushed, so the kernels can pass any buffer.					*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call FbPolicyInit with the framebuffer region.				*/
+/*		2) In each kernel, call FbPolicyBegin before touching a frame	*/
+/*		   and FbPolicyEnd once the frame is written.					*/
+/*		3) Switch mappings at any time with FbPolicySetMapping.			*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef FB_POLICY_H_
+#define FB_POLICY_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Size of one MMU section, the granule mappings are switched in
+ */
+#define FB_POLICY_SECTION 0x100000
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef enum {
+	FB_MAP_CACHED = 0, /* Normal write-back cached */
+	FB_MAP_WC = 1 /* Normal non-cacheable, write-combined */
+} FbMapping;
+
+typedef enum {
+	FB_WRITE_ONLY = 0, /* Stores every byte it produces, never reads a frame */
+	FB_READ_MODIFY_WRITE = 1 /* Reads a frame, possibly the one it writes */
+} FbAccess;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int FbPolicyInit(u8 *base, u32 size, FbMapping mapping);
+int FbPolicySetMapping(FbMapping mapping);
+FbMapping FbPolicyGetMapping();
+const char *FbPolicyName(FbMapping mapping);
+void FbPolicyBegin(FbAccess access, const u8 *src, u32 len);
+void FbPolicyEnd(const u8 *dst, u32 len);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* FB_POLICY_H_ */
@@ -0,0 +1,236 @@
+/************************************************************************/
+/*																		*/
+/*	frame_sched.c	--	Frame-tick event scheduler						*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Schedules callbacks a whole number of display frames in the		*/
+/*		future. FrameSchedTick is attached to the display frame			*/
+/*		interrupt (see DisplaySetFrameCallback) and only counts frames.	*/
+/*		Due events are run from the main loop by FrameSchedPoll, so		*/
+/*		they may draw into framebuffers and flush the cache, and the	*/
+/*		main loop is free to do other work between frames.				*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "frame_sched.h"
+#include "../timer_ps/timer_ps.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include <stddef.h>
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedInit(FrameSched *schedPtr)
+**
+**	Parameters:
+**		schedPtr - Pointer to the struct that will be initialized
+**
+**	Return Value:
+**
+**	Description:
+**		Resets the frame count and frees every event slot.
+**
+*/
+void FrameSchedInit(FrameSched *schedPtr)
+{
+	int i;
+
+	schedPtr->frameCount = 0;
+	schedPtr->lastPoll = 0;
+	for (i = 0; i < FRAME_SCHED_MAX_EVENTS; i++)
+	{
+		schedPtr->events[i].fn = NULL;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedTick(void *callBackRef, void *pDisplay)
+**
+**	Parameters:
+**		callBackRef - Pointer to the FrameSched struct
+**		pDisplay - Pointer to the DisplayCtrl struct (unused)
+**
+**	Return Value:
+**
+**	Description:
+**		Display frame callback. Runs in interrupt context and only
+**		advances the frame count.
+**
+*/
+void FrameSchedTick(void *callBackRef, void *pDisplay)
+{
+	FrameSched *schedPtr = (FrameSched *) callBackRef;
+
+	schedPtr->frameCount++;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedNow(FrameSched *schedPtr)
+**
+**	Parameters:
+**		schedPtr - Pointer to the initialized FrameSched struct
+**
+**	Return Value: u32
+**		Number of frames counted so far
+**
+*/
+u32 FrameSchedNow(FrameSched *schedPtr)
+{
+	return schedPtr->frameCount;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedAt(FrameSched *schedPtr, u32 frame, FrameEventFn fn, void *ref)
+**
+**	Parameters:
+**		schedPtr - Pointer to the initialized FrameSched struct
+**		frame - Frame count at which fn should run
+**		fn - Event function
+**		ref - Data to pass to fn
+**
+**	Return Value: int
+**		Handle of the event, or -1 if all event slots are in use
+**
+**	Description:
+**		Schedules fn to be run by the first FrameSchedPoll call made on
+**		or after the given frame. A frame that has already passed runs
+**		on the next poll.
+**
+*/
+int FrameSchedAt(FrameSched *schedPtr, u32 frame, FrameEventFn fn, void *ref)
+{
+	int i;
+
+	for (i = 0; i < FRAME_SCHED_MAX_EVENTS; i++)
+	{
+		if (schedPtr->events[i].fn == NULL)
+		{
+			schedPtr->events[i].due = frame;
+			schedPtr->events[i].ref = ref;
+			schedPtr->events[i].fn = fn;
+			return i;
+		}
+	}
+
+	return -1;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedAfter(FrameSched *schedPtr, u32 frames, FrameEventFn fn, void *ref)
+**
+**	Description:
+**		Same as FrameSchedAt, relative to the current frame count.
+**
+*/
+int FrameSchedAfter(FrameSched *schedPtr, u32 frames, FrameEventFn fn, void *ref)
+{
+	return FrameSchedAt(schedPtr, schedPtr->frameCount + frames, fn, ref);
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedCancel(FrameSched *schedPtr, int handle)
+**
+**	Parameters:
+**		schedPtr - Pointer to the initialized FrameSched struct
+**		handle - Handle returned by FrameSchedAt/FrameSchedAfter
+**
+**	Return Value:
+**
+**	Description:
+**		Removes an event that has not run yet.
+**
+*/
+void FrameSchedCancel(FrameSched *schedPtr, int handle)
+{
+	if (handle >= 0 && handle < FRAME_SCHED_MAX_EVENTS)
+	{
+		schedPtr->events[handle].fn = NULL;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedPoll(FrameSched *schedPtr)
+**
+**	Parameters:
+**		schedPtr - Pointer to the initialized FrameSched struct
+**
+**	Return Value: int
+**		Number of events that were run
+**
+**	Description:
+**		Runs every event that is due. The slot is freed before the event
+**		function is called, so events may schedule follow-up events.
+**
+*/
+int FrameSchedPoll(FrameSched *schedPtr)
+{
+	int i;
+	int ran = 0;
+	u32 now;
+	FrameEventFn fn;
+	void *ref;
+
+	now = schedPtr->frameCount;
+	schedPtr->lastPoll = now;
+	for (i = 0; i < FRAME_SCHED_MAX_EVENTS; i++)
+	{
+		fn = schedPtr->events[i].fn;
+		/*
+		 * Signed difference so that the comparison survives the frame
+		 * counter wrapping
+		 */
+		if (fn != NULL && (s32) (now - schedPtr->events[i].due) >= 0)
+		{
+			ref = schedPtr->events[i].ref;
+			schedPtr->events[i].fn = NULL;
+			fn(ref, now);
+			ran++;
+		}
+	}
+
+	return ran;
+}
+/* ------------------------------------------------------------ */
+
+/***	FrameSchedSleep(FrameSched *schedPtr)
+**
+**	Parameters:
+**		schedPtr - Pointer to the initialized FrameSched struct
+**
+**	Return Value:
+**
+**	Description:
+**		Sleeps in WFI until a frame has been counted since the last
+**		FrameSchedPoll. Returns at once if one already has, so a tick
+**		that arrives between the poll and this call is not lost.
+**
+*/
+void FrameSchedSleep(FrameSched *schedPtr)
+{
+	u32 cpsr;
+
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	while (schedPtr->frameCount == schedPtr->lastPoll)
+	{
+		TimerSleep();
+		mtcpsr(cpsr);
+		mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	}
+	mtcpsr(cpsr);
+}
+
+/************************************************************************/
@@ -0,0 +1,85 @@
+/************************************************************************/
+/*																		*/
+/*	frame_sched.h	--	Frame-tick event scheduler						*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Schedules callbacks a whole number of display frames in the		*/
+/*		future. FrameSchedTick is attached to the display frame			*/
+/*		interrupt (see DisplaySetFrameCallback) and only counts frames.	*/
+/*		Due events are run from the main loop by FrameSchedPoll, so		*/
+/*		they may draw into framebuffers and flush the cache, and the	*/
+/*		main loop is free to do other work between frames.				*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call FrameSchedInit.											*/
+/*		2) Register FrameSchedTick as the display frame callback with	*/
+/*		   the FrameSched struct as the callback reference.				*/
+/*		3) Schedule events with FrameSchedAfter or FrameSchedAt.		*/
+/*		4) Call FrameSchedPoll regularly from the main loop, and		*/
+/*		   FrameSchedSleep when there is nothing else to do.			*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef FRAME_SCHED_H_
+#define FRAME_SCHED_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define FRAME_SCHED_MAX_EVENTS 8
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * typedef for a scheduled event. frame is the frame count at the time the
+ * event was run, which may be later than the frame it was due on if the
+ * main loop was busy.
+ */
+typedef void (*FrameEventFn)(void *ref, u32 frame);
+
+typedef struct {
+		u32 due; /* Frame count at which the event becomes due */
+		FrameEventFn fn; /* Event function, NULL if the slot is free */
+		void *ref; /* Data to pass to the event function */
+} FrameEvent;
+
+typedef struct {
+		volatile u32 frameCount; /* Frames counted by FrameSchedTick */
+		u32 lastPoll; /* Frame count seen by the last FrameSchedPoll */
+		FrameEvent events[FRAME_SCHED_MAX_EVENTS];
+} FrameSched;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void FrameSchedInit(FrameSched *schedPtr);
+void FrameSchedTick(void *callBackRef, void *pDisplay);
+u32 FrameSchedNow(FrameSched *schedPtr);
+int FrameSchedAt(FrameSched *schedPtr, u32 frame, FrameEventFn fn, void *ref);
+int FrameSchedAfter(FrameSched *schedPtr, u32 frames, FrameEventFn fn, void *ref);
+void FrameSchedCancel(FrameSched *schedPtr, int handle);
+int FrameSchedPoll(FrameSched *schedPtr);
+void FrameSchedSleep(FrameSched *schedPtr);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* FRAME_SCHED_H_ */
@@ -0,0 +1,231 @@
+/************************************************************************/
+/*																		*/
+/*	golden.c	--	Framebuffer comparison and PPM export				*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Helpers for checking a faster version of a framebuffer kernel	*/
+/*		against its reference version, and for exporting frames and		*/
+/*		difference heatmaps as binary PPM images in memory.				*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Channels read in the G, B, R order of pixfmt.h		*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "golden.h"
+#include "../pixfmt/pixfmt.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#include <stdio.h>
+
+/* ------------------------------------------------------------ */
+/*				Forward Declarations							*/
+/* ------------------------------------------------------------ */
+
+static u32 GoldenWritePpmHeader(u8 *ppm, u32 width, u32 height);
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	GoldenCompare(const u8 *refFrame, const u8 *testFrame, u32 width, u32 height, u32 stride, u32 tolerance, GoldenStats *statsPtr)
+**
+**	Parameters:
+**		refFrame - Output of the reference kernel
+**		testFrame - Output of the kernel being checked
+**		width - Width of the compared area in pixels
+**		height - Height of the compared area in lines
+**		stride - Line stride of both frames in bytes
+**		tolerance - Largest channel difference that still matches, 0 for
+**				a byte for byte comparison
+**		statsPtr - Receives the comparison statistics
+**
+**	Return Value: int
+**		XST_SUCCESS if every pixel matches, XST_FAILURE otherwise
+**
+**	Description:
+**		Compares the visible area of two frames. Bytes past width in each
+**		line are ignored.
+**
+*/
+int GoldenCompare(const u8 *refFrame, const u8 *testFrame, u32 width, u32 height, u32 stride, u32 tolerance, GoldenStats *statsPtr)
+{
+	u32 xcoi, ycoi, i;
+	u32 lineStart = 0;
+	u32 diff, pixelDiff;
+
+	statsPtr->mismatches = 0;
+	statsPtr->maxDiff = 0;
+	statsPtr->firstX = 0;
+	statsPtr->firstY = 0;
+
+	for (ycoi = 0; ycoi < height; ycoi++)
+	{
+		for (xcoi = 0; xcoi < width; xcoi++)
+		{
+			pixelDiff = 0;
+			for (i = 0; i < 3; i++)
+			{
+				diff = (refFrame[lineStart + xcoi * 3 + i] > testFrame[lineStart + xcoi * 3 + i]) ?
+						refFrame[lineStart + xcoi * 3 + i] - testFrame[lineStart + xcoi * 3 + i] :
+						testFrame[lineStart + xcoi * 3 + i] - refFrame[lineStart + xcoi * 3 + i];
+				if (diff > pixelDiff)
+				{
+					pixelDiff = diff;
+				}
+			}
+			if (pixelDiff > statsPtr->maxDiff)
+			{
+				statsPtr->maxDiff = pixelDiff;
+			}
+			if (pixelDiff > tolerance)
+			{
+				if (statsPtr->mismatches == 0)
+				{
+					statsPtr->firstX = xcoi;
+					statsPtr->firstY = ycoi;
+				}
+				statsPtr->mismatches++;
+			}
+		}
+		lineStart += stride;
+	}
+
+	return (statsPtr->mismatches == 0) ? XST_SUCCESS : XST_FAILURE;
+}
+/* ------------------------------------------------------------ */
+
+/***	GoldenWritePpm(u8 *ppm, const u8 *frame, u32 width, u32 height, u32 stride)
+**
+**	Parameters:
+**		ppm - Output buffer, at least GOLDEN_PPM_SIZE(width, height) bytes
+**		frame - Frame to export
+**		width - Width of the frame in pixels
+**		height - Height of the frame in lines
+**		stride - Line stride of the frame in bytes
+**
+**	Return Value: u32
+**		Size of the PPM image in bytes
+**
+**	Description:
+**		Writes the frame as a binary (P6) PPM image and flushes it from
+**		the cache so it can be read out over JTAG.
+**
+*/
+u32 GoldenWritePpm(u8 *ppm, const u8 *frame, u32 width, u32 height, u32 stride)
+{
+	u32 xcoi, ycoi;
+	u32 lineStart = 0;
+	u32 iOut;
+
+	iOut = GoldenWritePpmHeader(ppm, width, height);
+	for (ycoi = 0; ycoi < height; ycoi++)
+	{
+		for (xcoi = 0; xcoi < width * 3; xcoi += 3)
+		{
+			ppm[iOut++] = frame[lineStart + xcoi + PIXFMT_R];
+			ppm[iOut++] = frame[lineStart + xcoi + PIXFMT_G];
+			ppm[iOut++] = frame[lineStart + xcoi + PIXFMT_B];
+		}
+		lineStart += stride;
+	}
+
+	Xil_DCacheFlushRange((unsigned int) ppm, iOut);
+
+	return iOut;
+}
+/* ------------------------------------------------------------ */
+
+/***	GoldenWriteDiffPpm(u8 *ppm, const u8 *refFrame, const u8 *testFrame, u32 width, u32 height, u32 stride)
+**
+**	Parameters:
+**		ppm - Output buffer, at least GOLDEN_PPM_SIZE(width, height) bytes
+**		refFrame - Output of the reference kernel
+**		testFrame - Output of the kernel being checked
+**		width - Width of the frames in pixels
+**		height - Height of the frames in lines
+**		stride - Line stride of both frames in bytes
+**
+**	Return Value: u32
+**		Size of the PPM image in bytes
+**
+**	Description:
+**		Writes a heatmap of the largest channel difference of each pixel
+**		as a binary PPM image. Matching pixels show the reference image
+**		darkened to a quarter of its brightness, differing pixels go from
+**		yellow for small differences to red for large ones.
+**
+*/
+u32 GoldenWriteDiffPpm(u8 *ppm, const u8 *refFrame, const u8 *testFrame, u32 width, u32 height, u32 stride)
+{
+	u32 xcoi, ycoi, i;
+	u32 lineStart = 0;
+	u32 iOut, iPixel;
+	u32 diff, pixelDiff;
+
+	iOut = GoldenWritePpmHeader(ppm, width, height);
+	for (ycoi = 0; ycoi < height; ycoi++)
+	{
+		for (xcoi = 0; xcoi < width; xcoi++)
+		{
+			iPixel = lineStart + xcoi * 3;
+			pixelDiff = 0;
+			for (i = 0; i < 3; i++)
+			{
+				diff = (refFrame[iPixel + i] > testFrame[iPixel + i]) ?
+						refFrame[iPixel + i] - testFrame[iPixel + i] :
+						testFrame[iPixel + i] - refFrame[iPixel + i];
+				if (diff > pixelDiff)
+				{
+					pixelDiff = diff;
+				}
+			}
+
+			if (pixelDiff == 0)
+			{
+				ppm[iOut++] = refFrame[iPixel + PIXFMT_R] >> 2;
+				ppm[iOut++] = refFrame[iPixel + PIXFMT_G] >> 2;
+				ppm[iOut++] = refFrame[iPixel + PIXFMT_B] >> 2;
+			}
+			else
+			{
+				ppm[iOut++] = 255;
+				ppm[iOut++] = (pixelDiff >= 32) ? 0 : 255 - pixelDiff * 8;
+				ppm[iOut++] = 0;
+			}
+		}
+		lineStart += stride;
+	}
+
+	Xil_DCacheFlushRange((unsigned int) ppm, iOut);
+
+	return iOut;
+}
+/* ------------------------------------------------------------ */
+
+/***	GoldenWritePpmHeader(u8 *ppm, u32 width, u32 height)
+**
+**	Parameters:
+**		ppm - Output buffer
+**		width - Image width in pixels
+**		height - Image height in lines
+**
+**	Return Value: u32
+**		Length of the header in bytes
+**
+*/
+static u32 GoldenWritePpmHeader(u8 *ppm, u32 width, u32 height)
+{
+	return snprintf((char *) ppm, GOLDEN_PPM_HEADER_MAX, "P6\n%lu %lu\n255\n", (unsigned long) width, (unsigned long) height);
+}
+
+/************************************************************************/
@@ -0,0 +1,160 @@
+/************************************************************************/
+/*																		*/
+/*	hwsim.h	--	Register level model of the video IP for host testing	*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Software model of the register maps that display_ctrl,			*/
+/*		video_capture and dynclk drive: the AXI VDMA (both channels),	*/
+/*		the input and output VTCs, the axi_dynclk pixel clock and the	*/
+/*		video GPIO (HPD out, TMDS lock in). It lets those drivers run	*/
+/*		unmodified on Linux so that mode switches, start/stop and		*/
+/*		re-lock can be tested and timed without a board.				*/
+/*																		*/
+/*		The model keeps its own clock in nanoseconds. Every register	*/
+/*		access costs HWSIM_ACCESS_NS, so driver polling loops (reset	*/
+/*		done, clock running, channel idle) make progress on their own,	*/
+/*		and HwSimStep lets the test move time forward between calls.	*/
+/*		Output frames are paced by the generator timing and the pixel	*/
+/*		clock decoded from the dynclk registers, input frames by the	*/
+/*		source set with HwSimSetSource. On each frame the VDMA channels	*/
+/*		advance their frame store (parked, circular or genlocked to		*/
+/*		the S2MM channel), count down the frame counter and raise their	*/
+/*		interrupts, and the VTCs raise VBLANK and lock/loss of lock.	*/
+/*																		*/
+/*		Interrupts are level sensitive. An asserted line that is		*/
+/*		connected with HwSimConnect is delivered after the access or	*/
+/*		step that raised it, one handler at a time, until the handler	*/
+/*		clears the source.												*/
+/*																		*/
+/*		The module only builds for Linux and is empty on the Zynq. A	*/
+/*		host build force-includes host/xil_io.h, which routes Xil_In32	*/
+/*		and Xil_Out32 here, and connects the driver interrupt handlers	*/
+/*		(XVtc_IntrHandler, GpioIsr, ...) with HwSimConnect in place of	*/
+/*		the GIC.														*/
+/*																		*/
+/*		With HWSIM_MAIN defined the module builds as a stand-alone host	*/
+/*		program that runs display_ctrl, video_capture and dynclk		*/
+/*		against the model. It starts, checks and stops the display in	*/
+/*		every mode, locks, stops, starts and unplugs capture for two	*/
+/*		sources, and prints the simulated time each step took:			*/
+/*			gcc -O2 -DHWSIM_MAIN -include hwsim/host/xil_io.h			*/
+/*				-I<bsp>/include -I. hwsim/hwsim.c						*/
+/*				display_ctrl/display_ctrl.c								*/
+/*				video_capture/video_capture.c							*/
+/*				dynclk/dynclk.c pixfmt/pixfmt.c blit/blit.c				*/
+/*				<bsp>/libsrc/axivdma_v6_5/src/xaxivdma*.c				*/
+/*				<bsp>/libsrc/vtc_v7_2/src/xvtc*.c						*/
+/*				<bsp>/libsrc/gpio_v4_3/src/xgpio*.c						*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_mem.c				*/
+/*				<bsp>/libsrc/standalone_v6_7/src/xil_assert.c			*/
+/*				-lm -o hwsim											*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added the HWSIM_MAIN host program					*/
+/*																		*/
+/************************************************************************/
+
+#ifndef HWSIM_H_
+#define HWSIM_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Base addresses of the modeled cores, taken from the hardware platform
+ */
+#define HWSIM_VDMA_BASEADDR XPAR_AXIVDMA_0_BASEADDR
+#define HWSIM_VTC_IN_BASEADDR XPAR_VTC_0_BASEADDR
+#define HWSIM_VTC_OUT_BASEADDR XPAR_VTC_1_BASEADDR
+#define HWSIM_DYNCLK_BASEADDR XPAR_AXI_DYNCLK_0_BASEADDR
+#define HWSIM_GPIO_BASEADDR XPAR_AXI_GPIO_VIDEO_BASEADDR
+
+/*
+ * Interrupt lines, numbered like the GIC IDs they are wired to
+ */
+#define HWSIM_IRQ_VDMA_MM2S XPAR_FABRIC_AXI_VDMA_0_MM2S_INTROUT_INTR
+#define HWSIM_IRQ_VDMA_S2MM XPAR_FABRIC_AXI_VDMA_0_S2MM_INTROUT_INTR
+#define HWSIM_IRQ_VTC_OUT XPAR_FABRIC_V_TC_OUT_IRQ_INTR
+#define HWSIM_IRQ_VTC_IN XPAR_FABRIC_V_TC_IN_IRQ_INTR
+#define HWSIM_IRQ_GPIO XPAR_FABRIC_AXI_GPIO_VIDEO_IP2INTC_IRPT_INTR
+
+/*
+ * Simulated time charged for one AXI-Lite register access
+ */
+#define HWSIM_ACCESS_NS 100
+
+/*
+ * Number of frame stores reported by the VDMA, as built in the hardware
+ */
+#define HWSIM_VDMA_FRAMES 3
+
+/*
+ * Number of input frames the TMDS receiver needs to lock after the source
+ * appears and HPD is asserted
+ */
+#define HWSIM_LOCK_FRAMES 2
+
+/*
+ * VDMA channel indices for HwSimSetFrameHook/HwSimGetFrameCount
+ */
+#define HWSIM_MM2S 0
+#define HWSIM_S2MM 1
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef void (*HwSimHandler)(void *callBackRef);
+
+/*
+ * Called when a VDMA channel finishes a frame. frame is the frame store that
+ * was read or written and addr its start address. A replay source uses the
+ * S2MM hook to put pixel data into the frame.
+ */
+typedef void (*HwSimFrameHook)(void *callBackRef, u32 frame, UINTPTR addr);
+
+/*
+ * Timing of the simulated input source
+ */
+typedef struct {
+		u32 width; /* Active pixels per line */
+		u32 height; /* Active lines per frame */
+		u32 hTotal; /* Pixels per line including blanking */
+		u32 vTotal; /* Lines per frame including blanking */
+		u32 framePeriodNs; /* Time from one frame start to the next */
+} HwSimSource;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void HwSimReset(void);
+u32 HwSimRead32(UINTPTR addr);
+void HwSimWrite32(UINTPTR addr, u32 value);
+void HwSimStep(u32 us);
+u64 HwSimNow(void);
+void HwSimConnect(u32 irq, HwSimHandler fn, void *callBackRef);
+void HwSimSetIrqEnable(int fEnable);
+void HwSimSetSource(const HwSimSource *sourcePtr);
+void HwSimSetFrameHook(u32 chan, HwSimFrameHook fn, void *callBackRef);
+u32 HwSimGetFrameCount(u32 chan);
+double HwSimGetPixelClock(void);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* HWSIM_H_ */
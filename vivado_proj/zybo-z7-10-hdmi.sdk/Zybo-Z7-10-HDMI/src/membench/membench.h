@@ -0,0 +1,96 @@
+/************************************************************************/
+/*																		*/
+/*	membench.h	--	Memory bandwidth benchmark over framebuffers		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Measures how fast the CPU can read, write, copy and fill		*/
+/*		framebuffer sized regions, to choose kernel layouts with data	*/
+/*		rather than guesses. Every test walks a width x height x 3		*/
+/*		byte frame and is varied by:									*/
+/*		- order: along rows, or down 4 byte (16 byte for NEON) columns	*/
+/*		- stride: the 5760 byte framebuffer stride, or width * 3		*/
+/*		- code: plain C word accesses, or NEON 16 byte accesses			*/
+/*		- mapping: write-back cached, or write-combined (normal			*/
+/*		  non-cacheable), switched per 1MB section in the MMU table		*/
+/*		MemBenchRunAll prints one row per test with the throughput at	*/
+/*		every resolution in vga_modes.h, under the MM2S scan-out		*/
+/*		demand of each mode from bw_budget.								*/
+/*																		*/
+/*		Throughput counts bytes read plus bytes written. Line lengths	*/
+/*		are rounded down to 16 bytes, which all vga_modes.h widths		*/
+/*		already are.													*/
+/*																		*/
+/*		NEON tests need -mfpu=neon and are skipped otherwise. On Linux	*/
+/*		the write-combined tests are skipped, times come from			*/
+/*		clock_gettime and output goes to stdout. With MEMBENCH_MAIN		*/
+/*		defined the module builds as a stand-alone host program:		*/
+/*			gcc -O2 -DMEMBENCH_MAIN -I<bsp>/include -I.					*/
+/*				membench/membench.c bw_budget/bw_budget.c -o membench	*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef MEMBENCH_H_
+#define MEMBENCH_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Test flags
+ */
+#define MEMBENCH_COLUMN 0x1 /* Walk down columns instead of along rows */
+#define MEMBENCH_TIGHT 0x2 /* Use a stride of width * 3 instead of MEMBENCH_STRIDE */
+#define MEMBENCH_NEON 0x4 /* Use NEON 16 byte accesses */
+#define MEMBENCH_WC 0x8 /* Buffers are mapped write-combined */
+#define MEMBENCH_NUM_VARIANTS 16
+
+/*
+ * Framebuffer stride, sized for 1920x1080
+ */
+#define MEMBENCH_STRIDE (1920 * 3)
+
+/*
+ * Size of one 1920x1080 frame at MEMBENCH_STRIDE, the least each buffer
+ * passed to MemBenchRunAll must hold
+ */
+#define MEMBENCH_MIN_SIZE (MEMBENCH_STRIDE * 1080)
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef enum {
+	MEMBENCH_READ = 0,
+	MEMBENCH_WRITE = 1, /* Store a pattern computed per word */
+	MEMBENCH_COPY = 2,
+	MEMBENCH_FILL = 3, /* Store a constant */
+	MEMBENCH_NUM_OPS = 4
+} MemBenchOp;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+u32 MemBenchRun(MemBenchOp op, u32 flags, u8 *src, u8 *dst, u32 width, u32 height, u32 reps);
+int MemBenchSetMapping(u8 *base, u32 size, int fWc);
+void MemBenchRunAll(u8 *src, u8 *dst, u32 reps);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* MEMBENCH_H_ */
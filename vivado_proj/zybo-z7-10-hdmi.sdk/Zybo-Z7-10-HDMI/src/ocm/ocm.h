@@ -0,0 +1,85 @@
+/************************************************************************/
+/*																		*/
+/*	ocm.h	--	On-chip memory for hot code and line buffers			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Puts the 192KB low OCM (ps7_ram_0 in lscript.ld) to work, so	*/
+/*		the kernels take DDR bandwidth and page hits away from the		*/
+/*		VDMA only for the frames themselves. The BSP maps it normal		*/
+/*		write-back cacheable and executable, and it is shared with		*/
+/*		CPU1 like DDR.													*/
+/*																		*/
+/*		Hot inner loops are marked OCM_TEXT. They are linked to run		*/
+/*		from OCM (section .ocm_text) but loaded into DDR with the rest	*/
+/*		of the image, since the FSBL is still running from low OCM		*/
+/*		while it loads the image. OcmInit copies them into place.		*/
+/*																		*/
+/*		The rest of low OCM, after any data placed in section			*/
+/*		.ocm_data, is scratch handed out by a stack allocator:			*/
+/*		OcmAlloc takes from the top of the free space, and OcmRelease	*/
+/*		gives back everything allocated since a matching OcmMark. A		*/
+/*		kernel marks, allocates its line buffers, runs and releases,	*/
+/*		so scratch never fragments. When OCM is full OcmAlloc returns	*/
+/*		NULL and the kernel works straight from DDR. Allocation is		*/
+/*		for CPU0 only; CPU1 may use what CPU0 allocated for it.			*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call OcmInit first thing, before any OCM_TEXT function		*/
+/*		   runs.														*/
+/*		2) Mark hot functions OCM_TEXT. Keep them small; everything		*/
+/*		   they call stays in DDR unless marked too.					*/
+/*		3) Around a kernel, call OcmMark, OcmAlloc for each buffer		*/
+/*		   and OcmRelease when it is done.								*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+#ifndef OCM_H_
+#define OCM_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Places a function in OCM. Empty on Linux, where there is no OCM.
+ */
+#ifdef __linux__
+ #define OCM_TEXT
+#else
+ #define OCM_TEXT __attribute__((section(".ocm_text"), noinline))
+#endif
+
+/*
+ * Alignment of OcmAlloc when the caller passes 0, one L1 cache line
+ */
+#define OCM_ALIGN 32
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int OcmInit();
+void *OcmAlloc(u32 size, u32 align);
+u32 OcmMark();
+void OcmRelease(u32 mark);
+u32 OcmFreeBytes();
+u32 OcmTextBytes();
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* OCM_H_ */
@@ -0,0 +1,336 @@
+/************************************************************************/
+/*																		*/
+/*	prof.c	--	Performance counter profiling of code sections			*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Measures cycles, L1 data cache misses and instructions spent	*/
+/*		between ProfBegin and ProfEnd, and adds them up per named site.	*/
+/*		Uses the Cortex-A9 PMU on the Zynq and perf_event_open when		*/
+/*		built for Linux.												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "prof.h"
+#include "xstatus.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __linux__
+ #include <linux/perf_event.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+ #include <stdio.h>
+ #define PROF_PRINTF printf
+#else
+ #include "xpm_counter.h"
+ #include "xreg_cortexa9.h"
+ #include "xpseudo_asm.h"
+ #include "../uart_ps/uart_ps.h"
+ #define PROF_PRINTF UartPrintf
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static ProfSite sites[PROF_MAX_SITES];
+
+#ifdef __linux__
+static int perfFd[PROF_NUM_COUNTERS] = {-1, -1, -1};
+#else
+/*
+ * PMU event programmed into event counter n for counter index n
+ */
+static const u32 pmuEvents[PROF_NUM_COUNTERS] = {
+	XPM_EVENT_CLOCKCYCLES,
+	XPM_EVENT_DATA_CACHEREFILL,
+	XPM_EVENT_INSTRRENAME
+};
+#endif
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	ProfSample(ProfCounts *countsPtr)
+**
+**	Parameters:
+**		countsPtr - Receives the current counter values
+**
+**	Return Value:
+**
+**	Description:
+**		Reads the free running counters, for callers that take their own
+**		differences. The counters are 32 bits wide on the Zynq, so a
+**		single measurement must stay under 2^32 cycles (about 6.5 s at
+**		667 MHz) and differences must be taken in 32 bits.
+**
+*/
+void ProfSample(ProfCounts *countsPtr)
+{
+	int i;
+
+#ifdef __linux__
+	u64 value;
+
+	for (i = 0; i < PROF_NUM_COUNTERS; i++)
+	{
+		value = 0;
+		if (perfFd[i] < 0 || read(perfFd[i], &value, sizeof(value)) != sizeof(value))
+		{
+			value = 0;
+		}
+		countsPtr->count[i] = value;
+	}
+#else
+	for (i = 0; i < PROF_NUM_COUNTERS; i++)
+	{
+		mtcp(XREG_CP15_EVENT_CNTR_SEL, i);
+		isb();
+		countsPtr->count[i] = mfcp(XREG_CP15_PERF_MONITOR_COUNT);
+	}
+#endif
+}
+/* ------------------------------------------------------------ */
+
+/***	ProfInit()
+**
+**	Parameters:
+**
+**	Return Value: int
+**		XST_SUCCESS if all counters could be set up
+**
+**	Errors:
+**		On Linux, perf_event_open can fail if the kernel does not allow
+**		access to hardware counters. The counters that failed read as 0.
+**
+**	Description:
+**		Clears every site and starts the counters.
+**
+*/
+int ProfInit()
+{
+	int status = XST_SUCCESS;
+	int i;
+
+	ProfReset();
+
+#ifdef __linux__
+	static const u32 types[PROF_NUM_COUNTERS] = {PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE};
+	static const u64 configs[PROF_NUM_COUNTERS] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+		PERF_COUNT_HW_INSTRUCTIONS
+	};
+	struct perf_event_attr attr;
+
+	for (i = 0; i < PROF_NUM_COUNTERS; i++)
+	{
+		if (perfFd[i] >= 0)
+		{
+			continue;
+		}
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = types[i];
+		attr.config = configs[i];
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		perfFd[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+		if (perfFd[i] < 0)
+		{
+			status = XST_FAILURE;
+		}
+	}
+#else
+	u32 reg;
+
+	/*
+	 * Disable, program and reset the event counters, then enable the PMU
+	 */
+	mtcp(XREG_CP15_COUNT_ENABLE_CLR, (1 << PROF_NUM_COUNTERS) - 1);
+	for (i = 0; i < PROF_NUM_COUNTERS; i++)
+	{
+		mtcp(XREG_CP15_EVENT_CNTR_SEL, i);
+		isb();
+		mtcp(XREG_CP15_EVENT_TYPE_SEL, pmuEvents[i]);
+	}
+	reg = mfcp(XREG_CP15_PERF_MONITOR_CTRL);
+	reg |= (1 << 1) | (1 << 0); //reset event counters, enable
+	mtcp(XREG_CP15_PERF_MONITOR_CTRL, reg);
+	mtcp(XREG_CP15_COUNT_ENABLE_SET, (1 << PROF_NUM_COUNTERS) - 1);
+	isb();
+#endif
+
+	return status;
+}
+/* ------------------------------------------------------------ */
+
+/***	ProfBegin(ProfMark *markPtr, const char *name)
+**
+**	Parameters:
+**		markPtr - Mark to pass to the matching ProfEnd
+**		name - Name of the site. Calls with the same name share a site.
+**				Must remain valid, normally a string literal.
+**
+**	Return Value:
+**
+**	Description:
+**		Starts a measurement. If all sites are in use the measurement is
+**		ignored.
+**
+*/
+void ProfBegin(ProfMark *markPtr, const char *name)
+{
+	int i;
+	int freeSite = -1;
+
+	markPtr->site = -1;
+	for (i = 0; i < PROF_MAX_SITES; i++)
+	{
+		if (sites[i].name != NULL && (sites[i].name == name || strcmp(sites[i].name, name) == 0))
+		{
+			markPtr->site = i;
+			break;
+		}
+		if (sites[i].name == NULL && freeSite < 0)
+		{
+			freeSite = i;
+		}
+	}
+	if (markPtr->site < 0 && freeSite >= 0)
+	{
+		sites[freeSite].name = name;
+		markPtr->site = freeSite;
+	}
+
+	ProfSample(&markPtr->start);
+}
+/* ------------------------------------------------------------ */
+
+/***	ProfEnd(ProfMark *markPtr)
+**
+**	Parameters:
+**		markPtr - Mark passed to ProfBegin
+**
+**	Return Value:
+**
+**	Description:
+**		Ends a measurement and adds it to the totals of its site.
+**
+*/
+void ProfEnd(ProfMark *markPtr)
+{
+	ProfCounts end;
+	ProfSite *sitePtr;
+	int i;
+
+	ProfSample(&end);
+	if (markPtr->site < 0)
+	{
+		return;
+	}
+
+	sitePtr = &sites[markPtr->site];
+	sitePtr->calls++;
+	for (i = 0; i < PROF_NUM_COUNTERS; i++)
+	{
+#ifdef __linux__
+		sitePtr->total.count[i] += end.count[i] - markPtr->start.count[i];
+#else
+		sitePtr->total.count[i] += (u32) (end.count[i] - markPtr->start.count[i]);
+#endif
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	ProfGetSite(int index)
+**
+**	Parameters:
+**		index - Site index, 0 to PROF_MAX_SITES - 1
+**
+**	Return Value: const ProfSite *
+**		The site, or NULL if the index is out of range or unused
+**
+*/
+const ProfSite *ProfGetSite(int index)
+{
+	if (index < 0 || index >= PROF_MAX_SITES || sites[index].name == NULL)
+	{
+		return NULL;
+	}
+
+	return &sites[index];
+}
+/* ------------------------------------------------------------ */
+
+/***	ProfReset()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Description:
+**		Forgets every site and its totals.
+**
+*/
+void ProfReset()
+{
+	int i;
+
+	for (i = 0; i < PROF_MAX_SITES; i++)
+	{
+		sites[i].name = NULL;
+		sites[i].calls = 0;
+		sites[i].total.count[PROF_CYCLES] = 0;
+		sites[i].total.count[PROF_L1D_MISSES] = 0;
+		sites[i].total.count[PROF_INSTRS] = 0;
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	ProfPrint()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Description:
+**		Prints the call count and the per call average of each counter
+**		for every site.
+**
+*/
+void ProfPrint()
+{
+	int i;
+	u32 calls;
+
+	PROF_PRINTF("%-20s %8s %12s %10s %12s\n\r", "Site", "Calls", "Cycles", "L1D miss", "Instrs");
+	for (i = 0; i < PROF_MAX_SITES; i++)
+	{
+		if (sites[i].name == NULL)
+		{
+			continue;
+		}
+		calls = (sites[i].calls == 0) ? 1 : sites[i].calls;
+		PROF_PRINTF("%-20.20s %8lu %12llu %10llu %12llu\n\r",
+				sites[i].name,
+				(unsigned long) sites[i].calls,
+				(unsigned long long) (sites[i].total.count[PROF_CYCLES] / calls),
+				(unsigned long long) (sites[i].total.count[PROF_L1D_MISSES] / calls),
+				(unsigned long long) (sites[i].total.count[PROF_INSTRS] / calls));
+	}
+}
+
+/************************************************************************/
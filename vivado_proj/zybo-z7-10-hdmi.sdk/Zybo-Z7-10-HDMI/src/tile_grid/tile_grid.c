@@ -0,0 +1,196 @@
+/************************************************************************/
+/*																		*/
+/*	tile_grid.c	--	Data-driven tile grid renderer						*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Draws a cols x rows grid of solid colored tiles into a 24-bit	*/
+/*		framebuffer. Each tile has an "on" and an "off" color taken		*/
+/*		from a palette table, and a highlight mask selects which tiles	*/
+/*		are drawn with their "on" color.								*/
+/*																		*/
+/*		The grid remembers what it last drew, so changing the			*/
+/*		highlight mask only marks the tiles whose state actually		*/
+/*		changed as dirty. TileGridRender repaints just those tiles		*/
+/*		with BlitFillRect.												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created, replaces FillColor2x2/FillColor3x3			*/
+/*		10/19/2026: Spans are built in a line buffer and published		*/
+/*					through fb_policy									*/
+/*		10/19/2026: Tiles are filled with BlitFillRect					*/
+/*		10/19/2026: Palette colors are converted with PixFmtFromRgb		*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "tile_grid.h"
+#include "xstatus.h"
+#include "../fb_policy/fb_policy.h"
+#include "../blit/blit.h"
+#include "../pixfmt/pixfmt.h"
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	TileGridInit(TileGrid *gridPtr, u32 cols, u32 rows, const TileColor *palette)
+**
+**	Parameters:
+**		gridPtr - Pointer to the struct that will be initialized
+**		cols - Number of tile columns
+**		rows - Number of tile rows
+**		palette - cols*rows on/off color pairs, in row-major order. The
+**				  table is referenced, not copied.
+**
+**	Return Value: int
+**		XST_SUCCESS if successful
+**		XST_INVALID_PARAM if the grid has more than TILE_GRID_MAX_TILES tiles
+**
+**	Description:
+**		Initializes the grid with nothing highlighted. Every tile starts
+**		out dirty, so the first TileGridRender draws the whole grid.
+**
+*/
+int TileGridInit(TileGrid *gridPtr, u32 cols, u32 rows, const TileColor *palette)
+{
+	if (cols == 0 || rows == 0 || cols * rows > TILE_GRID_MAX_TILES)
+	{
+		return XST_INVALID_PARAM;
+	}
+
+	gridPtr->cols = cols;
+	gridPtr->rows = rows;
+	gridPtr->numTiles = cols * rows;
+	gridPtr->palette = palette;
+	gridPtr->highlight = TILE_GRID_NONE;
+	gridPtr->shown = TILE_GRID_NONE;
+	gridPtr->dirty = TILE_GRID_ALL(gridPtr);
+
+	return XST_SUCCESS;
+}
+/* ------------------------------------------------------------ */
+
+/***	TileGridSetHighlight(TileGrid *gridPtr, u32 highlight)
+**
+**	Parameters:
+**		gridPtr - Pointer to the initialized TileGrid struct
+**		highlight - Mask of the tiles to light, see TILE_GRID_BIT
+**
+**	Return Value:
+**
+**	Description:
+**		Selects the lit tiles. Only tiles that differ from what is
+**		currently in the framebuffer are marked dirty.
+**
+*/
+void TileGridSetHighlight(TileGrid *gridPtr, u32 highlight)
+{
+	highlight &= TILE_GRID_ALL(gridPtr);
+	gridPtr->highlight = highlight;
+	gridPtr->dirty |= (highlight ^ gridPtr->shown);
+}
+/* ------------------------------------------------------------ */
+
+/***	TileGridInvalidate(TileGrid *gridPtr)
+**
+**	Parameters:
+**		gridPtr - Pointer to the initialized TileGrid struct
+**
+**	Return Value:
+**
+**	Description:
+**		Marks every tile dirty. Must be called when the framebuffer no
+**		longer holds what the grid last drew (another frame was displayed,
+**		the resolution changed, something else drew over it, etc.).
+**
+*/
+void TileGridInvalidate(TileGrid *gridPtr)
+{
+	gridPtr->dirty = TILE_GRID_ALL(gridPtr);
+}
+/* ------------------------------------------------------------ */
+
+/***	TileGridRender(TileGrid *gridPtr, u8 *frame, u32 width, u32 height, u32 stride)
+**
+**	Parameters:
+**		gridPtr - Pointer to the initialized TileGrid struct
+**		frame - Framebuffer to draw into
+**		width - Width of the active video frame, in pixels
+**		height - Height of the active video frame, in lines
+**		stride - Line stride of the framebuffer, in bytes
+**
+**	Return Value: u32
+**		Number of tiles that were repainted
+**
+**	Description:
+**		Repaints every dirty tile and publishes exactly the bytes that
+**		were written with FbPolicyEnd, so the changes are visible to the
+**		VDMA. Column edges are
+**		rounded up and row edges use whole height/rows bands, with the
+**		last column and row absorbing the remainder.
+**
+*/
+u32 TileGridRender(TileGrid *gridPtr, u8 *frame, u32 width, u32 height, u32 stride)
+{
+	u32 tile, col, row;
+	u32 x0, x1, y0, y1, ycoi;
+	u32 spanBytes, color;
+	u32 rowHeight;
+	u32 repainted = 0;
+	u8 *pSpan;
+
+	rowHeight = height / gridPtr->rows;
+	FbPolicyBegin(FB_WRITE_ONLY, NULL, 0);
+
+	for (tile = 0; tile < gridPtr->numTiles; tile++)
+	{
+		if (!(gridPtr->dirty & TILE_GRID_BIT(tile)))
+		{
+			continue;
+		}
+
+		col = tile % gridPtr->cols;
+		row = tile / gridPtr->cols;
+
+		x0 = (col * width + gridPtr->cols - 1) / gridPtr->cols;
+		x1 = (col == gridPtr->cols - 1) ? width : ((col + 1) * width + gridPtr->cols - 1) / gridPtr->cols;
+		y0 = row * rowHeight;
+		y1 = (row == gridPtr->rows - 1) ? height : (row + 1) * rowHeight;
+		if (x1 <= x0 || y1 <= y0)
+		{
+			continue;
+		}
+
+		color = (gridPtr->highlight & TILE_GRID_BIT(tile)) ? gridPtr->palette[tile].on : gridPtr->palette[tile].off;
+		color = PixFmtFromRgb(color);
+		spanBytes = (x1 - x0) * 3;
+
+		/*
+		 * The fill only writes the frame, then each line of the tile is
+		 * published on its own so the bytes between them are left alone
+		 */
+		BlitFillRect(frame, stride, x0, y0, x1 - x0, y1 - y0, color);
+		pSpan = frame + y0 * stride + x0 * 3;
+		for (ycoi = y0; ycoi < y1; ycoi++)
+		{
+			FbPolicyEnd(pSpan, spanBytes);
+			pSpan += stride;
+		}
+
+		repainted++;
+	}
+
+	gridPtr->shown = gridPtr->highlight;
+	gridPtr->dirty = TILE_GRID_NONE;
+
+	return repainted;
+}
+
+/************************************************************************/
@@ -0,0 +1,99 @@
+/************************************************************************/
+/*																		*/
+/*	tile_grid.h	--	Data-driven tile grid renderer						*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Draws a cols x rows grid of solid colored tiles into a 24-bit	*/
+/*		framebuffer. Each tile has an "on" and an "off" color taken		*/
+/*		from a palette table, and a highlight mask selects which tiles	*/
+/*		are drawn with their "on" color.								*/
+/*																		*/
+/*		The grid remembers what it last drew, so changing the			*/
+/*		highlight mask only marks the tiles whose state actually		*/
+/*		changed as dirty. TileGridRender repaints just those tiles		*/
+/*		with the blit library, and leaves the cache						*/
+/*		maintenance to fb_policy. It only ever writes the frame, so		*/
+/*		under a write-combined mapping no maintenance is needed.		*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call TileGridInit with the grid size and palette.			*/
+/*		2) Call TileGridSetHighlight to select the lit tiles.			*/
+/*		3) Call TileGridRender to bring the framebuffer up to date.		*/
+/*		4) If anything else draws into the framebuffer, call			*/
+/*		   TileGridInvalidate before the next TileGridRender.			*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created, replaces FillColor2x2/FillColor3x3			*/
+/*		10/19/2026: Spans are built in a line buffer and published		*/
+/*					through fb_policy									*/
+/*		10/19/2026: Tiles are filled with BlitFillRect					*/
+/*		10/19/2026: Palette colors are converted with PixFmtFromRgb		*/
+/*																		*/
+/************************************************************************/
+
+#ifndef TILE_GRID_H_
+#define TILE_GRID_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * The highlight and dirty sets are u32 bitmasks indexed by tile number
+ * (row-major, tile 0 is the top left tile), which limits a grid to 32 tiles.
+ */
+#define TILE_GRID_MAX_TILES 32
+
+#define TILE_GRID_NONE 0x00000000
+#define TILE_GRID_ALL(grid) ((grid)->numTiles >= 32 ? 0xFFFFFFFF : ((1u << (grid)->numTiles) - 1))
+#define TILE_GRID_BIT(tile) (1u << (tile))
+
+/*
+ * Builds a 0xRRGGBB color. TileGridRender converts it to the byte order of
+ * the framebuffer with PixFmtFromRgb.
+ */
+#define TILE_RGB(r,g,b) ((((u32) (r)) << 16) | (((u32) (g)) << 8) | ((u32) (b)))
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+typedef struct {
+		u32 on; /* 0xRRGGBB color used while the tile is highlighted */
+		u32 off; /* 0xRRGGBB color used while the tile is not highlighted */
+} TileColor;
+
+typedef struct {
+		u32 cols; /* Number of tile columns */
+		u32 rows; /* Number of tile rows */
+		u32 numTiles; /* cols * rows */
+		const TileColor *palette; /* numTiles entries, row-major */
+		u32 highlight; /* Requested highlight mask */
+		u32 shown; /* Highlight mask that is currently in the framebuffer */
+		u32 dirty; /* Tiles that must be repainted by the next TileGridRender */
+} TileGrid;
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+int TileGridInit(TileGrid *gridPtr, u32 cols, u32 rows, const TileColor *palette);
+void TileGridSetHighlight(TileGrid *gridPtr, u32 highlight);
+void TileGridInvalidate(TileGrid *gridPtr);
+u32 TileGridRender(TileGrid *gridPtr, u8 *frame, u32 width, u32 height, u32 stride);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* TILE_GRID_H_ */
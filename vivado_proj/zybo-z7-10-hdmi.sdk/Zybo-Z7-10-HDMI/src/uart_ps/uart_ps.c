@@ -0,0 +1,414 @@
+/************************************************************************/
+/*																		*/
+/*	uart_ps.c	--	Interrupt driven console I/O for Zynq systems		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Receives console characters from a PS UART in its interrupt		*/
+/*		handler and keeps them in a ring buffer, so menus can sleep		*/
+/*		instead of polling the UART FIFO. The ring has one writer (the	*/
+/*		interrupt handler) and one reader (the main loop) and needs no	*/
+/*		locking.														*/
+/*																		*/
+/*		Output written with UartPrintf/UartWrite is queued in a second	*/
+/*		ring and fed to the UART FIFO from the TX empty interrupt, so	*/
+/*		printing a menu returns without waiting for the baud rate.		*/
+/*		Output printed with xil_printf bypasses the ring and can end up	*/
+/*		out of order with queued output.								*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added buffered transmit and UartPrintf				*/
+/*																		*/
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "uart_ps.h"
+#include "../timer_ps/timer_ps.h"
+#include "xuartps_hw.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define UART_RX_BUF_MASK (UART_RX_BUF_SIZE - 1)
+#define UART_TX_BUF_MASK (UART_TX_BUF_SIZE - 1)
+
+/*
+ * Receive interrupts serviced by UartIsr. The FIFO trigger level is set to
+ * one character, so every keypress interrupts and the timeout is not needed.
+ */
+#define UART_RX_IRPTS (XUARTPS_IXR_RXOVR | XUARTPS_IXR_OVER)
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+static u32 uartBase = 0;
+
+/*
+ * rxHead is only written by UartIsr, rxTail only by the main loop
+ */
+static u8 rxBuf[UART_RX_BUF_SIZE];
+static volatile u32 rxHead = 0;
+static volatile u32 rxTail = 0;
+static volatile u32 rxDropped = 0;
+
+/*
+ * txHead is only written by the main loop. txTail is written by UartTxFill,
+ * which runs in UartIsr or with IRQs masked.
+ */
+static u8 txBuf[UART_TX_BUF_SIZE];
+static volatile u32 txHead = 0;
+static volatile u32 txTail = 0;
+
+/* ------------------------------------------------------------ */
+/*				Forward Declarations							*/
+/* ------------------------------------------------------------ */
+
+static void UartTxFill();
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+
+/***	UartInitialize(u32 baseAddr)
+**
+**	Parameters:
+**		baseAddr - Base address of the console PS UART
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Empties the UART receive FIFO and the ring, then enables the
+**		receive interrupts. The UART itself must already be configured,
+**		which the BSP does for the stdin/stdout UART. Characters are not
+**		received until uartIvt has been registered with fnEnableInterrupts.
+*/
+void UartInitialize(u32 baseAddr)
+{
+	uartBase = baseAddr;
+
+	XUartPs_WriteReg(uartBase, XUARTPS_IDR_OFFSET, XUARTPS_IXR_MASK);
+	XUartPs_WriteReg(uartBase, XUARTPS_RXWM_OFFSET, 1);
+
+	rxHead = 0;
+	rxTail = 0;
+	rxDropped = 0;
+	txHead = 0;
+	txTail = 0;
+	while (XUartPs_IsReceiveData(uartBase))
+	{
+		XUartPs_ReadReg(uartBase, XUARTPS_FIFO_OFFSET);
+	}
+
+	XUartPs_WriteReg(uartBase, XUARTPS_ISR_OFFSET, XUARTPS_IXR_MASK);
+	XUartPs_WriteReg(uartBase, XUARTPS_IER_OFFSET, UART_RX_IRPTS);
+}
+/* ------------------------------------------------------------ */
+
+/***	UartGetChar(char *c)
+**
+**	Parameters:
+**		c - Receives the next character
+**
+**	Return Value: int
+**		1 if a character was read, 0 if the ring is empty
+**
+**	Errors:
+**
+**	Description:
+**		Non-blocking read of one character from the receive ring.
+*/
+int UartGetChar(char *c)
+{
+	u32 tail = rxTail;
+
+	if (tail == rxHead)
+	{
+		return 0;
+	}
+
+	*c = (char) rxBuf[tail & UART_RX_BUF_MASK];
+	/*
+	 * Make sure the character is read before the slot is handed back
+	 */
+	dmb();
+	rxTail = tail + 1;
+
+	return 1;
+}
+/* ------------------------------------------------------------ */
+
+/***	UartWaitChar(char *c, volatile char *wakeFlag)
+**
+**	Parameters:
+**		c - Receives the next character
+**		wakeFlag - Flag set from interrupt context that also ends the
+**				wait, or NULL
+**
+**	Return Value: int
+**		1 if a character was read, 0 if the wait ended on wakeFlag
+**
+**	Errors:
+**
+**	Description:
+**		Sleeps in WFI until a character is received or *wakeFlag is set.
+**		Timer callbacks and other interrupt handlers keep running while
+**		the core waits. The conditions are checked with IRQs masked, so
+**		an interrupt that arrives just before the WFI still wakes it.
+**		wakeFlag is not cleared.
+*/
+int UartWaitChar(char *c, volatile char *wakeFlag)
+{
+	u32 cpsr;
+	int fGot;
+
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	while (!(fGot = UartGetChar(c)) && !(wakeFlag != NULL && *wakeFlag))
+	{
+		TimerSleep();
+		mtcpsr(cpsr);
+		mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	}
+	mtcpsr(cpsr);
+
+	return fGot;
+}
+/* ------------------------------------------------------------ */
+
+/***	UartFlushRx()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Discards every character that has been received so far.
+*/
+void UartFlushRx()
+{
+	rxTail = rxHead;
+}
+/* ------------------------------------------------------------ */
+
+/***	UartRxDropped()
+**
+**	Parameters:
+**
+**	Return Value: u32
+**		Number of characters lost because the ring or the UART FIFO
+**		was full
+**
+**	Errors:
+**
+**	Description:
+*/
+u32 UartRxDropped()
+{
+	return rxDropped;
+}
+/* ------------------------------------------------------------ */
+
+/***	UartWrite(const char *buf, u32 len)
+**
+**	Parameters:
+**		buf - Characters to send
+**		len - Number of characters in buf
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Queues characters for transmission and returns. Only waits, in
+**		WFI, if the transmit ring is full.
+*/
+void UartWrite(const char *buf, u32 len)
+{
+	u32 cpsr;
+	u32 head = txHead;
+	u32 i;
+
+	for (i = 0; i < len; i++)
+	{
+		if (head - txTail >= UART_TX_BUF_SIZE)
+		{
+			/*
+			 * Ring is full. Publish what has been queued and sleep until the
+			 * interrupt handler makes room.
+			 */
+			dmb();
+			txHead = head;
+			cpsr = mfcpsr();
+			mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+			UartTxFill();
+			while (head - txTail >= UART_TX_BUF_SIZE)
+			{
+				TimerSleep();
+				mtcpsr(cpsr);
+				mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+			}
+			mtcpsr(cpsr);
+		}
+		txBuf[head & UART_TX_BUF_MASK] = (u8) buf[i];
+		head++;
+	}
+
+	/*
+	 * Publish the characters before moving the head, then start the
+	 * transmitter in case it is idle
+	 */
+	dmb();
+	txHead = head;
+	cpsr = mfcpsr();
+	mtcpsr(cpsr | XIL_EXCEPTION_IRQ);
+	UartTxFill();
+	mtcpsr(cpsr);
+}
+/* ------------------------------------------------------------ */
+
+/***	UartPrintf(const char *fmt, ...)
+**
+**	Parameters:
+**		fmt - printf style format string
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Formats a string and queues it with UartWrite. Unlike xil_printf,
+**		floating point conversions are supported. Output longer than
+**		UART_PRINTF_MAX - 1 characters is truncated.
+*/
+void UartPrintf(const char *fmt, ...)
+{
+	char buf[UART_PRINTF_MAX];
+	va_list args;
+	int len;
+
+	va_start(args, fmt);
+	len = vsnprintf(buf, sizeof(buf), fmt, args);
+	va_end(args);
+
+	if (len < 0)
+	{
+		return;
+	}
+	if (len >= (int) sizeof(buf))
+	{
+		len = sizeof(buf) - 1;
+	}
+	UartWrite(buf, (u32) len);
+}
+/* ------------------------------------------------------------ */
+
+/***	UartTxFill()
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		Moves queued characters into the UART transmit FIFO until it is
+**		full. The TX empty interrupt is left enabled only while characters
+**		remain in the ring. Must be called from UartIsr or with IRQs
+**		masked.
+*/
+static void UartTxFill()
+{
+	u32 tail = txTail;
+
+	while (tail != txHead && !(XUartPs_ReadReg(uartBase, XUARTPS_SR_OFFSET) & XUARTPS_SR_TXFULL))
+	{
+		XUartPs_WriteReg(uartBase, XUARTPS_FIFO_OFFSET, txBuf[tail & UART_TX_BUF_MASK]);
+		tail++;
+	}
+	txTail = tail;
+
+	if (tail != txHead)
+	{
+		XUartPs_WriteReg(uartBase, XUARTPS_IER_OFFSET, XUARTPS_IXR_TXEMPTY);
+	}
+	else
+	{
+		XUartPs_WriteReg(uartBase, XUARTPS_IDR_OFFSET, XUARTPS_IXR_TXEMPTY);
+	}
+}
+/* ------------------------------------------------------------ */
+
+/***	UartIsr(void *InstancePtr)
+**
+**	Parameters:
+**		InstancePtr - unused
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**		UART interrupt handler. Moves everything in the receive FIFO into
+**		the receive ring, dropping and counting characters that do not
+**		fit, and refills the transmit FIFO from the transmit ring.
+*/
+void UartIsr(void *InstancePtr)
+{
+	u32 status;
+	u32 head;
+	u8 data;
+
+	status = XUartPs_ReadReg(uartBase, XUARTPS_ISR_OFFSET);
+	status &= XUartPs_ReadReg(uartBase, XUARTPS_IMR_OFFSET);
+
+	head = rxHead;
+	while (XUartPs_IsReceiveData(uartBase))
+	{
+		data = (u8) XUartPs_ReadReg(uartBase, XUARTPS_FIFO_OFFSET);
+		if (head - rxTail < UART_RX_BUF_SIZE)
+		{
+			rxBuf[head & UART_RX_BUF_MASK] = data;
+			head++;
+		}
+		else
+		{
+			rxDropped++;
+		}
+	}
+	if (status & XUARTPS_IXR_OVER)
+	{
+		rxDropped++;
+	}
+	/*
+	 * Publish the characters before moving the head
+	 */
+	dmb();
+	rxHead = head;
+
+	XUartPs_WriteReg(uartBase, XUARTPS_ISR_OFFSET, status);
+
+	if (status & XUARTPS_IXR_TXEMPTY)
+	{
+		UartTxFill();
+	}
+}
+
+/************************************************************************/
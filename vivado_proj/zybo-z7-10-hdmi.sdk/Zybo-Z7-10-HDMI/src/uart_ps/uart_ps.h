@@ -0,0 +1,88 @@
+/************************************************************************/
+/*																		*/
+/*	uart_ps.h	--	Interrupt driven console I/O for Zynq systems		*/
+/*																		*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*		Receives console characters from a PS UART in its interrupt		*/
+/*		handler and keeps them in a ring buffer, so menus can sleep		*/
+/*		instead of polling the UART FIFO. The ring has one writer (the	*/
+/*		interrupt handler) and one reader (the main loop) and needs no	*/
+/*		locking.														*/
+/*																		*/
+/*		Output written with UartPrintf/UartWrite is queued in a second	*/
+/*		ring and fed to the UART FIFO from the TX empty interrupt, so	*/
+/*		printing a menu returns without waiting for the baud rate.		*/
+/*		Output printed with xil_printf bypasses the ring and can end up	*/
+/*		out of order with queued output.								*/
+/*																		*/
+/*		The following steps should be followed to use this module:		*/
+/*		1) Call UartInitialize with the console UART base address.		*/
+/*		2) Add uartIvt to the interrupt vector table passed to			*/
+/*		   fnEnableInterrupts.											*/
+/*		3) Read characters with UartGetChar or UartWaitChar, and print	*/
+/*		   with UartPrintf.												*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/* 																		*/
+/*		10/19/2026: Created												*/
+/*		10/19/2026: Added buffered transmit and UartPrintf				*/
+/*																		*/
+/************************************************************************/
+
+#ifndef UART_PS_H_
+#define UART_PS_H_
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "xil_types.h"
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Size of the receive ring. Must be a power of 2.
+ */
+#define UART_RX_BUF_SIZE 256
+
+/*
+ * Size of the transmit ring. Must be a power of 2, and large enough to hold
+ * a full menu so that printing it never waits.
+ */
+#define UART_TX_BUF_SIZE 2048
+
+/*
+ * Longest string a single UartPrintf call can produce
+ */
+#define UART_PRINTF_MAX 256
+
+/*
+ * Macro for the UART IVT.
+ * 	x=UART Interrupt ID (XPAR_XUARTPS_x_INTR)
+ */
+#define uartIvt(x)\
+	{x, (XInterruptHandler)UartIsr, NULL, 0xB8, 0x3}
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void UartInitialize(u32 baseAddr);
+int UartGetChar(char *c);
+int UartWaitChar(char *c, volatile char *wakeFlag);
+void UartFlushRx();
+u32 UartRxDropped();
+void UartWrite(const char *buf, u32 len);
+void UartPrintf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void UartIsr(void *InstancePtr);
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
+#endif /* UART_PS_H_ */
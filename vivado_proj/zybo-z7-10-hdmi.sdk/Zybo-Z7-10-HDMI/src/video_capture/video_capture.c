@@ -59,6 +59,8 @@
  * Ver   Who          Date         Changes
  * ----- ------------ -----------  -----------------------------------------------
  * 1.00  Sam Bobrowicz 2015-Nov-25 First Release
+ * 1.01               2026-Oct-19 Framebuffer pixel format taken from the S2MM
+ *                                 stream width
  *
  * </pre>
  *
@@ -172,7 +174,7 @@ int VideoStart(VideoCapture *videoPtr)
 	 * current mode
 	 */
 	videoPtr->vdmaConfig.VertSizeInput = videoPtr->timing.VActiveVideo;
-	videoPtr->vdmaConfig.HoriSizeInput = videoPtr->timing.HActiveVideo * 3;
+	videoPtr->vdmaConfig.HoriSizeInput = videoPtr->timing.HActiveVideo * PixFmtBytes(videoPtr->fmt);
 	videoPtr->vdmaConfig.FixedFrameStoreAddr = videoPtr->curFrame;
 	/*
 	 *Also reset the stride and address values, in case the user manually changed them
@@ -241,7 +243,8 @@ int VideoStart(VideoCapture *videoPtr)
 **	Description:
 **		Initializes the driver struct for use. The interrupt controller should be enabled before calling this function to ensure
 **		a locked interrupt is not missed. After this function has been called, VideoStart,VideoStop, VideoSetCallBack, and VideoChangeFrame
-**		can all be called at will.
+**		can all be called at will. The pixel format of the framebuffers is left in fmt, found from the width of the VDMA's
+**		S2MM stream.
 **
 */
 int VideoInitialize(VideoCapture *videoPtr, INTC *intCtrl, XAxiVdma *vdma, u16 gpioId, u16 vtcId, u32 vtcIrptId, u8 *framePtr[VIDEO_NUM_FRAMES], u32 stride, u32 startOnDet)
@@ -268,6 +271,16 @@ int VideoInitialize(VideoCapture *videoPtr, INTC *intCtrl, XAxiVdma *vdma, u16 g
 	videoPtr->callBack = NULL;
 	videoPtr->callBackRef = NULL;
 
+	/*
+	 * The VDMA writes the stream to memory unchanged, so the framebuffers
+	 * hold one S2MM stream word per pixel
+	 */
+	if (PixFmtFromStreamWidth(XAxiVdma_GetChannel(vdma, XAXIVDMA_WRITE)->StreamWidth * 8, &videoPtr->fmt) != XST_SUCCESS)
+	{
+		xdbg_printf(XDBG_DEBUG_GENERAL, "No pixel format for the S2MM stream width\n\r");
+		return XST_FAILURE;
+	}
+
 	/*
 	 * Initialize the VDMA Read configuration struct
 	 */
@@ -14,6 +14,18 @@
 #include "xil_types.h"
 #include "xil_cache.h"
 #include "timer_ps/timer_ps.h"
+#include "uart_ps/uart_ps.h"
+#include "prof/prof.h"
+#include "bench/bench.h"
+#include "golden/golden.h"
+#include <string.h>
+#include "frame_sched/frame_sched.h"
+#include "vdma_mon/vdma_mon.h"
+#include "membench/membench.h"
+#include "fb_policy/fb_policy.h"
+#include "blit/blit.h"
+#include "pixfmt/pixfmt.h"
+#include "ocm/ocm.h"
 #include "xparameters.h"
 #include "xscutimer.h"
 
@@ -23,12 +35,17 @@
 #define DYNCLK_BASEADDR 		XPAR_AXI_DYNCLK_0_BASEADDR
 #define VDMA_ID 				XPAR_AXIVDMA_0_DEVICE_ID
 #define HDMI_OUT_VTC_ID 		XPAR_V_TC_OUT_DEVICE_ID
+#define HDMI_OUT_VTC_IRPT_ID 	XPAR_FABRIC_V_TC_OUT_IRQ_INTR
 #define HDMI_IN_VTC_ID 			XPAR_V_TC_IN_DEVICE_ID
 #define HDMI_IN_GPIO_ID 		XPAR_AXI_GPIO_VIDEO_DEVICE_ID
 #define HDMI_IN_VTC_IRPT_ID 	XPAR_FABRIC_V_TC_IN_IRQ_INTR
 #define HDMI_IN_GPIO_IRPT_ID 	XPAR_FABRIC_AXI_GPIO_VIDEO_IP2INTC_IRPT_INTR
 #define SCU_TIMER_ID 			XPAR_SCUTIMER_DEVICE_ID
+#define SCU_TIMER_IRPT_ID 		XPAR_SCUTIMER_INTR
 #define UART_BASEADDR 			XPAR_PS7_UART_1_BASEADDR
+#define UART_IRPT_ID 			XPAR_PS7_UART_1_INTR
+#define VDMA_MM2S_IRPT_ID 		XPAR_FABRIC_AXI_VDMA_0_MM2S_INTROUT_INTR
+#define VDMA_S2MM_IRPT_ID 		XPAR_FABRIC_AXI_VDMA_0_S2MM_INTROUT_INTR
 
 /* ------------------------------------------------------------ */
 /*				Global Variables								*/
@@ -42,19 +59,85 @@ XAxiVdma vdma;
 VideoCapture videoCapt;
 INTC intc;
 char fRefresh; //flag used to trigger a refresh of the Menu on video detect
+VdmaMon vdmaMon; //VDMA error counters
 
 /*
- * Framebuffers for video data
+ * Framebuffers for video data. Section aligned so fb_policy can remap all
+ * but the tail of the last frame.
  */
-u8 frameBuf[DISPLAY_NUM_FRAMES][DEMO_MAX_FRAME] __attribute__((aligned(0x20)));
+u8 frameBuf[DISPLAY_NUM_FRAMES][DEMO_MAX_FRAME] __attribute__((aligned(FB_POLICY_SECTION)));
 u8 *pFrames[DISPLAY_NUM_FRAMES]; //array of pointers to the frame buffers
 
+/*
+ * Reference and test outputs of Verify, and PPM images of the first mismatch
+ * it finds
+ */
+u8 verifyBuf[2][DEMO_MAX_FRAME] __attribute__((aligned(0x20)));
+u8 ppmBuf[2][GOLDEN_PPM_SIZE(1920, 1080)] __attribute__((aligned(0x20)));
+
+/*
+ * Simon Says boards. Each tile is drawn in its "on" color while highlighted
+ * and in its "off" color otherwise.
+ */
+static const TileColor palette2x2[] = {
+	{TILE_RGB(255, 0, 0),   TILE_RGB(55, 0, 0)},	//R: Red
+	{TILE_RGB(0, 255, 0),   TILE_RGB(0, 55, 0)},	//G: Green
+	{TILE_RGB(0, 0, 255),   TILE_RGB(0, 0, 55)},	//B: Blue
+	{TILE_RGB(255, 255, 0), TILE_RGB(55, 55, 0)}	//Y: Yellow
+};
+
+static const TileColor palette3x3[] = {
+	{TILE_RGB(214, 48, 38),   TILE_RGB(107, 24, 19)},	//7
+	{TILE_RGB(244, 108, 66),  TILE_RGB(122, 54, 33)},	//8
+	{TILE_RGB(254, 174, 98),  TILE_RGB(127, 87, 49)},	//9
+	{TILE_RGB(254, 224, 138), TILE_RGB(127, 112, 69)},	//4
+	{TILE_RGB(254, 254, 192), TILE_RGB(127, 127, 96)},	//5
+	{TILE_RGB(218, 238, 138), TILE_RGB(109, 119, 69)},	//6
+	{TILE_RGB(166, 218, 106), TILE_RGB(83, 109, 53)},	//1
+	{TILE_RGB(102, 188, 98),  TILE_RGB(51, 94, 49)},	//2
+	{TILE_RGB(26, 152, 80),   TILE_RGB(13, 76, 40)}		//3
+};
+
+static const SimonVariant SIMON_2X2 = {
+	.cols = 2,
+	.rows = 2,
+	.palette = palette2x2,
+	.keys = "RGBY",
+	.help = "\n\rR = Red, G= Green, B=Blue, Y=Yellow\n\r"
+};
+
+static const SimonVariant SIMON_3X3 = {
+	.cols = 3,
+	.rows = 3,
+	.palette = palette3x3,
+	.keys = "789456123",
+	.help = "\n\rUse Your Num Pad!\n\r"
+			"\n\r 7 8 9 \n\r"
+			"\n\r 4 5 6 \n\r"
+			"\n\r 1 2 3 \n\r"
+};
+
+/*
+ * Tile grid drawn on the displayed framebuffer
+ */
+TileGrid grid;
+
+/*
+ * Frame scheduler, ticked by the display frame interrupt
+ */
+FrameSched frameSched;
+
 /*
  * Interrupt vector table
  */
 const ivt_t ivt[] = {
 	videoGpioIvt(HDMI_IN_GPIO_IRPT_ID, &videoCapt),
-	videoVtcIvt(HDMI_IN_VTC_IRPT_ID, &(videoCapt.vtc))
+	videoVtcIvt(HDMI_IN_VTC_IRPT_ID, &(videoCapt.vtc)),
+	displayVtcIvt(HDMI_OUT_VTC_IRPT_ID, &(dispCtrl.vtc)),
+	timerIvt(SCU_TIMER_IRPT_ID),
+	uartIvt(UART_IRPT_ID),
+	vdmaMonReadIvt(VDMA_MM2S_IRPT_ID, &vdma),
+	vdmaMonWriteIvt(VDMA_S2MM_IRPT_ID, &vdma)
 };
 
 /* ------------------------------------------------------------ */
@@ -78,6 +161,11 @@ void Initialize()
 	XAxiVdma_Config *vdmaConfig;
 	int i;
 
+	/*
+	 * Move the OCM_TEXT code into OCM before anything calls it
+	 */
+	OcmInit();
+
 	/*
 	 * Initialize an array of pointers to the 3 frame buffers
 	 */
@@ -123,6 +211,25 @@ void Initialize()
 		return;
 	}
 
+	/*
+	 * Buffer console input in the UART interrupt handler
+	 */
+	UartInitialize(UART_BASEADDR);
+
+	/*
+	 * Start the performance counters used to profile tile drawing
+	 */
+	ProfInit();
+
+	/*
+	 * Map the framebuffers for tile drawing
+	 */
+	Status = FbPolicyInit(frameBuf[0], sizeof(frameBuf), DEMO_FB_MAPPING);
+	if (Status != XST_SUCCESS)
+	{
+		xil_printf("Framebuffer mapping failed during demo initialization%d\r\n", Status);
+	}
+
 	/*
 	 * Initialize the Interrupt controller and start it.
 	 */
@@ -133,6 +240,26 @@ void Initialize()
 	}
 	fnEnableInterrupts(&intc, &ivt[0], sizeof(ivt)/sizeof(ivt[0]));
 
+	/*
+	 * Switch the delay timer over to interrupts, so delays sleep instead of spin
+	 */
+	TimerStartService();
+
+	/*
+	 * Count VDMA errors from now on
+	 */
+	Status = VdmaMonInit(&vdmaMon, &vdma);
+	if (Status != XST_SUCCESS)
+	{
+		xil_printf("VDMA monitor initialization failed during demo initialization%d\r\n", Status);
+	}
+
+	/*
+	 * Count display frames so the game can be paced on vsync
+	 */
+	FrameSchedInit(&frameSched);
+	DisplaySetFrameCallback(&dispCtrl, FrameSchedTick, &frameSched);
+
 	/*
 	 * Initialize the Video Capture device
 	 */
@@ -148,7 +275,8 @@ void Initialize()
 	 */
 	VideoSetCallback(&videoCapt, DemoISR, &fRefresh);
 
-	FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 1);
+	TileGridInit(&grid, SIMON_3X3.cols, SIMON_3X3.rows, SIMON_3X3.palette);
+	ShowTiles(TILE_GRID_BIT(6));
 
 	return;
 }
@@ -156,26 +284,18 @@ void Run()
 {
 	char userInput = 0;
 
-	/* Flush UART FIFO */
-	while (XUartPs_IsReceiveData(UART_BASEADDR))
-	{
-		XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-	}
+	/* Flush UART receive buffer */
+	UartFlushRx();
 
 	while (userInput != 'q')
 	{
 		fRefresh = 0;
 		StartMenu();
 
-		/* Wait for data on UART */
-		while (!XUartPs_IsReceiveData(UART_BASEADDR) && !fRefresh)
-		{}
-
-		/* Store the first character in the UART receive FIFO and echo it */
-		if (XUartPs_IsReceiveData(UART_BASEADDR))
+		/* Sleep until a key is received or video is detected, and echo the key */
+		if (UartWaitChar(&userInput, &fRefresh))
 		{
-			userInput = XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-			xil_printf("%c", userInput);
+			UartPrintf("%c", userInput);
 		}
 		else  //Refresh triggered by video detect interrupt
 		{
@@ -185,15 +305,29 @@ void Run()
 		switch (userInput)
 		{
 		case '1':
+			VdmaMonSetActivity(&vdmaMon, "Simon 2x2");
 			RunSimonSays2x2();
 			break;
 		case '2':
+			VdmaMonSetActivity(&vdmaMon, "Simon 3x3");
 			RunSimonSays3x3();
 			break;
+		case 'b':
+			VdmaMonSetActivity(&vdmaMon, "Benchmark");
+			Benchmark();
+			break;
+		case 'v':
+			VdmaMonSetActivity(&vdmaMon, "Verify");
+			Verify();
+			break;
+		case 'p':
+			PrintProfile();
+			break;
 		default :
-			xil_printf("\n\rInvalid Selection");
+			UartPrintf("\n\rInvalid Selection");
 			TimerDelay(500000);
 		}
+		VdmaMonSetActivity(&vdmaMon, NULL);
 	}
 
 	return;
@@ -201,136 +335,107 @@ void Run()
 
 void StartMenu()
 {
-	xil_printf("\x1B[H"); //Set cursor to top left of terminal
-	xil_printf("\x1B[2J"); //Clear terminal
-	xil_printf("**************************************************\n\r");
-	xil_printf("*                SIMON SAYS GAME                 *\n\r");
-	xil_printf("**************************************************\n\r");
-	xil_printf("\n\r");
-	xil_printf("1 - Play Simon Says 2X2\n\r");
-	xil_printf("2 - Play Simon Says 3X3\n\r");
-	xil_printf("q - Quit\n\r");
-	xil_printf("\n\r");
-	xil_printf("\n\r");
-	xil_printf("Enter a selection:");
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("**************************************************\n\r");
+	UartPrintf("*                SIMON SAYS GAME                 *\n\r");
+	UartPrintf("**************************************************\n\r");
+	UartPrintf("\n\r");
+	UartPrintf("1 - Play Simon Says 2X2\n\r");
+	UartPrintf("2 - Play Simon Says 3X3\n\r");
+	UartPrintf("b - Benchmark Tile Drawing\n\r");
+	UartPrintf("v - Verify Tile Drawing Against Reference\n\r");
+	UartPrintf("p - Print Performance Counters and VDMA Errors\n\r");
+	UartPrintf("q - Quit\n\r");
+	UartPrintf("\n\r");
+	UartPrintf("\n\r");
+	UartPrintf("Enter a selection:");
 }
 
-void RunSimonSays2x2(){
+void RunSimonSays2x2()
+{
+	RunSimonSays(&SIMON_2X2);
+}
 
-	xil_printf("\x1B[H"); //Set cursor to top left of terminal
-	xil_printf("\x1B[2J"); //Clear terminal
+void RunSimonSays3x3()
+{
+	RunSimonSays(&SIMON_3X3);
+}
 
-	//Up to 10 sequence
-	int SeqLen = 20;
-	int sequence[SeqLen];
-	int guessSeq[SeqLen];
+void RunSimonSays(const SimonVariant *variant)
+{
+	int sequence[SIMON_MAX_SEQ];
+	int guessSeq[SIMON_MAX_SEQ];
+	int round = 1;
+	int gameStop = 0;
+	char userInput;
 
-	//Generate random sequence
-	for(int i = 0; i < SeqLen; i++){
-		if ((i % 2) == 0){
-			sequence[i] = (rand() % 4);
-		}else{
-			sequence[i] = 4;
-		}
-		guessSeq[i] = 0;
-	}
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
 
-	FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 4);
+	TileGridInit(&grid, variant->cols, variant->rows, variant->palette);
 
+	//Generate random sequence
+	for(int i = 0; i < SIMON_MAX_SEQ; i++){
+		sequence[i] = rand() % grid.numTiles;
+		guessSeq[i] = -1;
+	}
 
-	int round = 1;
-	int gameStop = 0;
+	ShowTiles(TILE_GRID_NONE);
 
-	xil_printf("\n\rRules: Repeat the pattern shown in the screen!");
-	xil_printf("\n\rPress Enter To Continue\n");
+	UartPrintf("\n\rRules: Repeat the pattern shown in the screen!");
+	UartPrintf("\n\rPress Enter To Continue\n");
 
-	/* Wait for data on UART */
-	while (!XUartPs_IsReceiveData(UART_BASEADDR) && !fRefresh){}
+	/* Sleep until a key is received */
+	UartWaitChar(&userInput, &fRefresh);
 
 	while(gameStop == 0){
 
-		xil_printf("\x1B[H"); //Set cursor to top left of terminal
-		xil_printf("\x1B[2J"); //Clear terminal
+		UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+		UartPrintf("\x1B[2J"); //Clear terminal
 
-		FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 4);
-
-		xil_printf("Displaying Colors...");
-		//Show The Colors
-		for(int c = 0; c < round + 1; c++){
-			FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, sequence[c]);
-			TimerDelay(500000*2);
-		}
-		xil_printf("\n\rDisplaying Color Done! What is the sequence? (MAKE SURE ALL CAPS)...");
-		xil_printf("\n\rR = Red, G= Green, B=Blue, Y=Yellow\n\r");
+		ShowTiles(TILE_GRID_NONE);
 
+		UartPrintf("Displaying Colors...");
+		//Show The Colors, each followed by a blank board
+		PlaySequence(sequence, round);
+		UartPrintf("\n\rDisplaying Color Done! What is the sequence? (MAKE SURE ALL CAPS)...");
+		UartPrintf("%s", variant->help);
 
-		for(int a = 0; a < round + 1; a+=2){
-			char userInput = 0;
-			/* Flush UART FIFO */
-			while (XUartPs_IsReceiveData(UART_BASEADDR))
-			{
-				XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-			}
+		for(int a = 0; a < round; a++){
+			userInput = 0;
+			/* Flush UART receive buffer */
+			UartFlushRx();
 
 			fRefresh = 0;
 
-			/* Wait for data on UART */
-			while (!XUartPs_IsReceiveData(UART_BASEADDR) && !fRefresh){}
-
-			/* Store the first character in the UART receive FIFO and echo it */
-			if (XUartPs_IsReceiveData(UART_BASEADDR))
+			/* Sleep until a key is received, and echo it */
+			if (UartWaitChar(&userInput, &fRefresh))
 			{
-				userInput = XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-				xil_printf("%c", userInput);
+				UartPrintf("%c", userInput);
 			}
 
-			switch(userInput)
-			{
-				case 'R':
-					FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 0);
-					guessSeq[a] = 0;
-					guessSeq[a+1] = 4;
-					break;
-				case 'G':
-					FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 2);
-					guessSeq[a] = 2;
-					guessSeq[a+1] = 4;
-					break;
-				case 'B':
-					FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 1);
-					guessSeq[a] = 1;
-					guessSeq[a+1] = 4;
-					break;
-				case 'Y':
-					FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 3);
-					guessSeq[a] = 3;
-					guessSeq[a+1] = 4;
-					break;
-				default :
-					FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 4);
-					guessSeq[a] = 4;
-					guessSeq[a+1] = 4;
-			}
-
-
+			/* Light the chosen tile, an unknown key blanks the board and counts as a miss */
+			guessSeq[a] = KeyToTile(variant, userInput);
+			ShowTiles((guessSeq[a] < 0) ? TILE_GRID_NONE : TILE_GRID_BIT(guessSeq[a]));
 		}
 
-		xil_printf("\n\rChecking Answer! Please wait!");
-		for(int i = 0; i < round + 1; i++){
+		UartPrintf("\n\rChecking Answer! Please wait!");
+		for(int i = 0; i < round; i++){
 			if(guessSeq[i] != sequence[i]){
-				xil_printf("\n\rYou Lose!!");
+				UartPrintf("\n\rYou Lose!!");
 				gameStop = 1;
 				break;
 			}
 		}
 
 		if (gameStop == 0){
-			xil_printf("\n\rCorrect!");
+			UartPrintf("\n\rCorrect!");
 		}
 
-		round += 2;
+		round++;
 
-		if (round > SeqLen){
+		if (round > SIMON_MAX_SEQ){
 			gameStop = 1;
 		}
 
@@ -340,433 +445,359 @@ void RunSimonSays2x2(){
 	TimerDelay(500000*2);
 }
 
-void RunSimonSays3x3(){
+/*
+ * Lists the performance counter totals gathered so far, and resets them on
+ * request.
+ */
+void PrintProfile()
+{
+	char userInput;
+
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("Per call averages since the last reset, %s framebuffers:\n\r\n\r", FbPolicyName(FbPolicyGetMapping()));
+	ProfPrint();
+	UartPrintf("\n\rVDMA errors since start-up:\n\r\n\r");
+	VdmaMonPrint(&vdmaMon, DEMO_VDMA_MON_SECONDS);
+	UartPrintf("\n\rPress r to reset the counters, any other key to return");
+
+	UartFlushRx();
+	UartWaitChar(&userInput, NULL);
+	if (userInput == 'r')
+	{
+		ProfReset();
+	}
+}
+
+/*
+ * Times a full redraw of each board at every resolution. Draws into a
+ * framebuffer that is not on screen, with video capture stopped so it cannot
+ * write into it.
+ */
+void Benchmark()
+{
+	TileBenchRef ref[2];
+	const BenchCase cases[] = {
+		{"Tiles 2x2", BenchTiles, &ref[0]},
+		{"Tiles 3x3", BenchTiles, &ref[1]}
+	};
+	FbMapping otherMapping;
+	int fStreaming;
+	char userInput;
+
+	ref[0].variant = &SIMON_2X2;
+	ref[0].frame = pFrames[(dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES];
+	ref[1].variant = &SIMON_3X3;
+	ref[1].frame = ref[0].frame;
 
-	xil_printf("\x1B[H"); //Set cursor to top left of terminal
-	xil_printf("\x1B[2J"); //Clear terminal
+	/*
+	 * Rerun under the other framebuffer mapping for as long as c is pressed.
+	 * The last mapping chosen stays in effect.
+	 */
+	do
+	{
+		fStreaming = (videoCapt.state == VIDEO_STREAMING);
+		if (fStreaming)
+		{
+			VideoStop(&videoCapt);
+		}
 
-	//Up to 10 sequence
-	int SeqLen = 20;
-	int sequence[SeqLen];
-	int guessSeq[SeqLen];
+		otherMapping = (FbPolicyGetMapping() == FB_MAP_WC) ? FB_MAP_CACHED : FB_MAP_WC;
+		UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+		UartPrintf("\x1B[2J"); //Clear terminal
+		UartPrintf("Running benchmark, stride %d bytes, %s framebuffers...\n\r\n\r", DEMO_STRIDE, FbPolicyName(FbPolicyGetMapping()));
+		BenchRunAll(cases, sizeof(cases) / sizeof(cases[0]), BENCH_REPS);
+		UartPrintf("\n\rPress c to switch the framebuffers to %s and rerun,\n\r", FbPolicyName(otherMapping));
+		UartPrintf("m to measure memory bandwidth, any other key to return");
 
-	//Generate random sequence
-	for(int i = 0; i < SeqLen; i++){
-		if ((i % 2) == 0){
-			sequence[i] = (rand() % 7) + 1;
-		}else{
-			sequence[i] = 0;
+		if (fStreaming)
+		{
+			VideoStart(&videoCapt);
 		}
-		guessSeq[i] = 0;
-	}
 
-	FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 0);
+		UartFlushRx();
+		UartWaitChar(&userInput, NULL);
+		if (userInput == 'c')
+		{
+			FbPolicySetMapping(otherMapping);
+		}
+	} while (userInput == 'c');
 
+	if (userInput == 'm')
+	{
+		MemoryBenchmark();
+	}
+}
 
-	int round = 1;
-	int gameStop = 0;
+void MemoryBenchmark()
+{
+	int fStreaming;
+	char userInput;
 
-	xil_printf("\n\rRules: Repeat the pattern shown in the screen!");
-	xil_printf("\n\rPress Enter To Continue\n");
+	fStreaming = (videoCapt.state == VIDEO_STREAMING);
+	if (fStreaming)
+	{
+		VideoStop(&videoCapt);
+	}
 
-	/* Wait for data on UART */
-	while (!XUartPs_IsReceiveData(UART_BASEADDR) && !fRefresh){}
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("Measuring memory bandwidth in the off-screen framebuffers...\n\r\n\r");
+	MemBenchRunAll(pFrames[(dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES], pFrames[(dispCtrl.curFrame + 2) % DISPLAY_NUM_FRAMES], MEMORY_BENCH_REPS);
 
-	while(gameStop == 0){
+	/*
+	 * MemBenchRunAll leaves the framebuffers cached, put back the selected
+	 * mapping
+	 */
+	FbPolicySetMapping(FbPolicyGetMapping());
 
-		xil_printf("\x1B[H"); //Set cursor to top left of terminal
-		xil_printf("\x1B[2J"); //Clear terminal
+	UartPrintf("\n\rBlit library against the code it replaces, %s framebuffers:\n\r\n\r", FbPolicyName(FbPolicyGetMapping()));
+	BlitBenchRunAll(pFrames[(dispCtrl.curFrame + 1) % DISPLAY_NUM_FRAMES], pFrames[(dispCtrl.curFrame + 2) % DISPLAY_NUM_FRAMES], MEMORY_BENCH_REPS);
+	UartPrintf("\n\rPress any key to return");
 
-		FillColor2x2(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 8);
+	if (fStreaming)
+	{
+		VideoStart(&videoCapt);
+	}
 
-		xil_printf("Displaying Colors...");
-		//Show The Colors
-		for(int c = 0; c < round + 1; c++){
-			FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, sequence[c]);
-			TimerDelay(500000*2);
-		}
-		xil_printf("\n\rDisplaying Color Done! What is the sequence? (MAKE SURE ALL CAPS)...");
-		xil_printf("\n\rUse Your Num Pad!\n\r");
-		xil_printf("\n\r 7 8 9 \n\r");
-		xil_printf("\n\r 4 5 6 \n\r");
-		xil_printf("\n\r 1 2 3 \n\r");
+	UartFlushRx();
+	UartWaitChar(&userInput, NULL);
+}
 
+/*
+ * Benchmark wrapper that draws every tile of a board, half of them
+ * highlighted. Returns the bytes written.
+ */
+u32 BenchTiles(void *ref, u32 width, u32 height)
+{
+	TileBenchRef *benchRef = (TileBenchRef *) ref;
+	TileGrid benchGrid;
 
-		for(int a = 0; a < round + 1; a+=2){
-			char userInput = 0;
-			/* Flush UART FIFO */
-			while (XUartPs_IsReceiveData(UART_BASEADDR))
-			{
-				XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-			}
+	TileGridInit(&benchGrid, benchRef->variant->cols, benchRef->variant->rows, benchRef->variant->palette);
+	TileGridSetHighlight(&benchGrid, 0x55555555 & TILE_GRID_ALL(&benchGrid));
+	TileGridRender(&benchGrid, benchRef->frame, width, height, DEMO_STRIDE);
 
-			fRefresh = 0;
+	return width * height * 3;
+}
 
-			/* Wait for data on UART */
-			while (!XUartPs_IsReceiveData(UART_BASEADDR) && !fRefresh){}
+/*
+ * Checks TileGridRender against RefTileFill for both boards at every
+ * resolution, with no tiles, every other tile and all tiles highlighted. The
+ * first mismatch is exported as PPM images that can be read out over JTAG.
+ */
+void Verify()
+{
+	const VideoMode *const modes[] = {&VMODE_640x480, &VMODE_800x600, &VMODE_1280x720, &VMODE_1280x1024, &VMODE_1600x900, &VMODE_1920x1080};
+	const SimonVariant *variants[] = {&SIMON_2X2, &SIMON_3X3};
+	TileGrid testGrid;
+	GoldenStats stats;
+	u32 masks[3];
+	u32 m, v, k, w, h, size;
+	int failures = 0;
+	int fDumped = 0;
+	char userInput;
+
+	UartPrintf("\x1B[H"); //Set cursor to top left of terminal
+	UartPrintf("\x1B[2J"); //Clear terminal
+	UartPrintf("Checking tile drawing against reference...\n\r\n\r");
+
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+	{
+		w = modes[m]->width;
+		h = modes[m]->height;
+		for (v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+		{
+			TileGridInit(&testGrid, variants[v]->cols, variants[v]->rows, variants[v]->palette);
+			masks[0] = TILE_GRID_NONE;
+			masks[1] = 0x55555555 & TILE_GRID_ALL(&testGrid);
+			masks[2] = TILE_GRID_ALL(&testGrid);
 
-			/* Store the first character in the UART receive FIFO and echo it */
-			if (XUartPs_IsReceiveData(UART_BASEADDR))
+			for (k = 0; k < 3; k++)
 			{
-				userInput = XUartPs_ReadReg(UART_BASEADDR, XUARTPS_FIFO_OFFSET);
-				xil_printf("%c", userInput);
-			}
+				RefTileFill(verifyBuf[0], variants[v], masks[k], w, h, DEMO_STRIDE);
+				BlitSet(verifyBuf[1], 0xA5, DEMO_MAX_FRAME);
+				TileGridSetHighlight(&testGrid, masks[k]);
+				TileGridInvalidate(&testGrid);
+				TileGridRender(&testGrid, verifyBuf[1], w, h, DEMO_STRIDE);
+
+				if (GoldenCompare(verifyBuf[0], verifyBuf[1], w, h, DEMO_STRIDE, 0, &stats) == XST_SUCCESS)
+				{
+					UartPrintf("Tiles %lux%lu %-15s mask %03lx ok\n\r", (unsigned long) variants[v]->cols, (unsigned long) variants[v]->rows, modes[m]->label, (unsigned long) masks[k]);
+					continue;
+				}
 
-			switch(userInput)
-			{
-				case '7':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 7);
-					guessSeq[a] = 7;
-					guessSeq[a+1] = 0;
-					break;
-				case '8':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 8);
-					guessSeq[a] = 8;
-					guessSeq[a+1] = 0;
-					break;
-				case '9':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 9);
-					guessSeq[a] = 9;
-					guessSeq[a+1] = 0;
-					break;
-				case '4':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 4);
-					guessSeq[a] = 4;
-					guessSeq[a+1] = 0;
-					break;
-				case '5':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 5);
-					guessSeq[a] = 5;
-					guessSeq[a+1] = 0;
-					break;
-				case '6':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 6);
-					guessSeq[a] = 6;
-					guessSeq[a+1] = 0;
-					break;
-				case '1':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 1);
-					guessSeq[a] = 1;
-					guessSeq[a+1] = 0;
-					break;
-				case '2':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 2);
-					guessSeq[a] = 2;
-					guessSeq[a+1] = 0;
-					break;
-				case '3':
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 3);
-					guessSeq[a] = 3;
-					guessSeq[a+1] = 0;
-					break;
-				default :
-					FillColor3x3(dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride, 0);
-					guessSeq[a] = 0;
-					guessSeq[a+1] = 0;
+				failures++;
+				UartPrintf("Tiles %lux%lu %-15s mask %03lx FAILED, %lu pixels, first at %lu,%lu\n\r", (unsigned long) variants[v]->cols, (unsigned long) variants[v]->rows, modes[m]->label, (unsigned long) masks[k],
+						(unsigned long) stats.mismatches, (unsigned long) stats.firstX, (unsigned long) stats.firstY);
+				if (!fDumped)
+				{
+					size = GoldenWritePpm(ppmBuf[0], verifyBuf[1], w, h, DEMO_STRIDE);
+					UartPrintf("  Output:  mrd -bin -file test.ppm 0x%08lx %lu\n\r", (unsigned long) ppmBuf[0], (unsigned long) (size + 3) / 4);
+					size = GoldenWriteDiffPpm(ppmBuf[1], verifyBuf[0], verifyBuf[1], w, h, DEMO_STRIDE);
+					UartPrintf("  Heatmap: mrd -bin -file diff.ppm 0x%08lx %lu\n\r", (unsigned long) ppmBuf[1], (unsigned long) (size + 3) / 4);
+					fDumped = 1;
+				}
 			}
-
-
 		}
+	}
 
-		xil_printf("\n\rChecking Answer! Please wait!");
-		for(int i = 0; i < round + 1; i++){
-			if(guessSeq[i] != sequence[i]){
-				xil_printf("\n\rYou Lose!!");
-				gameStop = 1;
-				break;
-			}
-		}
+	UartPrintf("\n\r%d check(s) failed\n\r", failures);
+	UartPrintf("Press any key to return");
 
-		if (gameStop == 0){
-			xil_printf("\n\rCorrect!");
-		}
+	UartFlushRx();
+	UartWaitChar(&userInput, NULL);
+}
 
-		round += 2;
+/*
+ * Straightforward per pixel version of the tile grid drawing, used as the
+ * reference by Verify. Column c covers the pixels with x*cols/width == c,
+ * rows are height/rows lines tall with the last row taking the remainder.
+ */
+void RefTileFill(u8 *frame, const SimonVariant *variant, u32 highlight, u32 width, u32 height, u32 stride)
+{
+	u32 xcoi, ycoi;
+	u32 col, row, tile, color;
+	u32 iPixelAddr;
 
-		if (round > SeqLen){
-			gameStop = 1;
+	for (ycoi = 0; ycoi < height; ycoi++)
+	{
+		row = ycoi / (height / variant->rows);
+		if (row >= variant->rows)
+		{
+			row = variant->rows - 1;
+		}
+		iPixelAddr = ycoi * stride;
+		for (xcoi = 0; xcoi < width; xcoi++)
+		{
+			col = xcoi * variant->cols / width;
+			tile = row * variant->cols + col;
+			color = (highlight & TILE_GRID_BIT(tile)) ? variant->palette[tile].on : variant->palette[tile].off;
+			frame[iPixelAddr + PIXFMT_R] = (u8) (color >> 16);
+			frame[iPixelAddr + PIXFMT_G] = (u8) (color >> 8);
+			frame[iPixelAddr + PIXFMT_B] = (u8) color;
+			iPixelAddr += 3;
 		}
-
-		TimerDelay(500000*2);
 	}
+}
 
-	TimerDelay(500000*2);
+/*
+ * Brings the displayed framebuffer up to date with the given highlight mask.
+ * Only the tiles whose state changed are redrawn.
+ */
+void ShowTiles(u32 highlight)
+{
+	ProfMark mark;
+
+	TileGridSetHighlight(&grid, highlight);
+	ProfBegin(&mark, "TileGridRender");
+	TileGridRender(&grid, dispCtrl.framePtr[dispCtrl.curFrame], dispCtrl.vMode.width, dispCtrl.vMode.height, dispCtrl.stride);
+	ProfEnd(&mark);
 }
 
-void FillColor3x3(u8 *frame, u32 width, u32 height, u32 stride, int color){
-	u32 xcoi, ycoi;
-	u32 iPixelAddr;
+/*
+ * Shows the first length tiles of sequence, SIMON_SHOW_FRAMES each with a
+ * SIMON_GAP_FRAMES blank board in between. Tile changes are drawn from the
+ * frame scheduler, so they line up with the display refresh. Other work can
+ * be added to the wait loop below; the core sleeps between frames.
+ */
+void PlaySequence(const int *sequence, int length)
+{
+	SimonPlayback playback;
 
-	for(xcoi = 0; xcoi < (width*3); xcoi+=3){
-		iPixelAddr = xcoi;
-		for(ycoi = 0; ycoi < height; ycoi++){
-			if (xcoi < ((width*3) / 3)){
-				if (ycoi < (height/3)){
-					frame[iPixelAddr+2] = 214;
-					frame[iPixelAddr+1] = 48;
-					frame[iPixelAddr] = 38;
-					if (color != 7){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}else if (ycoi < ((height/3)*2)){
-					frame[iPixelAddr+2] = 254;
-					frame[iPixelAddr+1] = 224;
-					frame[iPixelAddr] = 138;
-					if (color != 4){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}else{
-					frame[iPixelAddr+2] = 166;
-					frame[iPixelAddr+1] = 218;
-					frame[iPixelAddr] = 106;
-					if (color != 1){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}
-			}else if (xcoi < ( ((width*3) / 3) * 2 )){
-				if (ycoi < (height/3)){
-					frame[iPixelAddr+2] = 244;
-					frame[iPixelAddr+1] = 108;
-					frame[iPixelAddr] = 66;
-					if (color != 8){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}else if (ycoi < ((height/3)*2)){
-					frame[iPixelAddr+2] = 254;
-					frame[iPixelAddr+1] = 254;
-					frame[iPixelAddr] = 192;
-					if (color != 5){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}else{
-					frame[iPixelAddr+2] = 102;
-					frame[iPixelAddr+1] = 188;
-					frame[iPixelAddr] = 98;
-					if (color != 2){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}
-			}else{
-				if (ycoi < (height/3)){
-					frame[iPixelAddr+2] = 254;
-					frame[iPixelAddr+1] = 174;
-					frame[iPixelAddr] = 98;
-					if (color != 9){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}else if (ycoi < ((height/3)*2)){
-					frame[iPixelAddr+2] = 218;
-					frame[iPixelAddr+1] = 238;
-					frame[iPixelAddr] = 138;
-					if (color != 6){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}else{
-					frame[iPixelAddr+2] = 26;
-					frame[iPixelAddr+1] = 152;
-					frame[iPixelAddr] = 80;
-					if (color != 3){
-						for (int i = 0; i < 3; i++){
-							frame[iPixelAddr + i] /= 2;
-						}
-					}
-				}
-			}
-			iPixelAddr += stride;
-		}
-	}
+	playback.sequence = sequence;
+	playback.length = length;
+	playback.step = 0;
+	playback.done = 0;
+	playback.minFrames = 0xFFFFFFFF;
+	playback.maxFrames = 0;
+	playback.minUs = 0xFFFFFFFF;
+	playback.maxUs = 0;
 
+	/*
+	 * Start on the next frame boundary
+	 */
+	playback.nextDue = FrameSchedNow(&frameSched) + 1;
+	FrameSchedAt(&frameSched, playback.nextDue, PlaybackStep, &playback);
 
-	Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
+	while (!playback.done)
+	{
+		FrameSchedPoll(&frameSched);
+		if (!playback.done)
+		{
+			FrameSchedSleep(&frameSched);
+		}
+	}
 
+	UartPrintf("\n\rTile on-screen time: %d-%d frames, %d-%d us (target %d frames)",
+			playback.minFrames, playback.maxFrames, playback.minUs, playback.maxUs, SIMON_SHOW_FRAMES);
 }
 
-void FillColor2x2(u8 *frame, u32 width, u32 height, u32 stride, int color){
-	u32 xcoi, ycoi;
-	u32 iPixelAddr;
+/*
+ * Frame scheduler event that advances a sequence playback by one step
+ */
+void PlaybackStep(void *ref, u32 frame)
+{
+	SimonPlayback *playback = (SimonPlayback *) ref;
+	XTime now;
+	u32 frames, us;
 
-	switch (color){
-	//RED
-	case 0:
-		for(xcoi = 0; xcoi < (width*3); xcoi+=3){
-			iPixelAddr = xcoi;
-			for(ycoi = 0; ycoi < height; ycoi++){
-				if (xcoi < ((width*3) / 2)){
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 255;
-					}else{
-						frame[iPixelAddr] = 55;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 0;
-					}
-				}else{
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 0;
-					}else{
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 55;
-					}
-				}
-				iPixelAddr += stride;
-			}
-		}
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
-		break;
-
-	//BLUE
-	case 1:
-		for(xcoi = 0; xcoi < (width*3); xcoi+=3){
-			iPixelAddr = xcoi;
-			for(ycoi = 0; ycoi < height; ycoi++){
-				if (xcoi < ((width*3) / 2)){
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 55;
-					}else{
-						frame[iPixelAddr] = 255;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 0;
-					}
-				}else{
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 0;
-					}else{
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 55;
-					}
-				}
-				iPixelAddr += stride;
-			}
-		}
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
-		break;
-
-	//GREEN
-	case 2:
-		for(xcoi = 0; xcoi < (width*3); xcoi+=3){
-			iPixelAddr = xcoi;
-			for(ycoi = 0; ycoi < height; ycoi++){
-				if (xcoi < ((width*3) / 2)){
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 55;
-					}else{
-						frame[iPixelAddr] = 55;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 0;
-					}
-				}else{
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 255;
-						frame[iPixelAddr+2] = 0;
-					}else{
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 55;
-					}
-				}
-				iPixelAddr += stride;
-			}
-		}
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
-		break;
-
-	//YELLOW
-	case 3:
-		for(xcoi = 0; xcoi < (width*3); xcoi+=3){
-			iPixelAddr = xcoi;
-			for(ycoi = 0; ycoi < height; ycoi++){
-				if (xcoi < ((width*3) / 2)){
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 55;
-					}else{
-						frame[iPixelAddr] = 55;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 0;
-					}
-				}else{
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 0;
-					}else{
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 255;
-						frame[iPixelAddr+2] = 255;
-					}
-				}
-			iPixelAddr += stride;
-			}
-		}
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
-		break;
-
-	//Empty
-	case 4:
-		for(xcoi = 0; xcoi < (width*3); xcoi+=3){
-			iPixelAddr = xcoi;
-			for(ycoi = 0; ycoi < height; ycoi++){
-				if (xcoi < ((width*3) / 2)){
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 55;
-					}else{
-						frame[iPixelAddr] = 55;
-						frame[iPixelAddr+1] = 0;
-						frame[iPixelAddr+2] = 0;
-					}
-				}else{
-					if (ycoi < (height/2)){
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 0;
-					}else{
-						frame[iPixelAddr] = 0;
-						frame[iPixelAddr+1] = 55;
-						frame[iPixelAddr+2] = 55;
-					}
-				}
-			iPixelAddr += stride;
-			}
-		}
-		Xil_DCacheFlushRange((unsigned int) frame, DEMO_MAX_FRAME);
-		break;
+	if ((playback->step % 2) == 0)
+	{
+		ShowTiles(TILE_GRID_BIT(playback->sequence[playback->step / 2]));
+		playback->shownFrame = FrameSchedNow(&frameSched);
+		XTime_GetTime(&playback->shownTime);
+		playback->nextDue += SIMON_SHOW_FRAMES;
+	}
+	else
+	{
+		ShowTiles(TILE_GRID_NONE);
+
+		/*
+		 * Measure from the end of one draw to the end of the next, which is
+		 * how long the tile was actually visible
+		 */
+		frames = FrameSchedNow(&frameSched) - playback->shownFrame;
+		XTime_GetTime(&now);
+		us = (u32) ((now - playback->shownTime) / (COUNTS_PER_SECOND / 1000000));
+		if (frames < playback->minFrames) playback->minFrames = frames;
+		if (frames > playback->maxFrames) playback->maxFrames = frames;
+		if (us < playback->minUs) playback->minUs = us;
+		if (us > playback->maxUs) playback->maxUs = us;
+
+		playback->nextDue += SIMON_GAP_FRAMES;
 	}
 
+	playback->step++;
+	if (playback->step >= playback->length * 2)
+	{
+		playback->done = 1;
+		return;
+	}
 
+	/*
+	 * Schedule from the frame this step was due on rather than the frame it
+	 * ran on, so a late poll does not shift the rest of the sequence
+	 */
+	FrameSchedAt(&frameSched, playback->nextDue, PlaybackStep, playback);
 }
 
+/*
+ * Returns the tile selected by key, or -1 if the key does not select a tile
+ */
+int KeyToTile(const SimonVariant *variant, char key)
+{
+	u32 tile;
 
+	for (tile = 0; tile < variant->cols * variant->rows; tile++)
+	{
+		if (variant->keys[tile] == key)
+		{
+			return tile;
+		}
+	}
+
+	return -1;
+}
 
 void DemoISR(void *callBackRef, void *pVideo)
 {
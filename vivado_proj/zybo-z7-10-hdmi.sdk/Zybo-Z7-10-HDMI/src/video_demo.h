@@ -29,18 +29,14 @@
 /* ------------------------------------------------------------ */
 
 #include "xil_types.h"
+#include "tile_grid/tile_grid.h"
+#include "xtime_l.h"
 #include <stdlib.h>
 #include <time.h>
 /* ------------------------------------------------------------ */
 /*					Miscellaneous Declarations					*/
 /* ------------------------------------------------------------ */
 
-#define RED 0
-#define GREEN 1
-#define BLUE 2
-#define VIOLET 3
-#define YELLOW 4
-
 #define DEMO_MAX_FRAME (1920*1080*3)
 #define DEMO_STRIDE (1920 * 3)
 
@@ -50,6 +46,79 @@
  */
 #define DEMO_START_ON_DET 1
 
+/*
+ * Longest Simon Says sequence, in tiles
+ */
+#define SIMON_MAX_SEQ 10
+
+/*
+ * Sequence playback timing, in display frames (60 frames = 1 second at the
+ * default 60Hz mode)
+ */
+#define SIMON_SHOW_FRAMES 60
+
+/*
+ * Number of runs of each kernel at each resolution in Benchmark
+ */
+#define BENCH_REPS 8
+#define SIMON_GAP_FRAMES 60
+
+/*
+ * Number of passes of each memory bandwidth test at each resolution in
+ * MemoryBenchmark
+ */
+#define MEMORY_BENCH_REPS 2
+
+/*
+ * Seconds of VDMA error history listed by PrintProfile
+ */
+#define DEMO_VDMA_MON_SECONDS 16
+
+/*
+ * Framebuffer mapping used at start-up, FB_MAP_CACHED or FB_MAP_WC
+ */
+#define DEMO_FB_MAPPING FB_MAP_CACHED
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/*
+ * Describes one Simon Says board. Adding a new board size only needs a new
+ * palette, key map and SimonVariant.
+ */
+typedef struct {
+		u32 cols; /* Number of tile columns */
+		u32 rows; /* Number of tile rows */
+		const TileColor *palette; /* cols*rows tile colors, row-major */
+		const char *keys; /* Key that selects each tile, row-major */
+		const char *help; /* Printed when the player is asked for the sequence */
+} SimonVariant;
+
+/*
+ * State of a sequence playback. Each step alternates between lighting the
+ * next tile and blanking the board, and is advanced by the frame scheduler.
+ */
+typedef struct {
+		const int *sequence; /* Tiles to show */
+		int length; /* Number of tiles to show */
+		int step; /* Next step, even steps light sequence[step/2], odd steps blank the board */
+		volatile int done; /* Set once the board is blanked after the last tile */
+		u32 nextDue; /* Frame the next step is due on */
+		u32 shownFrame; /* Frame count when the current tile finished drawing */
+		XTime shownTime; /* Global timer when the current tile finished drawing */
+		u32 minFrames, maxFrames; /* Measured on-screen time of a tile, in frames */
+		u32 minUs, maxUs; /* Measured on-screen time of a tile, in microseconds */
+} SimonPlayback;
+
+/*
+ * Board and framebuffer passed to BenchTiles
+ */
+typedef struct {
+		const SimonVariant *variant;
+		u8 *frame;
+} TileBenchRef;
+
 /* ------------------------------------------------------------ */
 /*					Procedure Declarations						*/
 /* ------------------------------------------------------------ */
@@ -57,10 +126,19 @@
 void Initialize();
 void Run();
 void StartMenu();
+void RunSimonSays(const SimonVariant *variant);
 void RunSimonSays2x2();
-void FillColor2x2(u8 *frame, u32 width, u32 height, u32 stride, int color);
 void RunSimonSays3x3();
-void FillColor3x3(u8 *frame, u32 width, u32 height, u32 stride, int color);
+void ShowTiles(u32 highlight);
+void PrintProfile();
+void Benchmark();
+void MemoryBenchmark();
+u32 BenchTiles(void *ref, u32 width, u32 height);
+void Verify();
+void RefTileFill(u8 *frame, const SimonVariant *variant, u32 highlight, u32 width, u32 height, u32 stride);
+void PlaySequence(const int *sequence, int length);
+void PlaybackStep(void *ref, u32 frame);
+int KeyToTile(const SimonVariant *variant, char key);
 void DemoISR(void *callBackRef, void *pVideo);
 
 /* ------------------------------------------------------------ */